@@ -0,0 +1,640 @@
+"""Asyncio trading engine domain logic.
+
+This module implements AsyncEngine, the asyncio counterpart of Engine. Ticks run
+as tasks alongside the event listener so controller commands such as
+EMERGENCY_STOP are handled while a slow broker call is still in flight.
+"""
+
+import asyncio
+import threading
+import time
+from collections.abc import Awaitable, Callable
+from datetime import datetime
+from typing import Any
+from uuid import UUID
+
+from infrastructure.logging.logger import get_logger
+from system.algo_trader.domain.engine import Engine
+
+# Models
+from system.algo_trader.domain.models import (
+    JournalError,
+    JournalInput,
+    JournalOutput,
+    Orders,
+    StageLatency,
+)
+
+# Ports
+from system.algo_trader.domain.ports.account_port import AccountPort, AsyncAccountPort
+from system.algo_trader.domain.ports.async_adapters import (
+    AsyncAccountPortAdapter,
+    AsyncControllerPortAdapter,
+    AsyncEventPortAdapter,
+    AsyncHistoricalPortAdapter,
+    AsyncJournalPortAdapter,
+    AsyncOrderPortAdapter,
+    AsyncPortfolioManagerPortAdapter,
+    AsyncQuotePortAdapter,
+    AsyncStrategyPortAdapter,
+)
+from system.algo_trader.domain.ports.controller_port import AsyncControllerPort, ControllerPort
+from system.algo_trader.domain.ports.event_port import AsyncEventPort, EventPort
+from system.algo_trader.domain.ports.historical_port import AsyncHistoricalPort, HistoricalPort
+from system.algo_trader.domain.ports.journal_port import AsyncJournalPort, JournalPort
+from system.algo_trader.domain.ports.order_port import AsyncOrderPort, OrderPort
+from system.algo_trader.domain.ports.portfolio_manager_port import (
+    AsyncPortfolioManagerPort,
+    PortfolioManagerPort,
+)
+from system.algo_trader.domain.ports.quote_port import AsyncQuotePort, QuotePort
+from system.algo_trader.domain.ports.strategy_port import AsyncStrategyPort, StrategyPort
+from system.algo_trader.domain.order_book import OrderBook
+from system.algo_trader.domain.profiler import StageProfiler, TickLap
+from system.algo_trader.domain.risk import RiskEngine
+
+# States
+from system.algo_trader.domain.states import (
+    ControllerCommand,
+    EngineState,
+    EventType,
+    TradingState,
+)
+
+
+class AsyncEngine:
+    """Asyncio trading engine that runs ticks as coroutines.
+
+    Composes an Engine for the port-independent tick logic (signal filtering,
+    flatten orders, risk checks and order tracking) while awaiting asyncio
+    ports. The event listener and the in-flight tick run as separate tasks, so
+    commands never queue behind a tick. A TICK that arrives while a tick is
+    still running is coalesced into it. STOP lets the in-flight tick finish;
+    EMERGENCY_STOP sets the halt flag and cancels it.
+
+    Args:
+        historical_port: Async port for retrieving historical market data.
+        quote_port: Async port for retrieving current market quotes.
+        account_port: Async port for retrieving account information and positions.
+        order_port: Async port for sending and managing orders.
+        strategy_port: Async port for generating trading signals.
+        portfolio_manager_port: Async port for portfolio state and signal handling.
+        journal_port: Async port for logging trading activities.
+        controller_port: Async port for publishing engine status.
+        event_port: Async port for receiving control events and ticks.
+        fetch_timeout_s: Timeout for each per-tick data read, either one value for
+            every port or a mapping of fetch name to seconds.
+        clock: Optional callable returning the current time.
+        id_factory: Optional callable returning new order IDs.
+        profiler: Optional StageProfiler recording per-stage tick latency.
+        latency_publish_every: Publish latency percentiles every this many ticks.
+        risk_engine: Optional pre-trade risk check applied before sending orders.
+        order_book: Optional lifecycle-tracking order book for sent orders.
+        reconcile_every: Reconcile the order book against open orders every
+            this many ticks.
+        risk_sync_every: Resync the risk engine every this many ticks.
+        event_poll_s: Longest single wait on the event port. Bounds how long a
+            worker thread of a synchronous event port outlives the run loop.
+        halt: Optional flag set on EMERGENCY_STOP; shared with thread adapters
+            so an order send still queued for a worker thread is dropped.
+    """
+
+    def __init__(  # noqa: PLR0913
+        self,
+        historical_port: AsyncHistoricalPort,
+        quote_port: AsyncQuotePort,
+        account_port: AsyncAccountPort,
+        order_port: AsyncOrderPort,
+        strategy_port: AsyncStrategyPort,
+        portfolio_manager_port: AsyncPortfolioManagerPort,
+        journal_port: AsyncJournalPort,
+        controller_port: AsyncControllerPort,
+        event_port: AsyncEventPort,
+        fetch_timeout_s: float | dict[str, float] | None = None,
+        clock: Callable[[], datetime] | None = None,
+        id_factory: Callable[[], UUID] | None = None,
+        profiler: StageProfiler | None = None,
+        latency_publish_every: int = 100,
+        risk_engine: RiskEngine | None = None,
+        order_book: OrderBook | None = None,
+        reconcile_every: int = 10,
+        risk_sync_every: int = 100,
+        event_poll_s: float = 1.0,
+        halt: threading.Event | None = None,
+    ):
+        """Initialize async engine with dependency-injected asyncio ports.
+
+        Args:
+            historical_port: Async port for retrieving historical market data.
+            quote_port: Async port for retrieving current market quotes.
+            account_port: Async port for retrieving account information and positions.
+            order_port: Async port for sending and managing orders.
+            strategy_port: Async port for generating trading signals.
+            portfolio_manager_port: Async port for portfolio state and signal handling.
+            journal_port: Async port for logging trading activities.
+            controller_port: Async port for publishing engine status.
+            event_port: Async port for receiving control events and ticks.
+            fetch_timeout_s: Timeout for each per-tick data read, either one value for
+                every port or a mapping of fetch name to seconds.
+            clock: Optional callable returning the current time.
+            id_factory: Optional callable returning new order IDs.
+            profiler: Optional StageProfiler recording per-stage tick latency.
+            latency_publish_every: Publish latency percentiles every this many ticks.
+            risk_engine: Optional pre-trade risk check applied before sending orders.
+            order_book: Optional lifecycle-tracking order book for sent orders.
+            reconcile_every: Reconcile the order book against open orders every
+                this many ticks.
+            risk_sync_every: Resync the risk engine every this many ticks.
+            event_poll_s: Longest single wait on the event port. Bounds how long a
+                worker thread of a synchronous event port outlives the run loop.
+            halt: Optional flag set on EMERGENCY_STOP; shared with thread adapters
+                so an order send still queued for a worker thread is dropped.
+        """
+        self.logger = get_logger(self.__class__.__name__)
+        self.historical_port = historical_port
+        self.quote_port = quote_port
+        self.account_port = account_port
+        self.order_port = order_port
+        self.strategy_port = strategy_port
+        self.portfolio_manager_port = portfolio_manager_port
+        self.journal_port = journal_port
+        self.controller_port = controller_port
+        self.event_port = event_port
+        # The Engine only supplies tick logic; its run loop and port calls are
+        # never used, so it holds the asyncio ports purely for reference.
+        self.engine = Engine(
+            historical_port=historical_port,
+            quote_port=quote_port,
+            account_port=account_port,
+            order_port=order_port,
+            strategy_port=strategy_port,
+            portfolio_manager_port=portfolio_manager_port,
+            journal_port=journal_port,
+            controller_port=controller_port,
+            event_port=event_port,
+            fetch_timeout_s=fetch_timeout_s,
+            clock=clock,
+            id_factory=id_factory,
+            profiler=profiler,
+            latency_publish_every=latency_publish_every,
+            risk_engine=risk_engine,
+            order_book=order_book,
+            reconcile_every=reconcile_every,
+            risk_sync_every=risk_sync_every,
+        )
+        self.latency_publish_every = self.engine.latency_publish_every
+        self.event_poll_s = event_poll_s
+        self._halt = halt or threading.Event()
+        self._state = EngineState.SETUP
+        self._tick_task: asyncio.Task | None = None
+
+    @property
+    def profiler(self) -> StageProfiler:
+        """Return the per-stage latency profiler."""
+        return self.engine.profiler
+
+    @property
+    def risk_engine(self) -> RiskEngine | None:
+        """Return the pre-trade risk engine, if any."""
+        return self.engine.risk_engine
+
+    @property
+    def order_book(self) -> OrderBook | None:
+        """Return the lifecycle-tracking order book, if any."""
+        return self.engine.order_book
+
+    def _now(self) -> datetime:
+        """Return the current time from the engine clock."""
+        return self.engine._now()
+
+    @classmethod
+    def from_sync_ports(  # noqa: PLR0913
+        cls,
+        historical_port: HistoricalPort,
+        quote_port: QuotePort,
+        account_port: AccountPort,
+        order_port: OrderPort,
+        strategy_port: StrategyPort,
+        portfolio_manager_port: PortfolioManagerPort,
+        journal_port: JournalPort,
+        controller_port: ControllerPort,
+        event_port: EventPort,
+        fetch_timeout_s: float | dict[str, float] | None = None,
+        event_poll_s: float = 1.0,
+    ) -> "AsyncEngine":
+        """Build an AsyncEngine from synchronous ports via thread adapters.
+
+        Args:
+            historical_port: Port for retrieving historical market data.
+            quote_port: Port for retrieving current market quotes.
+            account_port: Port for retrieving account information and positions.
+            order_port: Port for sending and managing orders.
+            strategy_port: Port for generating trading signals.
+            portfolio_manager_port: Port for portfolio state and signal handling.
+            journal_port: Port for logging trading activities.
+            controller_port: Port for publishing engine status.
+            event_port: Port for receiving control events and ticks.
+            fetch_timeout_s: Timeout for each per-tick data read.
+            event_poll_s: Longest single wait on the event port.
+
+        Returns:
+            AsyncEngine whose ports delegate to the given synchronous ports.
+        """
+        halt = threading.Event()
+        return cls(
+            historical_port=AsyncHistoricalPortAdapter(historical_port),
+            quote_port=AsyncQuotePortAdapter(quote_port),
+            account_port=AsyncAccountPortAdapter(account_port),
+            order_port=AsyncOrderPortAdapter(order_port, halt=halt),
+            strategy_port=AsyncStrategyPortAdapter(strategy_port),
+            portfolio_manager_port=AsyncPortfolioManagerPortAdapter(portfolio_manager_port),
+            journal_port=AsyncJournalPortAdapter(journal_port),
+            controller_port=AsyncControllerPortAdapter(controller_port),
+            event_port=AsyncEventPortAdapter(event_port),
+            fetch_timeout_s=fetch_timeout_s,
+            event_poll_s=event_poll_s,
+            halt=halt,
+        )
+
+    @staticmethod
+    async def _timed_await(awaitable: Awaitable[Any]) -> tuple[Any, float]:
+        """Await a port read and measure its wall-clock latency.
+
+        Args:
+            awaitable: Port coroutine to await.
+
+        Returns:
+            Tuple of (result, latency in milliseconds).
+        """
+        start = time.perf_counter()
+        result = await awaitable
+        return result, (time.perf_counter() - start) * 1000.0
+
+    async def _fetch_tick_data(self) -> tuple[dict[str, Any], dict[str, float]]:
+        """Fetch market, account, order and portfolio data concurrently.
+
+        Returns:
+            Tuple of (results keyed by fetch name, latencies in milliseconds).
+
+        Raises:
+            TimeoutError: If a port read exceeds its timeout.
+        """
+        calls: dict[str, Awaitable[Any]] = {
+            "historical": self.historical_port.get_data(),
+            "quotes": self.quote_port.get_quotes(),
+            "account": self.account_port.get_account(),
+            "open_orders": self.order_port.get_open_orders(),
+            "portfolio_manager": self.portfolio_manager_port.get_state(),
+        }
+
+        async def fetch(name: str, call: Awaitable[Any]) -> tuple[Any, float]:
+            try:
+                return await asyncio.wait_for(
+                    self._timed_await(call), timeout=self.engine._fetch_timeout(name)
+                )
+            except asyncio.TimeoutError as e:
+                raise TimeoutError(
+                    f"Port fetch '{name}' exceeded timeout of {self.engine._fetch_timeout(name)}s"
+                ) from e
+
+        tasks = [asyncio.create_task(fetch(name, call)) for name, call in calls.items()]
+        try:
+            fetched = await asyncio.gather(*tasks)
+        except BaseException:
+            for task in tasks:
+                task.cancel()
+            raise
+
+        results: dict[str, Any] = {}
+        latencies: dict[str, float] = {}
+        for name, (result, latency) in zip(calls, fetched, strict=True):
+            results[name] = result
+            latencies[name] = latency
+        return results, latencies
+
+    async def publish_latency(self) -> list[StageLatency]:
+        """Publish per-stage latency percentiles to the controller port.
+
+        Returns:
+            The published latency summary.
+        """
+        latency = self.profiler.snapshot()
+        try:
+            await self.controller_port.publish_latency(latency)
+        except Exception as e:
+            self.logger.warning(f"Failed to publish tick latency: {e}")
+        return latency
+
+    async def _send_orders(self, orders: Orders) -> Orders:
+        """Send orders unless an emergency stop has been requested.
+
+        A send already running in a worker thread cannot be cancelled, so the
+        halt flag is checked right before dispatch rather than relying on
+        task cancellation alone.
+
+        Args:
+            orders: Orders to send.
+
+        Returns:
+            Orders the port reported as accepted.
+
+        Raises:
+            asyncio.CancelledError: If EMERGENCY_STOP was received.
+        """
+        if self._halt.is_set():
+            self.logger.warning(f"Emergency stop - dropping {len(orders.orders)} orders")
+            raise asyncio.CancelledError
+        return await self.order_port.send_orders(orders)
+
+    async def _poll_order_events(self) -> None:
+        """Fetch order events from the order port and apply them to the order book."""
+        if self.engine._lifecycle_book() is None:
+            return
+        try:
+            events = await self.order_port.get_order_events()
+        except Exception as e:
+            self.logger.warning(f"Failed to fetch order events: {e}")
+            return
+        self.engine._apply_order_events(events)
+
+    async def _tick(self) -> None:
+        """Execute a single trading tick and record its stage latencies."""
+        lap = self.profiler.start()
+        try:
+            await self._tick_stages(lap)
+        finally:
+            lap.finish()
+            if self.profiler.ticks % self.latency_publish_every == 0:
+                await self.publish_latency()
+
+    async def _tick_stages(self, lap: TickLap) -> None:
+        """Execute the stages of a trading tick.
+
+        Mirrors Engine._tick_stages, awaiting each port and fetching the
+        independent per-tick reads concurrently.
+
+        Args:
+            lap: Stopwatch marking the end of each stage.
+        """
+        # Follow fills and cancels of orders sent on earlier ticks
+        await self._poll_order_events()
+        lap.mark("order_events")
+
+        # Get portfolio state
+        portfolio_state = await self.portfolio_manager_port.get_state()
+        lap.mark("portfolio_state")
+
+        # Check if the portfolio manager says we can trade
+        if portfolio_state.trading_state == TradingState.DISABLED:
+            self.logger.info(f"TradingState: {portfolio_state.trading_state} - skipping tick")
+            return
+
+        # Get positions first in case we need to flatten
+        position_data, positions_latency_ms = await self._timed_await(
+            self.account_port.get_positions()
+        )
+        lap.mark("positions")
+        if portfolio_state.trading_state == TradingState.FLATTEN:
+            if len(position_data.positions) > 0:
+                flatten_orders = self.engine._flatten(position_data)
+                if not flatten_orders.orders:
+                    self.logger.info("Positions already being closed - nothing to flatten")
+                    return
+                accepted = await self._send_orders(flatten_orders)
+                self.engine._record_sent(flatten_orders, accepted)
+                lap.mark("send_orders")
+                now = self._now()
+                await self.journal_port.report_output(
+                    JournalOutput(
+                        timestamp=now,
+                        signals=Orders(timestamp=now, orders=[]),
+                        orders=flatten_orders,
+                    )
+                )
+                lap.mark("journal_output")
+            return
+
+        # Get market and account data
+        tick_data, port_latency_ms = await self._fetch_tick_data()
+        port_latency_ms["positions"] = positions_latency_ms
+        historical_data = tick_data["historical"]
+        quote_data = tick_data["quotes"]
+        account_data = tick_data["account"]
+        open_orders = tick_data["open_orders"]
+        portfolio_manager_state = tick_data["portfolio_manager"]
+        self.engine._reconcile_orders(open_orders)
+        lap.mark("data_fetch")
+        await self.journal_port.report_input(
+            JournalInput(
+                timestamp=self._now(),
+                historical_data=historical_data,
+                quote_data=quote_data,
+                account_data=account_data,
+                position_data=position_data,
+                open_orders=open_orders,
+                portfolio_manager_state=portfolio_manager_state,
+                port_latency_ms=port_latency_ms,
+                order_status=self.engine._order_status(),
+            )
+        )
+        lap.mark("journal_input")
+
+        # Get signals from the strategy
+        signals = await self.strategy_port.get_signals(
+            historical_data,
+            quote_data,
+            position_data,
+        )
+        lap.mark("strategy")
+
+        # Filter signals based on the portfolio manager's trading state
+        signals = self.engine._filter_signals(signals, portfolio_manager_state)
+        if self.order_book is not None:
+            signals = self.order_book.suppress_duplicates(signals)
+        lap.mark("filter")
+
+        # Handle signals with the portfolio manager
+        orders = await self.portfolio_manager_port.handle_signals(
+            signals,
+            quote_data,
+            account_data,
+            position_data,
+            open_orders,
+            portfolio_manager_state,
+        )
+        lap.mark("portfolio_manager")
+
+        # Enforce pre-trade risk limits
+        orders, rejections = self.engine._check_risk(
+            orders,
+            quote_data,
+            account_data,
+            position_data,
+            open_orders,
+            portfolio_manager_state,
+        )
+        lap.mark("risk")
+
+        # Send orders to the order port
+        accepted = await self._send_orders(orders)
+        self.engine._record_sent(orders, accepted)
+        lap.mark("send_orders")
+
+        await self.journal_port.report_output(
+            JournalOutput(
+                timestamp=self._now(),
+                signals=signals,
+                orders=orders,
+                rejections=rejections,
+            )
+        )
+        lap.mark("journal_output")
+
+    async def _set_state(self, state: EngineState) -> None:
+        """Transition engine state and publish it to the controller.
+
+        Args:
+            state: New engine state.
+        """
+        self._state = state
+        await self.controller_port.publish_status(self._state)
+
+    async def _finish_tick(self, task: asyncio.Task) -> None:
+        """Collect the outcome of a completed tick task.
+
+        A failed tick moves the engine to ERROR and journals the exception.
+        Cancelled ticks (EMERGENCY_STOP) are not errors.
+
+        Args:
+            task: Completed tick task.
+        """
+        if task.cancelled():
+            return
+        error = task.exception()
+        if error is None:
+            return
+        self.logger.error(f"Error in tick: {error}")
+        await self._set_state(EngineState.ERROR)
+        await self.journal_port.report_error(
+            JournalError(
+                timestamp=self._now(),
+                error=error,
+                engine_state=self._state,
+            )
+        )
+
+    async def _cancel_tick(self) -> None:
+        """Cancel the in-flight tick, if any, and wait for it to unwind."""
+        if self._tick_task is None:
+            return
+        self._tick_task.cancel()
+        await asyncio.gather(self._tick_task, return_exceptions=True)
+        self._tick_task = None
+
+    async def _wait_for_start(self) -> bool:
+        """Wait for a START command before entering the main loop.
+
+        Returns:
+            True if the engine was started, False if it was stopped first.
+        """
+        self.logger.info("Waiting for event")
+        while True:
+            ev = await self.event_port.wait_for_event(timeout_s=self.event_poll_s)
+            if ev is None or ev.type != EventType.COMMAND:
+                continue
+            if ev.command == ControllerCommand.START:
+                self.logger.info("ControllerCommand.START - setting engine state to RUNNING")
+                await self._set_state(EngineState.RUNNING)
+                return True
+            if ev.command in (ControllerCommand.STOP, ControllerCommand.EMERGENCY_STOP):
+                await self._set_state(EngineState.STOPPED)
+                return False
+
+    async def run(self) -> None:  # noqa: PLR0912
+        """Run the engine's main event loop.
+
+        Listens for events while at most one tick task runs concurrently.
+        Commands always take precedence and are handled as soon as they arrive,
+        regardless of how long the in-flight tick's port calls take.
+        """
+        self._halt.clear()
+        await self._set_state(EngineState.SETUP)
+        if not await self._wait_for_start():
+            return
+
+        event_task: asyncio.Task | None = None
+        try:
+            while self._state not in (EngineState.STOPPED, EngineState.ERROR):
+                if event_task is None:
+                    event_task = asyncio.create_task(
+                        self.event_port.wait_for_event(timeout_s=self.event_poll_s)
+                    )
+
+                pending = {event_task}
+                if self._tick_task is not None:
+                    pending.add(self._tick_task)
+                done, _ = await asyncio.wait(pending, return_when=asyncio.FIRST_COMPLETED)
+
+                if self._tick_task is not None and self._tick_task in done:
+                    await self._finish_tick(self._tick_task)
+                    self._tick_task = None
+                    if self._state == EngineState.ERROR:
+                        break
+
+                if event_task not in done:
+                    continue
+                ev = event_task.result()
+                event_task = None
+                if ev is None:
+                    continue
+
+                # Commands ALWAYS take precedence
+                if ev.type == EventType.COMMAND:
+                    if ev.command == ControllerCommand.PAUSE:
+                        self.logger.info("ControllerCommand.PAUSE - setting engine state to PAUSED")
+                        await self._set_state(EngineState.PAUSED)
+                        continue
+
+                    if ev.command == ControllerCommand.RESUME:
+                        self.logger.info(
+                            "ControllerCommand.RESUME - setting engine state to RUNNING"
+                        )
+                        await self._set_state(EngineState.RUNNING)
+                        continue
+
+                    if ev.command == ControllerCommand.EMERGENCY_STOP:
+                        self.logger.info(
+                            "ControllerCommand.EMERGENCY_STOP - cancelling tick and stopping"
+                        )
+                        self._halt.set()
+                        await self._cancel_tick()
+                        await self._set_state(EngineState.STOPPED)
+                        break
+
+                    if ev.command == ControllerCommand.STOP:
+                        self.logger.info("ControllerCommand.STOP - setting engine state to STOPPED")
+                        if self._tick_task is not None:
+                            await asyncio.wait({self._tick_task})
+                            await self._finish_tick(self._tick_task)
+                            self._tick_task = None
+                        if self._state != EngineState.ERROR:
+                            await self._set_state(EngineState.STOPPED)
+                        break
+
+                    continue  # ignore NONE/START while running
+
+                # Tick events only do work if RUNNING
+                if ev.type == EventType.TICK:
+                    if self._state != EngineState.RUNNING:
+                        continue
+                    if self._tick_task is not None:
+                        self.logger.debug("Tick already in flight - coalescing tick event")
+                        continue
+                    self.logger.info("Tick event received - executing tick")
+                    self._tick_task = asyncio.create_task(self._tick())
+        finally:
+            if event_task is not None:
+                event_task.cancel()
+            await self._cancel_tick()
+            if self.profiler.ticks:
+                await self.publish_latency()
@@ -7,19 +7,30 @@ generation, order management, and journaling through dependency injection.
 
 import time
 import uuid
+from collections.abc import Callable
+from concurrent.futures import ThreadPoolExecutor
+from concurrent.futures import TimeoutError as FutureTimeoutError
 from datetime import datetime, timezone
+from typing import Any
+from uuid import UUID
 
 from infrastructure.logging.logger import get_logger
 
 # Models
 from system.algo_trader.domain.models import (
+    Account,
     JournalError,
     JournalInput,
     JournalOutput,
     MarketOrder,
+    OrderEvent,
     Orders,
     PortfolioManager,
     Positions,
+    Quote,
+    QuoteBatch,
+    RiskRejection,
+    StageLatency,
 )
 from system.algo_trader.domain.ports.account_port import AccountPort
 from system.algo_trader.domain.ports.controller_port import ControllerPort
@@ -32,6 +43,9 @@ from system.algo_trader.domain.ports.order_port import OrderPort
 from system.algo_trader.domain.ports.portfolio_manager_port import PortfolioManagerPort
 from system.algo_trader.domain.ports.quote_port import QuotePort
 from system.algo_trader.domain.ports.strategy_port import StrategyPort
+from system.algo_trader.domain.order_book import OrderBook
+from system.algo_trader.domain.profiler import StageProfiler, TickLap
+from system.algo_trader.domain.risk import RiskEngine
 
 # States
 from system.algo_trader.domain.states import (
@@ -40,6 +54,7 @@ from system.algo_trader.domain.states import (
     EventType,
     OrderDuration,
     OrderInstruction,
+    OrderStatus,
     OrderTaxLotMethod,
     OrderType,
     TradingState,
@@ -63,6 +78,26 @@ class Engine:
         journal_port: Port for logging trading activities.
         controller_port: Port for publishing engine status.
         event_port: Port for receiving control events and ticks.
+        concurrent_fetch: Issue the independent per-tick data reads in parallel.
+        fetch_timeout_s: Timeout for each data read in concurrent mode, either one
+            value for every port or a mapping of fetch name to seconds.
+        clock: Optional callable returning the current time. Defaults to wall-clock
+            UTC; backtests inject simulated time.
+        id_factory: Optional callable returning new order IDs. Defaults to uuid4.
+        profiler: Optional StageProfiler recording per-stage tick latency. A new
+            one is created if omitted.
+        latency_publish_every: Publish latency percentiles to the controller port
+            every this many ticks (and when the run loop exits).
+        risk_engine: Optional pre-trade risk check applied to portfolio manager
+            orders before they are sent; rejections are journaled. Order fills
+            and cancels release its reservations.
+        order_book: Optional lifecycle-tracking order book; sent orders are
+            recorded in it, duplicate signals for open orders are dropped and
+            flatten only closes quantity not already being closed.
+        reconcile_every: Reconcile the order book against the broker's open
+            orders every this many ticks, closing orders missed by events.
+        risk_sync_every: Resync the risk engine from positions and open orders
+            every this many ticks to correct drift.
     """
 
     def __init__(  # noqa: PLR0913
@@ -76,6 +111,16 @@ class Engine:
         journal_port: JournalPort,
         controller_port: ControllerPort,
         event_port: EventPort,
+        concurrent_fetch: bool = False,
+        fetch_timeout_s: float | dict[str, float] | None = None,
+        clock: Callable[[], datetime] | None = None,
+        id_factory: Callable[[], UUID] | None = None,
+        profiler: StageProfiler | None = None,
+        latency_publish_every: int = 100,
+        risk_engine: RiskEngine | None = None,
+        order_book: OrderBook | None = None,
+        reconcile_every: int = 10,
+        risk_sync_every: int = 100,
     ):
         """Initialize engine with dependency-injected ports.
 
@@ -89,6 +134,26 @@ class Engine:
             journal_port: Port for logging trading activities.
             controller_port: Port for publishing engine status.
             event_port: Port for receiving control events and ticks.
+            concurrent_fetch: Issue the independent per-tick data reads in parallel.
+            fetch_timeout_s: Timeout for each data read in concurrent mode, either one
+                value for every port or a mapping of fetch name to seconds.
+            clock: Optional callable returning the current time. Defaults to wall-clock
+                UTC; backtests inject simulated time.
+            id_factory: Optional callable returning new order IDs. Defaults to uuid4.
+            profiler: Optional StageProfiler recording per-stage tick latency. A new
+                one is created if omitted.
+            latency_publish_every: Publish latency percentiles to the controller port
+                every this many ticks (and when the run loop exits).
+            risk_engine: Optional pre-trade risk check applied to portfolio manager
+                orders before they are sent; rejections are journaled. Order fills
+                and cancels release its reservations.
+            order_book: Optional lifecycle-tracking order book; sent orders are
+                recorded in it, duplicate signals for open orders are dropped and
+                flatten only closes quantity not already being closed.
+            reconcile_every: Reconcile the order book against the broker's open
+                orders every this many ticks, closing orders missed by events.
+            risk_sync_every: Resync the risk engine from positions and open orders
+                every this many ticks to correct drift.
         """
         self.logger = get_logger(self.__class__.__name__)
         self.historical_port = historical_port
@@ -100,6 +165,21 @@ class Engine:
         self.journal_port = journal_port
         self.controller_port = controller_port
         self.event_port = event_port
+        self.concurrent_fetch = concurrent_fetch
+        self.fetch_timeout_s = fetch_timeout_s
+        self._fetch_executor: ThreadPoolExecutor | None = None
+        self._now = clock or (lambda: datetime.now(timezone.utc))
+        self._new_id = id_factory or uuid.uuid4
+        self.profiler = profiler or StageProfiler()
+        self.latency_publish_every = max(1, latency_publish_every)
+        self.risk_engine = risk_engine
+        self.order_book = order_book
+        self.reconcile_every = max(1, reconcile_every)
+        self.risk_sync_every = max(1, risk_sync_every)
+        # Ticks run by this engine for the reconcile and risk resync cadences;
+        # unlike profiler.ticks, never reset
+        self._ticks = 0
+        self._risk_book: OrderBook | None = None
         self._state = EngineState.SETUP
         self.logger.info(f"Engine state: {self._state}")
 
@@ -133,10 +213,16 @@ class Engine:
         orders.extend(close_long.orders)
         orders.extend(close_short.orders)
         return Orders(
-            timestamp=datetime.now(timezone.utc),
+            timestamp=self._now(),
             orders=orders,
         )
 
+    def _closing(self, symbol: str, instruction: OrderInstruction) -> int:
+        """Return quantity already being closed by open orders in the order book."""
+        if self.order_book is None:
+            return 0
+        return self.order_book.open_quantity(symbol, instruction)
+
     def _close_long(self, positions: Positions) -> Orders:
         """Generate SELL_TO_CLOSE orders for long positions.
 
@@ -147,14 +233,18 @@ class Engine:
             Orders collection containing close orders for long positions.
         """
         orders = []
+        now = self._now()
         for position in positions.positions:
-            if position.quantity > 0:
+            quantity = position.quantity - self._closing(
+                position.symbol, OrderInstruction.SELL_TO_CLOSE
+            )
+            if quantity > 0:
                 orders.append(
                     MarketOrder(
-                        id=uuid.uuid4(),
-                        timestamp=datetime.now(timezone.utc),
+                        id=self._new_id(),
+                        timestamp=now,
                         symbol=position.symbol,
-                        quantity=position.quantity,
+                        quantity=quantity,
                         order_type=OrderType.MARKET,
                         order_instruction=OrderInstruction.SELL_TO_CLOSE,
                         order_duration=OrderDuration.DAY,
@@ -162,7 +252,7 @@ class Engine:
                     )
                 )
         return Orders(
-            timestamp=datetime.now(timezone.utc),
+            timestamp=now,
             orders=orders,
         )
 
@@ -176,14 +266,18 @@ class Engine:
             Orders collection containing close orders for short positions.
         """
         orders = []
+        now = self._now()
         for position in positions.positions:
-            if position.quantity < 0:
+            quantity = -position.quantity - self._closing(
+                position.symbol, OrderInstruction.BUY_TO_CLOSE
+            )
+            if quantity > 0:
                 orders.append(
                     MarketOrder(
-                        id=uuid.uuid4(),
-                        timestamp=datetime.now(timezone.utc),
+                        id=self._new_id(),
+                        timestamp=now,
                         symbol=position.symbol,
-                        quantity=abs(position.quantity),
+                        quantity=quantity,
                         order_type=OrderType.MARKET,
                         order_instruction=OrderInstruction.BUY_TO_CLOSE,
                         order_duration=OrderDuration.DAY,
@@ -191,7 +285,7 @@ class Engine:
                     )
                 )
         return Orders(
-            timestamp=datetime.now(timezone.utc),
+            timestamp=now,
             orders=orders,
         )
 
@@ -224,10 +318,232 @@ class Engine:
             orders=filtered_signals,
         )
 
+    @staticmethod
+    def _timed_call(call: Callable[[], Any]) -> tuple[Any, float]:
+        """Invoke a port read and measure its wall-clock latency.
+
+        Args:
+            call: Zero-argument port method to invoke.
+
+        Returns:
+            Tuple of (result, latency in milliseconds).
+        """
+        start = time.perf_counter()
+        result = call()
+        return result, (time.perf_counter() - start) * 1000.0
+
+    def _fetch_timeout(self, name: str) -> float | None:
+        """Resolve the concurrent fetch timeout for a single port read.
+
+        Args:
+            name: Fetch name (historical, quotes, account, open_orders, portfolio_manager).
+
+        Returns:
+            Timeout in seconds, or None to wait indefinitely.
+        """
+        if isinstance(self.fetch_timeout_s, dict):
+            return self.fetch_timeout_s.get(name)
+        return self.fetch_timeout_s
+
+    def _fetch_tick_data(self) -> tuple[dict[str, Any], dict[str, float]]:
+        """Fetch market, account, order and portfolio data for a tick.
+
+        In sequential mode each port is read in turn. In concurrent mode all reads
+        are submitted to a shared thread pool and joined before returning, so tick
+        latency is bounded by the slowest port instead of the sum of all ports.
+
+        Returns:
+            Tuple of (results keyed by fetch name, latencies in milliseconds).
+
+        Raises:
+            TimeoutError: If a port read exceeds its timeout in concurrent mode.
+        """
+        calls: dict[str, Callable[[], Any]] = {
+            "historical": self.historical_port.get_data,
+            "quotes": self.quote_port.get_quotes,
+            "account": self.account_port.get_account,
+            "open_orders": self.order_port.get_open_orders,
+            "portfolio_manager": self.portfolio_manager_port.get_state,
+        }
+        results: dict[str, Any] = {}
+        latencies: dict[str, float] = {}
+
+        if not self.concurrent_fetch:
+            for name, call in calls.items():
+                results[name], latencies[name] = self._timed_call(call)
+            return results, latencies
+
+        if self._fetch_executor is None:
+            self._fetch_executor = ThreadPoolExecutor(
+                max_workers=len(calls), thread_name_prefix="engine-fetch"
+            )
+
+        submitted_at = time.monotonic()
+        futures = {
+            name: self._fetch_executor.submit(self._timed_call, call)
+            for name, call in calls.items()
+        }
+        for name, future in futures.items():
+            timeout = self._fetch_timeout(name)
+            remaining = None
+            if timeout is not None:
+                remaining = max(0.0, timeout - (time.monotonic() - submitted_at))
+            try:
+                results[name], latencies[name] = future.result(timeout=remaining)
+            except FutureTimeoutError as e:
+                for pending in futures.values():
+                    pending.cancel()
+                raise TimeoutError(f"Port fetch '{name}' exceeded timeout of {timeout}s") from e
+        return results, latencies
+
+    def _shutdown_fetch_executor(self) -> None:
+        """Shut down the concurrent fetch pool without waiting on stuck reads."""
+        if self._fetch_executor is not None:
+            self._fetch_executor.shutdown(wait=False, cancel_futures=True)
+            self._fetch_executor = None
+
+    def _check_risk(  # noqa: PLR0913
+        self,
+        orders: Orders,
+        quote_data: Quote | QuoteBatch,
+        account_data: Account,
+        position_data: Positions,
+        open_orders: Orders,
+        portfolio_manager_state: PortfolioManager,
+    ) -> tuple[Orders, list[RiskRejection]]:
+        """Apply the pre-trade risk check to outgoing orders.
+
+        The risk engine is synced from the full snapshot on the first tick and
+        every risk_sync_every ticks, and kept current incrementally from order
+        events in between; each tick refreshes equity and marks.
+
+        Args:
+            orders: Orders from the portfolio manager.
+            quote_data: Current quotes used as mark prices.
+            account_data: Current account; net liquidation sets the limits.
+            position_data: Current positions (used for syncs).
+            open_orders: Open orders (used for syncs).
+            portfolio_manager_state: Exposure and position limits.
+
+        Returns:
+            Tuple of (orders to send, rejections).
+        """
+        risk = self.risk_engine
+        if risk is None:
+            return orders, []
+        if not risk.synced or self._ticks % self.risk_sync_every == 0:
+            risk.sync(position_data, open_orders)
+        risk.update_account(account_data)
+        risk.mark_prices(quote_data)
+        orders, rejections = risk.check(orders, portfolio_manager_state)
+        for rejection in rejections:
+            self.logger.warning(
+                f"Risk rejected {rejection.order.symbol} order {rejection.order.id}: "
+                f"{rejection.reason.value} ({rejection.detail})"
+            )
+        return orders, rejections
+
+    def _order_status(self) -> dict[UUID, OrderStatus]:
+        """Return the order book's open order statuses for the journal."""
+        return self.order_book.statuses() if self.order_book is not None else {}
+
+    def _apply_order_events(self, events: list[OrderEvent]) -> None:
+        """Apply broker order events to the order book.
+
+        Args:
+            events: Events reported by the order port.
+        """
+        applied = self._lifecycle_book().apply_events(events)
+        if applied:
+            self.logger.debug(f"Applied {applied} order events")
+
+    def _poll_order_events(self) -> None:
+        """Fetch order events from the order port and apply them to the order book."""
+        if self._lifecycle_book() is None:
+            return
+        try:
+            events = self.order_port.get_order_events()
+        except Exception as e:
+            self.logger.warning(f"Failed to fetch order events: {e}")
+            return
+        self._apply_order_events(events)
+
+    def _reconcile_orders(self, open_orders: Orders) -> None:
+        """Periodically close book orders the broker no longer lists as open.
+
+        Args:
+            open_orders: Open orders fetched this tick.
+        """
+        book = self._lifecycle_book()
+        if book is None or self._ticks % self.reconcile_every:
+            return
+        book.reconcile(open_orders, self._now())
+
+    def _lifecycle_book(self) -> OrderBook | None:
+        """Return the book that follows sent orders through fills and cancels.
+
+        Without an order book, a private one is kept while a risk engine is
+        set so its reservations are still released. A book given without a
+        risk engine is attached to the engine's one.
+
+        Returns:
+            The order book, the private book, or None if neither is needed.
+        """
+        book = self.order_book
+        if book is None:
+            if self.risk_engine is None:
+                return None
+            if self._risk_book is None or self._risk_book.risk_engine is not self.risk_engine:
+                self._risk_book = OrderBook(self.risk_engine)
+            return self._risk_book
+        if book.risk_engine is None:
+            book.risk_engine = self.risk_engine
+        return book
+
+    def _record_sent(self, orders: Orders, accepted: Orders | None) -> None:
+        """Track sent orders so fills and cancels update the book and risk engine.
+
+        Args:
+            orders: Orders passed to the order port.
+            accepted: Orders the port reported as accepted.
+        """
+        book = self._lifecycle_book()
+        if book is not None:
+            book.record_submission(orders, accepted, self._now())
+
+    def publish_latency(self) -> list[StageLatency]:
+        """Publish per-stage latency percentiles to the controller port.
+
+        Returns:
+            The published latency summary.
+        """
+        latency = self.profiler.snapshot()
+        try:
+            self.controller_port.publish_latency(latency)
+        except Exception as e:
+            self.logger.warning(f"Failed to publish tick latency: {e}")
+        return latency
+
     def _tick(self) -> None:
-        """Execute a single trading tick.
+        """Execute a single trading tick and record its stage latencies.
+
+        Every latency_publish_every ticks the percentiles are published to the
+        controller port.
+        """
+        lap = self.profiler.start()
+        try:
+            self._tick_stages(lap)
+        finally:
+            self._ticks += 1
+            lap.finish()
+            if self.profiler.ticks % self.latency_publish_every == 0:
+                self.publish_latency()
+
+    def _tick_stages(self, lap: TickLap) -> None:
+        """Execute the stages of a trading tick.
 
         Performs one complete trading cycle:
+        0. Apply order events to the order book
         1. Check trading state (disabled/flatten/normal)
         2. Fetch market and account data
         3. Get signals from strategy
@@ -235,9 +551,17 @@ class Engine:
         5. Process signals through portfolio manager
         6. Send orders
         7. Journal all activities
+
+        Args:
+            lap: Stopwatch marking the end of each stage.
         """
+        # Follow fills and cancels of orders sent on earlier ticks
+        self._poll_order_events()
+        lap.mark("order_events")
+
         # Get portfolio state
         portfolio_state = self.portfolio_manager_port.get_state()
+        lap.mark("portfolio_state")
 
         # Check if the portfolio manager says we can trade
         if portfolio_state.trading_state == TradingState.DISABLED:
@@ -245,38 +569,53 @@ class Engine:
             return
 
         # Get positions first in case we need to flatten
-        position_data = self.account_port.get_positions()
+        position_data, positions_latency_ms = self._timed_call(self.account_port.get_positions)
+        lap.mark("positions")
         if portfolio_state.trading_state == TradingState.FLATTEN:
             if len(position_data.positions) > 0:
                 flatten_orders = self._flatten(position_data)
-                self.order_port.send_orders(flatten_orders)
+                if not flatten_orders.orders:
+                    self.logger.info("Positions already being closed - nothing to flatten")
+                    return
+                accepted = self.order_port.send_orders(flatten_orders)
+                self._record_sent(flatten_orders, accepted)
+                lap.mark("send_orders")
+                now = self._now()
                 self.journal_port.report_output(
                     JournalOutput(
-                        timestamp=datetime.now(timezone.utc),
-                        signals=Orders(timestamp=datetime.now(timezone.utc), orders=[]),
+                        timestamp=now,
+                        signals=Orders(timestamp=now, orders=[]),
                         orders=flatten_orders,
                     )
                 )
+                lap.mark("journal_output")
                 return
             return
 
         # Get market and account data
-        historical_data = self.historical_port.get_data()
-        quote_data = self.quote_port.get_quotes()
-        account_data = self.account_port.get_account()
-        open_orders = self.order_port.get_open_orders()
-        portfolio_manager_state = self.portfolio_manager_port.get_state()
+        tick_data, port_latency_ms = self._fetch_tick_data()
+        port_latency_ms["positions"] = positions_latency_ms
+        historical_data = tick_data["historical"]
+        quote_data = tick_data["quotes"]
+        account_data = tick_data["account"]
+        open_orders = tick_data["open_orders"]
+        portfolio_manager_state = tick_data["portfolio_manager"]
+        self._reconcile_orders(open_orders)
+        lap.mark("data_fetch")
         self.journal_port.report_input(
             JournalInput(
-                timestamp=datetime.now(timezone.utc),
+                timestamp=self._now(),
                 historical_data=historical_data,
                 quote_data=quote_data,
                 account_data=account_data,
                 position_data=position_data,
                 open_orders=open_orders,
                 portfolio_manager_state=portfolio_manager_state,
+                port_latency_ms=port_latency_ms,
+                order_status=self._order_status(),
             )
         )
+        lap.mark("journal_input")
 
         # Get signals from the strategy
         signals = self.strategy_port.get_signals(
@@ -284,9 +623,13 @@ class Engine:
             quote_data,
             position_data,
         )
+        lap.mark("strategy")
 
         # Filter signals based on the portfolio manager's trading state
         signals = self._filter_signals(signals, portfolio_manager_state)
+        if self.order_book is not None:
+            signals = self.order_book.suppress_duplicates(signals)
+        lap.mark("filter")
 
         # Handle signals with the portfolio manager
         orders = self.portfolio_manager_port.handle_signals(
@@ -297,17 +640,33 @@ class Engine:
             open_orders,
             portfolio_manager_state,
         )
+        lap.mark("portfolio_manager")
+
+        # Enforce pre-trade risk limits
+        orders, rejections = self._check_risk(
+            orders,
+            quote_data,
+            account_data,
+            position_data,
+            open_orders,
+            portfolio_manager_state,
+        )
+        lap.mark("risk")
 
         # Send orders to the order port
-        self.order_port.send_orders(orders)
+        accepted = self.order_port.send_orders(orders)
+        self._record_sent(orders, accepted)
+        lap.mark("send_orders")
 
         self.journal_port.report_output(
             JournalOutput(
-                timestamp=datetime.now(timezone.utc),
+                timestamp=self._now(),
                 signals=signals,
                 orders=orders,
+                rejections=rejections,
             )
         )
+        lap.mark("journal_output")
 
     def run(self) -> None:  # noqa: PLR0912, PLR0915
         """Run the engine's main event loop.
@@ -381,11 +740,14 @@ class Engine:
                     self.controller_port.publish_status(self._state)
                     self.journal_port.report_error(
                         JournalError(
-                            timestamp=datetime.now(timezone.utc),
+                            timestamp=self._now(),
                             error=e,
                             engine_state=self._state,
                         )
                     )
                     break
 
+        if self.profiler.ticks:
+            self.publish_latency()
+        self._shutdown_fetch_executor()
         time.sleep(0.01)
@@ -4,10 +4,13 @@ This module defines all data models used throughout the trading system,
 including orders, positions, account data, market data, and journal entries.
 """
 
-from dataclasses import dataclass
-from datetime import datetime
+from __future__ import annotations
+
+from dataclasses import dataclass, field
+from datetime import date, datetime
 from uuid import UUID
 
+import numpy as np
 import pandas as pd
 
 from system.algo_trader.domain.states import (
@@ -17,8 +20,10 @@ from system.algo_trader.domain.states import (
     MarketStatus,
     OrderDuration,
     OrderInstruction,
+    OrderStatus,
     OrderTaxLotMethod,
     OrderType,
+    RiskRejectReason,
     TickReason,
     TradingState,
 )
@@ -195,6 +200,520 @@ class Quote:
     change_pct: dict[str, float]
 
 
+# Field order of the QuoteBatch value matrix; matches the Quote dataclass maps
+QUOTE_FIELDS = ("bid", "ask", "bid_size", "ask_size", "last", "volume", "change", "change_pct")
+
+# Canonical OHLCV column names carried by OHLCVPanel
+OHLCV_FIELDS = ("open", "high", "low", "close", "volume")
+
+# Field order of the OptionChain value matrix
+OPTION_FIELDS = (
+    "strike",
+    "bid",
+    "ask",
+    "last",
+    "mark",
+    "delta",
+    "gamma",
+    "theta",
+    "vega",
+    "rho",
+    "volatility",
+    "open_interest",
+    "volume",
+)
+
+
+@dataclass
+class QuoteBatch:
+    """Columnar real-time quote model.
+
+    Stores every quote field for every symbol in one contiguous float64 matrix
+    of shape (len(QUOTE_FIELDS), len(symbols)). Each field row is contiguous, and
+    per-field and per-symbol accessors return views into the matrix rather than
+    copies. Missing values are NaN.
+
+    Attributes:
+        timestamp: Quote timestamp.
+        asset_class: Asset class (e.g., "EQUITY").
+        symbols: Symbol index; position i maps to column i of values.
+        values: Field-major value matrix, one row per entry in QUOTE_FIELDS.
+    """
+
+    timestamp: datetime
+    asset_class: str
+    symbols: tuple[str, ...]
+    values: np.ndarray
+    _index: dict[str, int] = field(init=False, repr=False, compare=False)
+
+    def __post_init__(self) -> None:
+        """Validate the value matrix shape and build the symbol index."""
+        self.symbols = tuple(self.symbols)
+        self.values = np.ascontiguousarray(self.values, dtype=np.float64)
+        expected = (len(QUOTE_FIELDS), len(self.symbols))
+        if self.values.shape != expected:
+            raise ValueError(f"QuoteBatch values shape {self.values.shape} != {expected}")
+        self._index = {symbol: i for i, symbol in enumerate(self.symbols)}
+
+    def __len__(self) -> int:
+        """Return the number of symbols in the batch."""
+        return len(self.symbols)
+
+    def __contains__(self, symbol: str) -> bool:
+        """Return True if the symbol is present in the batch."""
+        return symbol in self._index
+
+    def index_of(self, symbol: str) -> int:
+        """Return the column position of a symbol.
+
+        Raises:
+            KeyError: If the symbol is not in the batch.
+        """
+        return self._index[symbol]
+
+    def field_view(self, name: str) -> np.ndarray:
+        """Return a view of one field across all symbols.
+
+        Args:
+            name: Field name from QUOTE_FIELDS.
+
+        Returns:
+            Contiguous float64 view of length len(symbols).
+        """
+        return self.values[QUOTE_FIELDS.index(name)]
+
+    def symbol_view(self, symbol: str) -> np.ndarray:
+        """Return a view of every field for one symbol, ordered as QUOTE_FIELDS.
+
+        Args:
+            symbol: Symbol to look up.
+
+        Returns:
+            Strided float64 view of length len(QUOTE_FIELDS).
+        """
+        return self.values[:, self._index[symbol]]
+
+    @property
+    def bid(self) -> np.ndarray:
+        """Bid prices aligned with symbols."""
+        return self.values[0]
+
+    @property
+    def ask(self) -> np.ndarray:
+        """Ask prices aligned with symbols."""
+        return self.values[1]
+
+    @property
+    def bid_size(self) -> np.ndarray:
+        """Bid sizes aligned with symbols."""
+        return self.values[2]
+
+    @property
+    def ask_size(self) -> np.ndarray:
+        """Ask sizes aligned with symbols."""
+        return self.values[3]
+
+    @property
+    def last(self) -> np.ndarray:
+        """Last trade prices aligned with symbols."""
+        return self.values[4]
+
+    @property
+    def volume(self) -> np.ndarray:
+        """Volumes aligned with symbols."""
+        return self.values[5]
+
+    @property
+    def change(self) -> np.ndarray:
+        """Price changes aligned with symbols."""
+        return self.values[6]
+
+    @property
+    def change_pct(self) -> np.ndarray:
+        """Percentage changes aligned with symbols."""
+        return self.values[7]
+
+    @classmethod
+    def from_quote(cls, quote: Quote) -> QuoteBatch:
+        """Build a columnar batch from a dict-per-field Quote.
+
+        The symbol index is the union of symbols across all fields, in first-seen
+        order; fields missing for a symbol become NaN.
+
+        Args:
+            quote: Quote to convert.
+
+        Returns:
+            QuoteBatch holding the same values.
+        """
+        index: dict[str, int] = {}
+        for name in QUOTE_FIELDS:
+            for symbol in getattr(quote, name):
+                index.setdefault(symbol, len(index))
+
+        values = np.full((len(QUOTE_FIELDS), len(index)), np.nan, dtype=np.float64)
+        for row, name in enumerate(QUOTE_FIELDS):
+            for symbol, value in getattr(quote, name).items():
+                if value is not None:
+                    values[row, index[symbol]] = value
+
+        return cls(
+            timestamp=quote.timestamp,
+            asset_class=quote.asset_class,
+            symbols=tuple(index),
+            values=values,
+        )
+
+    def to_quote(self) -> Quote:
+        """Convert back to a dict-per-field Quote, omitting NaN entries.
+
+        Returns:
+            Quote holding the same values.
+        """
+        maps: dict[str, dict[str, float]] = {}
+        for row, name in enumerate(QUOTE_FIELDS):
+            present = ~np.isnan(self.values[row])
+            maps[name] = {
+                self.symbols[i]: float(self.values[row, i]) for i in np.flatnonzero(present)
+            }
+        return Quote(timestamp=self.timestamp, asset_class=self.asset_class, **maps)
+
+
+@dataclass
+class OHLCVPanel:
+    """Columnar historical OHLCV model.
+
+    Bars for all symbols are concatenated into one contiguous array per field,
+    with offsets delimiting each symbol's run (CSR layout), so symbols may have
+    different history lengths. Per-symbol accessors slice the shared arrays and
+    return zero-copy contiguous views.
+
+    Attributes:
+        period: Time period covered (e.g., "1Y" for one year).
+        frequency: Data frequency (e.g., "1D" for daily).
+        start: Start datetime.
+        end: End datetime.
+        symbols: Symbol index; position i owns rows offsets[i]:offsets[i + 1].
+        offsets: int64 array of length len(symbols) + 1.
+        index: Concatenated row index (bar timestamps) for all symbols.
+        columns: Mapping of field name to concatenated float64 values.
+    """
+
+    period: str
+    frequency: str
+    start: datetime
+    end: datetime
+    symbols: tuple[str, ...]
+    offsets: np.ndarray
+    index: np.ndarray
+    columns: dict[str, np.ndarray]
+    _positions: dict[str, int] = field(init=False, repr=False, compare=False)
+
+    def __post_init__(self) -> None:
+        """Validate array lengths and build the symbol index."""
+        self.symbols = tuple(self.symbols)
+        self.offsets = np.asarray(self.offsets, dtype=np.int64)
+        if len(self.offsets) != len(self.symbols) + 1:
+            raise ValueError("OHLCVPanel offsets must have len(symbols) + 1 entries")
+        total = int(self.offsets[-1])
+        if len(self.index) != total:
+            raise ValueError(f"OHLCVPanel index length {len(self.index)} != {total}")
+        for name, values in self.columns.items():
+            if len(values) != total:
+                raise ValueError(f"OHLCVPanel column '{name}' length {len(values)} != {total}")
+        self._positions = {symbol: i for i, symbol in enumerate(self.symbols)}
+
+    def __len__(self) -> int:
+        """Return the number of symbols in the panel."""
+        return len(self.symbols)
+
+    def __contains__(self, symbol: str) -> bool:
+        """Return True if the symbol is present in the panel."""
+        return symbol in self._positions
+
+    def _bounds(self, symbol: str) -> slice:
+        i = self._positions[symbol]
+        return slice(int(self.offsets[i]), int(self.offsets[i + 1]))
+
+    def column(self, symbol: str, name: str) -> np.ndarray:
+        """Return a zero-copy view of one field for one symbol.
+
+        Args:
+            symbol: Symbol to look up.
+            name: Field name (e.g., "close").
+
+        Returns:
+            Contiguous view of the symbol's bars for that field.
+        """
+        return self.columns[name][self._bounds(symbol)]
+
+    def symbol_index(self, symbol: str) -> np.ndarray:
+        """Return a zero-copy view of one symbol's bar timestamps."""
+        return self.index[self._bounds(symbol)]
+
+    def symbol_view(self, symbol: str) -> dict[str, np.ndarray]:
+        """Return zero-copy views of every field for one symbol.
+
+        Args:
+            symbol: Symbol to look up.
+
+        Returns:
+            Mapping of field name to the symbol's contiguous values.
+        """
+        bounds = self._bounds(symbol)
+        return {name: values[bounds] for name, values in self.columns.items()}
+
+    @classmethod
+    def from_historical(cls, historical: HistoricalOHLCV) -> OHLCVPanel:
+        """Build a columnar panel from per-symbol DataFrames.
+
+        Columns are the OHLCV fields present in any frame (in OHLCV_FIELDS order)
+        followed by any other columns in first-seen order; frames lacking a
+        column contribute NaN.
+
+        Args:
+            historical: HistoricalOHLCV to convert.
+
+        Returns:
+            OHLCVPanel holding the same bars.
+        """
+        symbols = tuple(historical.data)
+        frames = [historical.data[symbol] for symbol in symbols]
+
+        seen: list[str] = []
+        for frame in frames:
+            for name in frame.columns:
+                if name not in seen:
+                    seen.append(name)
+        names = [n for n in OHLCV_FIELDS if n in seen] + [n for n in seen if n not in OHLCV_FIELDS]
+
+        offsets = np.zeros(len(frames) + 1, dtype=np.int64)
+        offsets[1:] = np.cumsum([len(frame) for frame in frames], dtype=np.int64)
+        total = int(offsets[-1])
+
+        columns = {name: np.full(total, np.nan, dtype=np.float64) for name in names}
+        for i, frame in enumerate(frames):
+            lo, hi = int(offsets[i]), int(offsets[i + 1])
+            for name in frame.columns:
+                columns[name][lo:hi] = frame[name].to_numpy(dtype=np.float64, na_value=np.nan)
+
+        if frames:
+            index = np.concatenate([frame.index.to_numpy() for frame in frames])
+        else:
+            index = np.empty(0, dtype="datetime64[ns]")
+
+        return cls(
+            period=historical.period,
+            frequency=historical.frequency,
+            start=historical.start,
+            end=historical.end,
+            symbols=symbols,
+            offsets=offsets,
+            index=index,
+            columns=columns,
+        )
+
+    def to_historical(self) -> HistoricalOHLCV:
+        """Convert back to per-symbol DataFrames.
+
+        The DataFrames are built over views of the panel arrays; pandas may
+        still copy them when consolidating blocks.
+
+        Returns:
+            HistoricalOHLCV holding the same bars.
+        """
+        data = {}
+        for symbol in self.symbols:
+            bounds = self._bounds(symbol)
+            data[symbol] = pd.DataFrame(
+                {name: values[bounds] for name, values in self.columns.items()},
+                index=self.index[bounds],
+            )
+        return HistoricalOHLCV(
+            period=self.period,
+            frequency=self.frequency,
+            start=self.start,
+            end=self.end,
+            data=data,
+        )
+
+
+@dataclass
+class OptionChain:
+    """Columnar option chain model.
+
+    Stores one column per contract: contract symbols, expiry dates and a
+    call/put flag as parallel arrays, and every numeric field in one
+    contiguous float64 matrix of shape (len(OPTION_FIELDS), len(symbols)).
+    Missing values are NaN. filter() selects contracts with boolean masks
+    over the arrays, so narrowing a chain of tens of thousands of contracts
+    never walks per-contract objects.
+
+    Attributes:
+        underlying: Underlying symbol.
+        timestamp: Chain timestamp.
+        underlying_price: Underlying price when the chain was taken.
+        symbols: Contract symbols.
+        expiries: datetime64[D] expiry dates aligned with symbols.
+        is_call: Boolean array, True for calls and False for puts.
+        values: Field-major value matrix, one row per entry in OPTION_FIELDS.
+    """
+
+    underlying: str
+    timestamp: datetime
+    underlying_price: float
+    symbols: np.ndarray
+    expiries: np.ndarray
+    is_call: np.ndarray
+    values: np.ndarray
+
+    def __post_init__(self) -> None:
+        """Normalize array dtypes and validate their lengths."""
+        self.symbols = np.asarray(self.symbols, dtype=np.str_)
+        self.expiries = np.asarray(self.expiries, dtype="datetime64[D]")
+        self.is_call = np.asarray(self.is_call, dtype=np.bool_)
+        self.values = np.ascontiguousarray(self.values, dtype=np.float64)
+        count = len(self.symbols)
+        if len(self.expiries) != count or len(self.is_call) != count:
+            raise ValueError("OptionChain symbols, expiries and is_call lengths differ")
+        expected = (len(OPTION_FIELDS), count)
+        if self.values.shape != expected:
+            raise ValueError(f"OptionChain values shape {self.values.shape} != {expected}")
+
+    def __len__(self) -> int:
+        """Return the number of contracts in the chain."""
+        return len(self.symbols)
+
+    @property
+    def nbytes(self) -> int:
+        """Total size of the chain arrays in bytes."""
+        return (
+            self.symbols.nbytes + self.expiries.nbytes + self.is_call.nbytes + self.values.nbytes
+        )
+
+    def field_view(self, name: str) -> np.ndarray:
+        """Return a view of one field across all contracts.
+
+        Args:
+            name: Field name from OPTION_FIELDS.
+
+        Returns:
+            Contiguous float64 view of length len(symbols).
+        """
+        return self.values[OPTION_FIELDS.index(name)]
+
+    @property
+    def strike(self) -> np.ndarray:
+        """Strike prices aligned with symbols."""
+        return self.values[0]
+
+    @property
+    def bid(self) -> np.ndarray:
+        """Bid prices aligned with symbols."""
+        return self.values[1]
+
+    @property
+    def ask(self) -> np.ndarray:
+        """Ask prices aligned with symbols."""
+        return self.values[2]
+
+    @property
+    def delta(self) -> np.ndarray:
+        """Deltas aligned with symbols."""
+        return self.values[5]
+
+    @property
+    def open_interest(self) -> np.ndarray:
+        """Open interest aligned with symbols."""
+        return self.values[11]
+
+    def expirations(self) -> np.ndarray:
+        """Return the distinct expiry dates in ascending order."""
+        return np.unique(self.expiries)
+
+    def select(self, mask: np.ndarray) -> OptionChain:
+        """Return the contracts where mask is True as a new chain.
+
+        Args:
+            mask: Boolean array of length len(symbols).
+
+        Returns:
+            OptionChain holding copies of the selected columns.
+        """
+        return OptionChain(
+            underlying=self.underlying,
+            timestamp=self.timestamp,
+            underlying_price=self.underlying_price,
+            symbols=self.symbols[mask],
+            expiries=self.expiries[mask],
+            is_call=self.is_call[mask],
+            values=self.values[:, mask],
+        )
+
+    def read_only(self) -> OptionChain:
+        """Return a new chain over read-only views of this chain's arrays.
+
+        Lets a cached chain be handed out without copying it and without
+        callers being able to write into the shared arrays.
+
+        Returns:
+            OptionChain whose arrays raise ValueError on assignment.
+        """
+        views = []
+        for array in (self.symbols, self.expiries, self.is_call, self.values):
+            view = array.view()
+            view.flags.writeable = False
+            views.append(view)
+        symbols, expiries, is_call, values = views
+        return OptionChain(
+            underlying=self.underlying,
+            timestamp=self.timestamp,
+            underlying_price=self.underlying_price,
+            symbols=symbols,
+            expiries=expiries,
+            is_call=is_call,
+            values=values,
+        )
+
+    def filter(  # noqa: PLR0913
+        self,
+        expiry_from: date | None = None,
+        expiry_to: date | None = None,
+        strike_min: float | None = None,
+        strike_max: float | None = None,
+        contract_type: str | None = None,
+    ) -> OptionChain:
+        """Return the contracts within the given expiry and strike ranges.
+
+        Bounds are inclusive; None leaves that side open.
+
+        Args:
+            expiry_from: Earliest expiry date.
+            expiry_to: Latest expiry date.
+            strike_min: Lowest strike.
+            strike_max: Highest strike.
+            contract_type: "CALL" or "PUT" to keep one side; None or "ALL"
+                keeps both.
+
+        Returns:
+            Filtered OptionChain.
+        """
+        mask = np.ones(len(self), dtype=np.bool_)
+        if expiry_from is not None:
+            mask &= self.expiries >= np.datetime64(expiry_from, "D")
+        if expiry_to is not None:
+            mask &= self.expiries <= np.datetime64(expiry_to, "D")
+        if strike_min is not None:
+            mask &= self.strike >= strike_min
+        if strike_max is not None:
+            mask &= self.strike <= strike_max
+        if contract_type == "CALL":
+            mask &= self.is_call
+        elif contract_type == "PUT":
+            mask &= ~self.is_call
+        return self.select(mask)
+
+
 @dataclass
 class LimitOrder:
     """Limit order model.
@@ -316,6 +835,41 @@ class Orders:
     orders: list[LimitOrder | MarketOrder | StopOrder | StopLimitOrder]
 
 
+@dataclass
+class OrderEvent:
+    """Broker update to one order's lifecycle.
+
+    Attributes:
+        timestamp: Time of the update.
+        order_id: Order the update applies to.
+        status: New order status.
+        filled_quantity: Cumulative filled quantity (FILLED without a quantity
+            means fully filled).
+        fill_price: Price of the latest execution, if any.
+    """
+
+    timestamp: datetime
+    order_id: UUID
+    status: OrderStatus
+    filled_quantity: int | None = None
+    fill_price: float | None = None
+
+
+@dataclass
+class RiskRejection:
+    """Order rejected by the pre-trade risk check.
+
+    Attributes:
+        order: The rejected order.
+        reason: Reason code.
+        detail: Human-readable detail (limit and attempted value).
+    """
+
+    order: LimitOrder | MarketOrder | StopOrder | StopLimitOrder
+    reason: RiskRejectReason
+    detail: str
+
+
 @dataclass
 class JournalInput:
     """Journal input data for trading cycle.
@@ -330,6 +884,9 @@ class JournalInput:
         position_data: Current portfolio positions.
         open_orders: Currently open orders.
         portfolio_manager_state: Current portfolio manager state.
+        port_latency_ms: Per-port fetch latency in milliseconds keyed by fetch name.
+        order_status: Lifecycle status of each order tracked by the engine's
+            order book, keyed by order ID (empty without an order book).
     """
 
     timestamp: datetime
@@ -339,6 +896,8 @@ class JournalInput:
     position_data: Positions
     open_orders: Orders
     portfolio_manager_state: PortfolioManager
+    port_latency_ms: dict[str, float] = field(default_factory=dict)
+    order_status: dict[UUID, OrderStatus] = field(default_factory=dict)
 
 
 @dataclass
@@ -351,11 +910,13 @@ class JournalOutput:
         timestamp: Timestamp of the journal entry.
         signals: Trading signals generated by the strategy.
         orders: Orders sent to the broker.
+        rejections: Orders blocked by the pre-trade risk check.
     """
 
     timestamp: datetime
     signals: Orders
     orders: Orders
+    rejections: list[RiskRejection] = field(default_factory=list)
 
 
 @dataclass
@@ -371,3 +932,30 @@ class JournalError:
     timestamp: datetime
     error: Exception
     engine_state: EngineState
+
+
+@dataclass
+class StageLatency:
+    """Latency summary for one Engine tick stage.
+
+    Attributes:
+        stage: Stage name (e.g., "strategy", or "tick" for the whole tick).
+        count: Number of recorded samples.
+        mean_ms: Mean latency in milliseconds.
+        p50_ms: Median latency in milliseconds.
+        p90_ms: 90th percentile latency in milliseconds.
+        p99_ms: 99th percentile latency in milliseconds.
+        p999_ms: 99.9th percentile latency in milliseconds.
+        max_ms: Maximum latency in milliseconds.
+        total_ms: Sum of all samples in milliseconds.
+    """
+
+    stage: str
+    count: int
+    mean_ms: float
+    p50_ms: float
+    p90_ms: float
+    p99_ms: float
+    p999_ms: float
+    max_ms: float
+    total_ms: float
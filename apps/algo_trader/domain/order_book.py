@@ -0,0 +1,384 @@
+"""In-memory order book with lifecycle tracking.
+
+This module provides OrderBook, which follows every submitted order through
+the OrderStatus state machine (PENDING -> WORKING -> PARTIALLY_FILLED ->
+FILLED, or CANCELLED/REJECTED/EXPIRED) from incremental order events. Open
+orders are indexed by UUID, symbol and instruction, and remaining quantity is
+kept per (symbol, instruction), so duplicate-signal suppression, flatten
+sizing and order lookups are O(1) instead of scans over broker responses.
+"""
+
+from __future__ import annotations
+
+from collections import OrderedDict
+from dataclasses import dataclass
+from datetime import datetime
+from uuid import UUID
+
+from infrastructure.logging.logger import get_logger
+from system.algo_trader.domain.models import (
+    LimitOrder,
+    MarketOrder,
+    OrderEvent,
+    Orders,
+    StopLimitOrder,
+    StopOrder,
+)
+from system.algo_trader.domain.risk import RiskEngine
+from system.algo_trader.domain.states import OrderInstruction, OrderStatus
+
+Order = LimitOrder | MarketOrder | StopOrder | StopLimitOrder
+
+# Allowed transitions; statuses without an entry are terminal
+_TRANSITIONS = {
+    OrderStatus.PENDING: frozenset(
+        {
+            OrderStatus.WORKING,
+            OrderStatus.PARTIALLY_FILLED,
+            OrderStatus.FILLED,
+            OrderStatus.CANCELLED,
+            OrderStatus.REJECTED,
+            OrderStatus.EXPIRED,
+        }
+    ),
+    OrderStatus.WORKING: frozenset(
+        {
+            OrderStatus.PARTIALLY_FILLED,
+            OrderStatus.FILLED,
+            OrderStatus.CANCELLED,
+            OrderStatus.EXPIRED,
+        }
+    ),
+    OrderStatus.PARTIALLY_FILLED: frozenset(
+        {
+            OrderStatus.PARTIALLY_FILLED,
+            OrderStatus.FILLED,
+            OrderStatus.CANCELLED,
+            OrderStatus.EXPIRED,
+        }
+    ),
+}
+
+
+class OrderTransitionError(ValueError):
+    """Raised when an order event is not a valid lifecycle transition."""
+
+
+@dataclass
+class TrackedOrder:
+    """Order with its lifecycle state.
+
+    Attributes:
+        order: The submitted order.
+        status: Current lifecycle status.
+        filled_quantity: Cumulative filled quantity.
+        avg_fill_price: Volume-weighted average fill price.
+        updated: Time of the latest event.
+    """
+
+    order: Order
+    status: OrderStatus
+    filled_quantity: int = 0
+    avg_fill_price: float = 0.0
+    updated: datetime | None = None
+
+    @property
+    def remaining(self) -> int:
+        """Return the unfilled quantity."""
+        return self.order.quantity - self.filled_quantity
+
+    @property
+    def is_open(self) -> bool:
+        """Return True while the order can still fill."""
+        return self.status in _TRANSITIONS
+
+
+class OrderBook:
+    """Lifecycle-tracking order book indexed by UUID, symbol and instruction.
+
+    Terminal orders leave the open indices and are kept in a bounded history
+    for lookups. An optional RiskEngine is kept in step: submissions reserve
+    exposure, fills move it to positions, and cancels, rejects and expiries
+    release it.
+
+    Args:
+        risk_engine: Optional risk engine to notify of lifecycle changes.
+        history_size: Number of terminal orders kept for lookups.
+    """
+
+    def __init__(self, risk_engine: RiskEngine | None = None, history_size: int = 10_000):
+        """Initialize an empty book.
+
+        Args:
+            risk_engine: Optional risk engine to notify of lifecycle changes.
+            history_size: Number of terminal orders kept for lookups.
+        """
+        self.logger = get_logger(self.__class__.__name__)
+        self.risk_engine = risk_engine
+        self.history_size = history_size
+        self.suppressed = 0
+        self._open: dict[UUID, TrackedOrder] = {}
+        self._closed: OrderedDict[UUID, TrackedOrder] = OrderedDict()
+        self._by_symbol: dict[str, dict[UUID, TrackedOrder]] = {}
+        self._by_instruction: dict[OrderInstruction, dict[UUID, TrackedOrder]] = {}
+        self._open_quantity: dict[tuple[str, OrderInstruction], int] = {}
+        self._missing: set[UUID] = set()
+
+    def __len__(self) -> int:
+        """Return the number of open orders."""
+        return len(self._open)
+
+    def __contains__(self, order_id: UUID) -> bool:
+        """Return True if the order is open."""
+        return order_id in self._open
+
+    def get(self, order_id: UUID) -> TrackedOrder | None:
+        """Look up an open or recently closed order.
+
+        Args:
+            order_id: Order to look up.
+
+        Returns:
+            TrackedOrder, or None if unknown.
+        """
+        return self._open.get(order_id) or self._closed.get(order_id)
+
+    def open_orders(
+        self,
+        symbol: str | None = None,
+        instruction: OrderInstruction | None = None,
+    ) -> list[TrackedOrder]:
+        """Return open orders, optionally filtered by symbol and instruction.
+
+        Args:
+            symbol: Optional symbol filter.
+            instruction: Optional instruction filter.
+
+        Returns:
+            Matching open orders in submission order.
+        """
+        if symbol is not None:
+            matches = self._by_symbol.get(symbol, {}).values()
+            if instruction is not None:
+                return [t for t in matches if t.order.order_instruction == instruction]
+            return list(matches)
+        if instruction is not None:
+            return list(self._by_instruction.get(instruction, {}).values())
+        return list(self._open.values())
+
+    def open_quantity(self, symbol: str, instruction: OrderInstruction) -> int:
+        """Return the unfilled quantity of open orders for a symbol and instruction.
+
+        Args:
+            symbol: Symbol to look up.
+            instruction: Order instruction to look up.
+
+        Returns:
+            Remaining quantity (0 if none).
+        """
+        return self._open_quantity.get((symbol, instruction), 0)
+
+    def statuses(self) -> dict[UUID, OrderStatus]:
+        """Return the lifecycle status of each open order, keyed by order ID."""
+        return {order_id: tracked.status for order_id, tracked in self._open.items()}
+
+    def snapshot(self, timestamp: datetime) -> Orders:
+        """Return open orders as an Orders collection.
+
+        Args:
+            timestamp: Timestamp of the collection.
+
+        Returns:
+            Orders holding every open order.
+        """
+        return Orders(timestamp=timestamp, orders=[t.order for t in self._open.values()])
+
+    def _adjust_quantity(self, order: Order, delta: int) -> None:
+        """Change the open quantity for an order's symbol and instruction."""
+        key = (order.symbol, order.order_instruction)
+        quantity = self._open_quantity.get(key, 0) + delta
+        if quantity > 0:
+            self._open_quantity[key] = quantity
+        else:
+            self._open_quantity.pop(key, None)
+
+    def add(self, order: Order, timestamp: datetime | None = None) -> TrackedOrder:
+        """Start tracking a submitted order as PENDING.
+
+        Args:
+            order: Order being submitted.
+            timestamp: Submission time.
+
+        Returns:
+            The new TrackedOrder.
+
+        Raises:
+            ValueError: If the order ID is already tracked.
+        """
+        if order.id in self._open or order.id in self._closed:
+            raise ValueError(f"Order {order.id} is already tracked")
+        tracked = TrackedOrder(order=order, status=OrderStatus.PENDING, updated=timestamp)
+        self._open[order.id] = tracked
+        self._by_symbol.setdefault(order.symbol, {})[order.id] = tracked
+        self._by_instruction.setdefault(order.order_instruction, {})[order.id] = tracked
+        self._adjust_quantity(order, order.quantity)
+        if self.risk_engine is not None:
+            self.risk_engine.on_ack(order)
+        return tracked
+
+    def apply(self, event: OrderEvent) -> TrackedOrder:
+        """Apply a lifecycle event.
+
+        Repeated events with the current status and no new fill are ignored.
+
+        Args:
+            event: Order update from the broker.
+
+        Returns:
+            The updated TrackedOrder.
+
+        Raises:
+            KeyError: If the order is not open.
+            OrderTransitionError: If the transition is not allowed.
+        """
+        tracked = self._open.get(event.order_id)
+        if tracked is None:
+            raise KeyError(f"Order {event.order_id} is not open")
+        order = tracked.order
+
+        filled = event.filled_quantity
+        if filled is None:
+            filled = order.quantity if event.status == OrderStatus.FILLED else 0
+        filled = max(tracked.filled_quantity, min(filled, order.quantity))
+        new_fill = filled - tracked.filled_quantity
+        if event.status == tracked.status and not new_fill:
+            return tracked
+        if event.status not in _TRANSITIONS[tracked.status]:
+            raise OrderTransitionError(
+                f"Order {order.id}: {tracked.status.value} -> {event.status.value} not allowed"
+            )
+
+        if new_fill:
+            if event.fill_price is not None:
+                tracked.avg_fill_price = (
+                    tracked.avg_fill_price * tracked.filled_quantity + event.fill_price * new_fill
+                ) / filled
+            tracked.filled_quantity = filled
+            self._adjust_quantity(order, -new_fill)
+            if self.risk_engine is not None:
+                self.risk_engine.on_fill(order.id, new_fill, event.fill_price)
+        tracked.status = event.status
+        tracked.updated = event.timestamp
+
+        if not tracked.is_open:
+            self._close(tracked)
+        return tracked
+
+    def apply_events(self, events: list[OrderEvent]) -> int:
+        """Apply a batch of broker events, skipping those that do not apply.
+
+        Brokers report every order in their lookback window, so events for
+        orders this book never tracked or already closed are ignored, and an
+        event that is not a valid transition (e.g. a stale status) is logged
+        and skipped instead of aborting the batch.
+
+        Args:
+            events: Order updates from the broker.
+
+        Returns:
+            Number of events applied to open orders.
+        """
+        applied = 0
+        for event in events:
+            if event.order_id not in self._open:
+                continue
+            try:
+                self.apply(event)
+            except OrderTransitionError as e:
+                self.logger.debug(f"Skipping order event: {e}")
+                continue
+            applied += 1
+        return applied
+
+    def reconcile(self, open_orders: Orders, timestamp: datetime) -> list[TrackedOrder]:
+        """Close tracked orders the broker no longer reports as open.
+
+        An order is closed as CANCELLED once it is missing from two
+        consecutive snapshots, so an order the broker has not listed yet is
+        not dropped on the first miss. Fills the events did not report are
+        lost, so the risk engine should be resynced from positions.
+
+        Args:
+            open_orders: The broker's current open orders.
+            timestamp: Time of the snapshot.
+
+        Returns:
+            The orders that were closed.
+        """
+        listed = {order.id for order in open_orders.orders}
+        missing = {order_id for order_id in self._open if order_id not in listed}
+        closed = []
+        for order_id in missing & self._missing:
+            self.logger.warning(f"Order {order_id} is no longer open at the broker - closing")
+            closed.append(
+                self.apply(
+                    OrderEvent(timestamp=timestamp, order_id=order_id, status=OrderStatus.CANCELLED)
+                )
+            )
+        self._missing = missing - self._missing
+        return closed
+
+    def _close(self, tracked: TrackedOrder) -> None:
+        """Move a terminal order from the open indices to the history."""
+        order = tracked.order
+        del self._open[order.id]
+        del self._by_symbol[order.symbol][order.id]
+        if not self._by_symbol[order.symbol]:
+            del self._by_symbol[order.symbol]
+        del self._by_instruction[order.order_instruction][order.id]
+        self._adjust_quantity(order, -tracked.remaining)
+        if self.risk_engine is not None:
+            self.risk_engine.on_order_done(order.id)
+        self._closed[order.id] = tracked
+        if len(self._closed) > self.history_size:
+            self._closed.popitem(last=False)
+
+    def record_submission(
+        self, orders: Orders, accepted: Orders | None, timestamp: datetime
+    ) -> None:
+        """Track sent orders and apply the broker's synchronous response.
+
+        Args:
+            orders: Orders passed to OrderPort.send_orders.
+            accepted: Orders the port returned as accepted; None leaves the
+                orders PENDING until events arrive.
+            timestamp: Submission time.
+        """
+        accepted_ids = None if accepted is None else {o.id for o in accepted.orders}
+        for order in orders.orders:
+            self.add(order, timestamp)
+            if accepted_ids is not None:
+                status = OrderStatus.WORKING if order.id in accepted_ids else OrderStatus.REJECTED
+                self.apply(OrderEvent(timestamp=timestamp, order_id=order.id, status=status))
+
+    def suppress_duplicates(self, signals: Orders) -> Orders:
+        """Drop signals that repeat an open order's symbol and instruction.
+
+        Duplicates within the batch are dropped as well.
+
+        Args:
+            signals: Signals to check.
+
+        Returns:
+            Signals with no open or earlier counterpart.
+        """
+        seen: set[tuple[str, OrderInstruction]] = set()
+        kept = []
+        for signal in signals.orders:
+            key = (signal.symbol, signal.order_instruction)
+            if key in self._open_quantity or key in seen:
+                self.suppressed += 1
+                continue
+            seen.add(key)
+            kept.append(signal)
+        return Orders(timestamp=signals.timestamp, orders=kept)
@@ -1,6 +1,7 @@
 """Account port interface.
 
-Defines the interface for account data access implementations.
+Defines the synchronous and asyncio interfaces for account data access
+implementations.
 """
 
 from abc import ABC, abstractmethod
@@ -28,3 +29,25 @@ class AccountPort(ABC):
             Positions collection containing all open positions.
         """
         ...
+
+
+class AsyncAccountPort(ABC):
+    """Abstract asyncio port for account and position data access."""
+
+    @abstractmethod
+    async def get_account(self) -> Account:
+        """Retrieve current account information.
+
+        Returns:
+            Account object containing account details and balances.
+        """
+        ...
+
+    @abstractmethod
+    async def get_positions(self) -> Positions:
+        """Retrieve current portfolio positions.
+
+        Returns:
+            Positions collection containing all open positions.
+        """
+        ...
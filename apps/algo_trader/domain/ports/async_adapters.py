@@ -0,0 +1,283 @@
+"""Adapters exposing synchronous ports through the asyncio port interfaces.
+
+Each adapter wraps an existing synchronous port and runs its blocking calls in
+the default executor via asyncio.to_thread, so a slow broker or Redis round trip
+never blocks the event loop that handles engine commands.
+"""
+
+import asyncio
+import threading
+from collections.abc import Callable
+from typing import Any
+
+from system.algo_trader.domain.models import (
+    Account,
+    Event,
+    HistoricalOHLCV,
+    JournalError,
+    JournalInput,
+    JournalOutput,
+    OHLCVPanel,
+    OrderEvent,
+    Orders,
+    PortfolioManager,
+    Positions,
+    Quote,
+    QuoteBatch,
+    StageLatency,
+)
+from system.algo_trader.domain.ports.account_port import AccountPort, AsyncAccountPort
+from system.algo_trader.domain.ports.controller_port import AsyncControllerPort, ControllerPort
+from system.algo_trader.domain.ports.event_port import AsyncEventPort, EventPort
+from system.algo_trader.domain.ports.historical_port import AsyncHistoricalPort, HistoricalPort
+from system.algo_trader.domain.ports.journal_port import AsyncJournalPort, JournalPort
+from system.algo_trader.domain.ports.order_port import AsyncOrderPort, OrderPort
+from system.algo_trader.domain.ports.portfolio_manager_port import (
+    AsyncPortfolioManagerPort,
+    PortfolioManagerPort,
+)
+from system.algo_trader.domain.ports.quote_port import AsyncQuotePort, QuotePort
+from system.algo_trader.domain.ports.strategy_port import AsyncStrategyPort, StrategyPort
+from system.algo_trader.domain.states import ControllerCommand, EngineState
+
+
+async def _run_blocking(func: Callable[..., Any], *args: Any) -> Any:
+    """Run a blocking port call in a worker thread.
+
+    Args:
+        func: Synchronous port method to invoke.
+        *args: Positional arguments for the method.
+
+    Returns:
+        Return value of the port method.
+    """
+    return await asyncio.to_thread(func, *args)
+
+
+class AsyncHistoricalPortAdapter(AsyncHistoricalPort):
+    """Asyncio view of a synchronous HistoricalPort."""
+
+    def __init__(self, port: HistoricalPort):
+        """Wrap a synchronous historical port.
+
+        Args:
+            port: Synchronous port to delegate to.
+        """
+        self.port = port
+
+    async def get_data(self) -> HistoricalOHLCV:
+        """Retrieve historical OHLCV market data in a worker thread."""
+        return await _run_blocking(self.port.get_data)
+
+
+class AsyncQuotePortAdapter(AsyncQuotePort):
+    """Asyncio view of a synchronous QuotePort."""
+
+    def __init__(self, port: QuotePort):
+        """Wrap a synchronous quote port.
+
+        Args:
+            port: Synchronous port to delegate to.
+        """
+        self.port = port
+
+    async def get_quotes(self) -> Quote:
+        """Retrieve current market quotes in a worker thread."""
+        return await _run_blocking(self.port.get_quotes)
+
+
+class AsyncAccountPortAdapter(AsyncAccountPort):
+    """Asyncio view of a synchronous AccountPort."""
+
+    def __init__(self, port: AccountPort):
+        """Wrap a synchronous account port.
+
+        Args:
+            port: Synchronous port to delegate to.
+        """
+        self.port = port
+
+    async def get_account(self) -> Account:
+        """Retrieve current account information in a worker thread."""
+        return await _run_blocking(self.port.get_account)
+
+    async def get_positions(self) -> Positions:
+        """Retrieve current portfolio positions in a worker thread."""
+        return await _run_blocking(self.port.get_positions)
+
+
+class AsyncOrderPortAdapter(AsyncOrderPort):
+    """Asyncio view of a synchronous OrderPort.
+
+    Cancelling the awaiting task does not stop a send that a worker thread has
+    already picked up, so the worker checks the optional halt flag itself just
+    before calling the broker.
+    """
+
+    def __init__(self, port: OrderPort, halt: threading.Event | None = None):
+        """Wrap a synchronous order port.
+
+        Args:
+            port: Synchronous port to delegate to.
+            halt: Optional flag that, once set, makes sends return no accepted
+                orders without reaching the port.
+        """
+        self.port = port
+        self.halt = halt
+
+    def _send_unless_halted(self, orders: Orders) -> Orders:
+        """Send orders unless the halt flag is set (runs in the worker thread)."""
+        if self.halt is not None and self.halt.is_set():
+            return Orders(timestamp=orders.timestamp, orders=[])
+        return self.port.send_orders(orders)
+
+    async def send_orders(self, orders: Orders) -> Orders:
+        """Send orders to the broker in a worker thread."""
+        return await _run_blocking(self._send_unless_halted, orders)
+
+    async def get_open_orders(self) -> Orders:
+        """Retrieve all open orders in a worker thread."""
+        return await _run_blocking(self.port.get_open_orders)
+
+    async def cancel_order(self, order_id: str) -> bool:
+        """Cancel a specific order in a worker thread."""
+        return await _run_blocking(self.port.cancel_order, order_id)
+
+    async def cancel_all_orders(self) -> bool:
+        """Cancel all open orders in a worker thread."""
+        return await _run_blocking(self.port.cancel_all_orders)
+
+    async def get_all_orders(self) -> Orders:
+        """Retrieve all orders in a worker thread."""
+        return await _run_blocking(self.port.get_all_orders)
+
+    async def get_order_events(self) -> list[OrderEvent]:
+        """Retrieve order lifecycle updates in a worker thread."""
+        return await _run_blocking(self.port.get_order_events)
+
+
+class AsyncStrategyPortAdapter(AsyncStrategyPort):
+    """Asyncio view of a synchronous StrategyPort."""
+
+    def __init__(self, port: StrategyPort):
+        """Wrap a synchronous strategy port.
+
+        Args:
+            port: Synchronous port to delegate to.
+        """
+        self.port = port
+
+    async def get_signals(
+        self,
+        historical_data: HistoricalOHLCV | OHLCVPanel,
+        quote_data: Quote | QuoteBatch,
+        position_data: Positions,
+    ) -> Orders:
+        """Generate trading signals in a worker thread."""
+        return await _run_blocking(
+            self.port.get_signals, historical_data, quote_data, position_data
+        )
+
+
+class AsyncPortfolioManagerPortAdapter(AsyncPortfolioManagerPort):
+    """Asyncio view of a synchronous PortfolioManagerPort."""
+
+    def __init__(self, port: PortfolioManagerPort):
+        """Wrap a synchronous portfolio manager port.
+
+        Args:
+            port: Synchronous port to delegate to.
+        """
+        self.port = port
+
+    async def get_state(self) -> PortfolioManager:
+        """Retrieve current portfolio manager state in a worker thread."""
+        return await _run_blocking(self.port.get_state)
+
+    async def handle_signals(  # noqa: PLR0913
+        self,
+        signals: Orders,
+        quote_data: Quote,
+        account_data: Account,
+        position_data: Positions,
+        open_orders: Orders,
+        portfolio_state: PortfolioManager,
+    ) -> Orders:
+        """Process trading signals in a worker thread."""
+        return await _run_blocking(
+            self.port.handle_signals,
+            signals,
+            quote_data,
+            account_data,
+            position_data,
+            open_orders,
+            portfolio_state,
+        )
+
+
+class AsyncJournalPortAdapter(AsyncJournalPort):
+    """Asyncio view of a synchronous JournalPort."""
+
+    def __init__(self, port: JournalPort):
+        """Wrap a synchronous journal port.
+
+        Args:
+            port: Synchronous port to delegate to.
+        """
+        self.port = port
+
+    async def report_input(self, input: JournalInput) -> None:
+        """Log journal input data in a worker thread."""
+        await _run_blocking(self.port.report_input, input)
+
+    async def report_output(self, output: JournalOutput) -> None:
+        """Log journal output data in a worker thread."""
+        await _run_blocking(self.port.report_output, output)
+
+    async def report_error(self, error: JournalError) -> None:
+        """Log engine errors in a worker thread."""
+        await _run_blocking(self.port.report_error, error)
+
+
+class AsyncControllerPortAdapter(AsyncControllerPort):
+    """Asyncio view of a synchronous ControllerPort."""
+
+    def __init__(self, port: ControllerPort):
+        """Wrap a synchronous controller port.
+
+        Args:
+            port: Synchronous port to delegate to.
+        """
+        self.port = port
+
+    async def wait_for_command(self, timeout_s: float | None) -> ControllerCommand | None:
+        """Wait for a control command in a worker thread."""
+        return await _run_blocking(self.port.wait_for_command, timeout_s)
+
+    async def publish_status(self, status: EngineState) -> None:
+        """Publish engine status in a worker thread."""
+        await _run_blocking(self.port.publish_status, status)
+
+    async def publish_latency(self, latency: list[StageLatency]) -> None:
+        """Publish tick latency percentiles in a worker thread."""
+        await _run_blocking(self.port.publish_latency, latency)
+
+
+class AsyncEventPortAdapter(AsyncEventPort):
+    """Asyncio view of a synchronous EventPort.
+
+    A synchronous port that blocks indefinitely keeps its worker thread busy
+    until it returns, even if the awaiting task is cancelled.
+    """
+
+    def __init__(self, port: EventPort):
+        """Wrap a synchronous event port.
+
+        Args:
+            port: Synchronous port to delegate to.
+        """
+        self.port = port
+
+    async def wait_for_event(self, timeout_s: float | None) -> Event | None:
+        """Wait for an event in a worker thread."""
+        return await _run_blocking(self.port.wait_for_event, timeout_s)
@@ -1,10 +1,12 @@
 """Controller port interface.
 
-Defines the interface for engine control and status publishing.
+Defines the synchronous and asyncio interfaces for engine control, status
+publishing and tick latency reporting.
 """
 
 from abc import ABC, abstractmethod
 
+from system.algo_trader.domain.models import StageLatency
 from system.algo_trader.domain.states import ControllerCommand, EngineState
 
 
@@ -31,3 +33,48 @@ class ControllerPort(ABC):
             status: Current engine state to publish.
         """
         ...
+
+    def publish_latency(self, latency: list[StageLatency]) -> None:
+        """Publish per-stage tick latency percentiles.
+
+        Optional; the default implementation discards the report.
+
+        Args:
+            latency: Latency summary per tick stage.
+        """
+        return None
+
+
+class AsyncControllerPort(ABC):
+    """Abstract asyncio port for engine control and status management."""
+
+    @abstractmethod
+    async def wait_for_command(self, timeout_s: float | None) -> ControllerCommand | None:
+        """Wait for a control command from the controller.
+
+        Args:
+            timeout_s: Optional timeout in seconds. None means wait indefinitely.
+
+        Returns:
+            ControllerCommand if received, None if timeout or no command.
+        """
+        ...
+
+    @abstractmethod
+    async def publish_status(self, status: EngineState) -> None:
+        """Publish engine status to the controller.
+
+        Args:
+            status: Current engine state to publish.
+        """
+        ...
+
+    async def publish_latency(self, latency: list[StageLatency]) -> None:
+        """Publish per-stage tick latency percentiles.
+
+        Optional; the default implementation discards the report.
+
+        Args:
+            latency: Latency summary per tick stage.
+        """
+        return None
@@ -1,6 +1,6 @@
 """Event port interface.
 
-Defines the interface for event-driven engine control.
+Defines the synchronous and asyncio interfaces for event-driven engine control.
 """
 
 from abc import ABC, abstractmethod
@@ -22,3 +22,19 @@ class EventPort(ABC):
             Event if received, None if timeout or no event.
         """
         ...
+
+
+class AsyncEventPort(ABC):
+    """Abstract asyncio port for event-driven control flow."""
+
+    @abstractmethod
+    async def wait_for_event(self, timeout_s: float | None) -> Event | None:
+        """Wait for an event from the event source without blocking the loop.
+
+        Args:
+            timeout_s: Optional timeout in seconds. None means wait indefinitely.
+
+        Returns:
+            Event if received, None if timeout or no event.
+        """
+        ...
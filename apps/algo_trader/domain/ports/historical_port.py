@@ -1,9 +1,12 @@
 """Historical data port interface.
 
-Defines the interface for historical market data access.
+Defines the synchronous and asyncio interfaces for historical market data access.
 """
 
 from abc import ABC, abstractmethod
+from datetime import datetime
+
+import pandas as pd
 
 from system.algo_trader.domain.models import HistoricalOHLCV
 
@@ -19,3 +22,40 @@ class HistoricalPort(ABC):
             HistoricalOHLCV object containing historical price data.
         """
         ...
+
+
+class IncrementalHistoricalPort(ABC):
+    """Abstract port for per-symbol historical bar retrieval from a cutoff.
+
+    Backs caching HistoricalPort implementations that fetch the full window once
+    and only the newest bars afterwards.
+    """
+
+    @abstractmethod
+    def get_bars(self, symbol: str, frequency: str, since: datetime | None) -> pd.DataFrame:
+        """Retrieve OHLCV bars for a single symbol.
+
+        Args:
+            symbol: Trading symbol.
+            frequency: Data frequency (e.g., "1D" for daily).
+            since: Only return bars at or after this timestamp, so a bar that
+                was still forming when it was last fetched is returned again.
+                None returns the full configured window.
+
+        Returns:
+            DataFrame of OHLCV columns indexed by bar timestamp, oldest first.
+        """
+        ...
+
+
+class AsyncHistoricalPort(ABC):
+    """Abstract asyncio port for historical market data access."""
+
+    @abstractmethod
+    async def get_data(self) -> HistoricalOHLCV:
+        """Retrieve historical OHLCV market data.
+
+        Returns:
+            HistoricalOHLCV object containing historical price data.
+        """
+        ...
@@ -1,6 +1,7 @@
 """Journal port interface.
 
-Defines the interface for trading journal logging and error reporting.
+Defines the synchronous and asyncio interfaces for trading journal logging and
+error reporting.
 """
 
 from abc import ABC, abstractmethod
@@ -37,3 +38,34 @@ class JournalPort(ABC):
             error: Journal error containing error details and engine state.
         """
         ...
+
+
+class AsyncJournalPort(ABC):
+    """Abstract asyncio port for trading journal and error logging."""
+
+    @abstractmethod
+    async def report_input(self, input: JournalInput) -> None:
+        """Log journal input data.
+
+        Args:
+            input: Journal input containing market and account data.
+        """
+        ...
+
+    @abstractmethod
+    async def report_output(self, output: JournalOutput) -> None:
+        """Log journal output data.
+
+        Args:
+            output: Journal output containing signals and orders.
+        """
+        ...
+
+    @abstractmethod
+    async def report_error(self, error: JournalError) -> None:
+        """Log engine errors.
+
+        Args:
+            error: Journal error containing error details and engine state.
+        """
+        ...
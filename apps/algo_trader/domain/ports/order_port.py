@@ -1,11 +1,12 @@
 """Order port interface.
 
-Defines the interface for order management and execution.
+Defines the synchronous and asyncio interfaces for order management and execution.
 """
 
 from abc import ABC, abstractmethod
 
 from system.algo_trader.domain.models import (
+    OrderEvent,
     Orders,
 )
 
@@ -63,3 +64,80 @@ class OrderPort(ABC):
             Orders collection containing all orders.
         """
         ...
+
+    def get_order_events(self) -> list[OrderEvent]:
+        """Retrieve lifecycle updates for submitted orders.
+
+        Ports that cannot report fills and cancels return no events; the
+        engine then relies on reconciling against get_open_orders().
+
+        Returns:
+            Order events, possibly including orders the engine never sent.
+        """
+        return []
+
+
+class AsyncOrderPort(ABC):
+    """Abstract asyncio port for order management and execution."""
+
+    @abstractmethod
+    async def send_orders(self, orders: Orders) -> Orders:
+        """Send orders to the broker.
+
+        Args:
+            orders: Orders collection to send.
+
+        Returns:
+            Orders collection with updated order status.
+        """
+        ...
+
+    @abstractmethod
+    async def get_open_orders(self) -> Orders:
+        """Retrieve all open orders.
+
+        Returns:
+            Orders collection containing open orders.
+        """
+        ...
+
+    @abstractmethod
+    async def cancel_order(self, order_id: str) -> bool:
+        """Cancel a specific order.
+
+        Args:
+            order_id: ID of the order to cancel.
+
+        Returns:
+            True if cancellation was successful, False otherwise.
+        """
+        ...
+
+    @abstractmethod
+    async def cancel_all_orders(self) -> bool:
+        """Cancel all open orders.
+
+        Returns:
+            True if cancellation was successful, False otherwise.
+        """
+        ...
+
+    @abstractmethod
+    async def get_all_orders(self) -> Orders:
+        """Retrieve all orders (open, filled, cancelled, etc.).
+
+        Returns:
+            Orders collection containing all orders.
+        """
+        ...
+
+    async def get_order_events(self) -> list[OrderEvent]:
+        """Retrieve lifecycle updates for submitted orders.
+
+        Ports that cannot report fills and cancels return no events; the
+        engine then relies on reconciling against get_open_orders().
+
+        Returns:
+            Order events, possibly including orders the engine never sent.
+        """
+        return []
@@ -1,6 +1,7 @@
 """Portfolio manager port interface.
 
-Defines the interface for portfolio state management and signal processing.
+Defines the synchronous and asyncio interfaces for portfolio state management and
+signal processing.
 """
 
 from abc import ABC, abstractmethod
@@ -44,3 +45,41 @@ class PortfolioManagerPort(ABC):
             Orders collection containing generated orders.
         """
         ...
+
+
+class AsyncPortfolioManagerPort(ABC):
+    """Abstract asyncio port for portfolio management and signal handling."""
+
+    @abstractmethod
+    async def get_state(self) -> PortfolioManager:
+        """Retrieve current portfolio manager state.
+
+        Returns:
+            PortfolioManager object containing current trading state and limits.
+        """
+        ...
+
+    @abstractmethod
+    async def handle_signals(  # noqa: PLR0913
+        self,
+        signals: Orders,
+        quote_data: Quote,
+        account_data: Account,
+        position_data: Positions,
+        open_orders: Orders,
+        portfolio_state: PortfolioManager,
+    ) -> Orders:
+        """Process trading signals and generate orders.
+
+        Args:
+            signals: Filtered trading signals to process.
+            quote_data: Current market quotes.
+            account_data: Current account information.
+            position_data: Current portfolio positions.
+            open_orders: Currently open orders.
+            portfolio_state: Current portfolio manager state.
+
+        Returns:
+            Orders collection containing generated orders.
+        """
+        ...
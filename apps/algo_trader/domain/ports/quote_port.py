@@ -1,6 +1,6 @@
 """Quote port interface.
 
-Defines the interface for real-time market quote access.
+Defines the synchronous and asyncio interfaces for real-time market quote access.
 """
 
 from abc import ABC, abstractmethod
@@ -19,3 +19,16 @@ class QuotePort(ABC):
             Quote object containing current bid/ask and market data.
         """
         ...
+
+
+class AsyncQuotePort(ABC):
+    """Abstract asyncio port for real-time market quote access."""
+
+    @abstractmethod
+    async def get_quotes(self) -> Quote:
+        """Retrieve current market quotes.
+
+        Returns:
+            Quote object containing current bid/ask and market data.
+        """
+        ...
@@ -1,11 +1,19 @@
 """Strategy port interface.
 
-Defines the interface for strategy implementations that generate trading signals.
+Defines the synchronous and asyncio interfaces for strategy implementations that
+generate trading signals.
 """
 
 from abc import ABC, abstractmethod
 
-from system.algo_trader.domain.models import HistoricalOHLCV, Orders, Positions, Quote
+from system.algo_trader.domain.models import (
+    HistoricalOHLCV,
+    OHLCVPanel,
+    Orders,
+    Positions,
+    Quote,
+    QuoteBatch,
+)
 
 
 class StrategyPort(ABC):
@@ -14,15 +22,38 @@ class StrategyPort(ABC):
     @abstractmethod
     def get_signals(
         self,
-        historical_data: HistoricalOHLCV,
-        quote_data: Quote,
+        historical_data: HistoricalOHLCV | OHLCVPanel,
+        quote_data: Quote | QuoteBatch,
         position_data: Positions,
     ) -> Orders:
         """Generate trading signals based on market data.
 
         Args:
-            historical_data: Historical OHLCV market data.
-            quote_data: Current market quotes.
+            historical_data: Historical OHLCV market data, per-symbol or columnar.
+            quote_data: Current market quotes, per-field maps or columnar.
+            position_data: Current portfolio positions.
+
+        Returns:
+            Orders collection containing generated trading signals.
+        """
+        ...
+
+
+class AsyncStrategyPort(ABC):
+    """Abstract asyncio port for strategy signal generation."""
+
+    @abstractmethod
+    async def get_signals(
+        self,
+        historical_data: HistoricalOHLCV | OHLCVPanel,
+        quote_data: Quote | QuoteBatch,
+        position_data: Positions,
+    ) -> Orders:
+        """Generate trading signals based on market data.
+
+        Args:
+            historical_data: Historical OHLCV market data, per-symbol or columnar.
+            quote_data: Current market quotes, per-field maps or columnar.
             position_data: Current portfolio positions.
 
         Returns:
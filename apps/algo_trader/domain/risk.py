@@ -0,0 +1,319 @@
+"""Pre-trade risk engine with incremental exposure tracking.
+
+This module provides RiskEngine, the Engine stage that checks orders from the
+portfolio manager against PortfolioManager.max_position_pct and
+max_exposure_pct (of account net liquidation) before they are sent. Exposure
+per symbol and for the whole portfolio is kept as running totals updated from
+order reservations, acknowledgements, fills and cancels, so each check is a
+handful of dict operations regardless of how many orders are open.
+"""
+
+from __future__ import annotations
+
+import math
+from dataclasses import dataclass
+from uuid import UUID
+
+from infrastructure.logging.logger import get_logger
+from system.algo_trader.domain.models import (
+    Account,
+    LimitOrder,
+    MarketOrder,
+    Orders,
+    PortfolioManager,
+    Positions,
+    Quote,
+    QuoteBatch,
+    RiskRejection,
+    StopLimitOrder,
+    StopOrder,
+)
+from system.algo_trader.domain.states import OrderInstruction, RiskRejectReason
+
+Order = LimitOrder | MarketOrder | StopOrder | StopLimitOrder
+
+_BUYS = (OrderInstruction.BUY_TO_OPEN, OrderInstruction.BUY_TO_CLOSE)
+
+
+@dataclass
+class _WorkingOrder:
+    """Unfilled remainder of an order counted against exposure."""
+
+    symbol: str
+    side: int
+    remaining: int
+
+
+def _order_price(order: Order) -> float | None:
+    """Return the price an order names, if any."""
+    if isinstance(order, StopLimitOrder):
+        return order.limit_price
+    return getattr(order, "price", None)
+
+
+class RiskEngine:
+    """Incremental pre-trade risk checks.
+
+    Symbol exposure is the worst case over working orders: with position p,
+    working buys B and working sells S it is max(|p + B|, |p - S|) times the
+    mark price. Portfolio exposure is the sum over symbols. An order is
+    rejected only if it would raise exposure above a limit, so orders that
+    reduce risk always pass. Accepted orders are reserved immediately; the
+    order path reports fills and cancels so the totals track the broker
+    without rescanning positions or open orders. sync() rebuilds everything
+    from a full snapshot (at startup or to reconcile drift).
+
+    Args:
+        max_open_orders: Optional cap on working orders.
+        max_order_notional: Optional cap on a single order's notional value.
+    """
+
+    def __init__(
+        self,
+        max_open_orders: int | None = None,
+        max_order_notional: float | None = None,
+    ):
+        """Initialize empty exposure state.
+
+        Args:
+            max_open_orders: Optional cap on working orders.
+            max_order_notional: Optional cap on a single order's notional value.
+        """
+        self.logger = get_logger(self.__class__.__name__)
+        self.max_open_orders = max_open_orders
+        self.max_order_notional = max_order_notional
+        self.equity = 0.0
+        self.gross_exposure = 0.0
+        self.synced = False
+        self.rejected: dict[RiskRejectReason, int] = dict.fromkeys(RiskRejectReason, 0)
+        self._positions: dict[str, int] = {}
+        self._buys: dict[str, int] = {}
+        self._sells: dict[str, int] = {}
+        self._prices: dict[str, float] = {}
+        self._exposure: dict[str, float] = {}
+        self._working: dict[UUID, _WorkingOrder] = {}
+
+    @property
+    def open_orders(self) -> int:
+        """Return the number of working orders."""
+        return len(self._working)
+
+    def exposure(self, symbol: str | None = None) -> float:
+        """Return worst-case exposure for a symbol, or the portfolio total.
+
+        Args:
+            symbol: Symbol to report; None for the whole portfolio.
+
+        Returns:
+            Exposure in account currency.
+        """
+        if symbol is None:
+            return self.gross_exposure
+        return self._exposure.get(symbol, 0.0)
+
+    def _worst_case(self, symbol: str, position: int, buys: int, sells: int) -> float:
+        """Return worst-case exposure for hypothetical symbol totals."""
+        return max(abs(position + buys), abs(position - sells)) * self._prices.get(symbol, 0.0)
+
+    def _refresh(self, symbol: str) -> None:
+        """Recompute one symbol's exposure and adjust the portfolio total."""
+        exposure = self._worst_case(
+            symbol,
+            self._positions.get(symbol, 0),
+            self._buys.get(symbol, 0),
+            self._sells.get(symbol, 0),
+        )
+        self.gross_exposure += exposure - self._exposure.get(symbol, 0.0)
+        self._exposure[symbol] = exposure
+
+    def _reserve(self, order_id: UUID, symbol: str, side: int, quantity: int) -> None:
+        """Count an order's quantity as working."""
+        self._working[order_id] = _WorkingOrder(symbol, side, quantity)
+        book = self._buys if side > 0 else self._sells
+        book[symbol] = book.get(symbol, 0) + quantity
+        self._refresh(symbol)
+
+    def _release(self, working: _WorkingOrder, quantity: int) -> None:
+        """Remove quantity from a working order's side totals."""
+        book = self._buys if working.side > 0 else self._sells
+        book[working.symbol] = book.get(working.symbol, 0) - quantity
+        working.remaining -= quantity
+
+    def sync(self, positions: Positions, open_orders: Orders) -> None:
+        """Rebuild all totals from a full positions and open-orders snapshot.
+
+        Args:
+            positions: Current positions.
+            open_orders: Currently working orders.
+        """
+        self._positions = {}
+        self._buys, self._sells, self._working = {}, {}, {}
+        for position in positions.positions:
+            self._positions[position.symbol] = (
+                self._positions.get(position.symbol, 0) + position.quantity
+            )
+            if position.current_price > 0:
+                self._prices.setdefault(position.symbol, position.current_price)
+        for order in open_orders.orders:
+            side = 1 if order.order_instruction in _BUYS else -1
+            self._working[order.id] = _WorkingOrder(order.symbol, side, order.quantity)
+            book = self._buys if side > 0 else self._sells
+            book[order.symbol] = book.get(order.symbol, 0) + order.quantity
+        self._exposure, self.gross_exposure = {}, 0.0
+        for symbol in {*self._positions, *self._buys, *self._sells}:
+            self._refresh(symbol)
+        self.synced = True
+
+    def update_account(self, account: Account) -> None:
+        """Set the equity that percentage limits apply to.
+
+        Args:
+            account: Current account data; net_liquidation is used.
+        """
+        self.equity = account.net_liquidation
+
+    def mark_prices(self, quote: Quote | QuoteBatch) -> None:
+        """Update mark prices from last trade prices.
+
+        Costs one refresh per quoted symbol, independent of open orders.
+
+        Args:
+            quote: Current quotes.
+        """
+        if isinstance(quote, QuoteBatch):
+            items = zip(quote.symbols, quote.last.tolist(), strict=True)
+        else:
+            items = quote.last.items()
+        prices = self._prices
+        for symbol, price in items:
+            if price is None or math.isnan(price) or price <= 0 or prices.get(symbol) == price:
+                continue
+            prices[symbol] = price
+            self._refresh(symbol)
+
+    def on_ack(self, order: Order) -> None:
+        """Record a broker acknowledgement.
+
+        Orders accepted by check() are already reserved; orders sent around
+        the risk check (e.g., flatten orders) are reserved here.
+
+        Args:
+            order: Acknowledged order.
+        """
+        if order.id not in self._working and order.quantity > 0:
+            side = 1 if order.order_instruction in _BUYS else -1
+            self._reserve(order.id, order.symbol, side, order.quantity)
+
+    def on_fill(self, order_id: UUID, quantity: int, price: float | None = None) -> None:
+        """Move filled quantity from working to position.
+
+        Args:
+            order_id: Filled order.
+            quantity: Quantity filled by this execution.
+            price: Optional execution price, used as the new mark.
+        """
+        working = self._working.get(order_id)
+        if working is None:
+            self.logger.debug(f"Fill for untracked order {order_id}")
+            return
+        filled = min(quantity, working.remaining)
+        self._release(working, filled)
+        symbol = working.symbol
+        self._positions[symbol] = self._positions.get(symbol, 0) + working.side * filled
+        if price is not None and price > 0:
+            self._prices[symbol] = price
+        if working.remaining <= 0:
+            del self._working[order_id]
+        self._refresh(symbol)
+
+    def on_order_done(self, order_id: UUID) -> None:
+        """Release an order's unfilled remainder (cancelled, rejected or expired).
+
+        Args:
+            order_id: Order that stopped working.
+        """
+        working = self._working.pop(order_id, None)
+        if working is not None:
+            self._release(working, working.remaining)
+            self._refresh(working.symbol)
+
+    def check(
+        self, orders: Orders, portfolio_state: PortfolioManager
+    ) -> tuple[Orders, list[RiskRejection]]:
+        """Check orders against the limits and reserve the accepted ones.
+
+        Args:
+            orders: Orders produced by the portfolio manager.
+            portfolio_state: Limits as percentages of equity.
+
+        Returns:
+            Tuple of (accepted orders, rejections with reason codes).
+        """
+        position_limit = portfolio_state.max_position_pct / 100.0 * self.equity
+        exposure_limit = portfolio_state.max_exposure_pct / 100.0 * self.equity
+        accepted, rejections = [], []
+        for order in orders.orders:
+            rejection = self._check_order(order, position_limit, exposure_limit)
+            if rejection is None:
+                accepted.append(order)
+            else:
+                self.rejected[rejection.reason] += 1
+                rejections.append(rejection)
+        return Orders(timestamp=orders.timestamp, orders=accepted), rejections
+
+    def _check_order(  # noqa: PLR0911
+        self, order: Order, position_limit: float, exposure_limit: float
+    ) -> RiskRejection | None:
+        """Check one order; reserve it and return None if it passes."""
+        symbol, quantity = order.symbol, order.quantity
+        if quantity <= 0:
+            return RiskRejection(order, RiskRejectReason.INVALID_QUANTITY, f"quantity {quantity}")
+        if order.id in self._working:
+            return RiskRejection(order, RiskRejectReason.DUPLICATE_ORDER, f"order {order.id}")
+
+        price = self._prices.get(symbol)
+        if price is None:
+            price = _order_price(order)
+            if price is None or price <= 0:
+                return RiskRejection(order, RiskRejectReason.NO_PRICE, f"no price for {symbol}")
+            self._prices[symbol] = price
+            self._refresh(symbol)
+
+        notional = quantity * price
+        if self.max_order_notional is not None and notional > self.max_order_notional:
+            return RiskRejection(
+                order,
+                RiskRejectReason.MAX_ORDER_NOTIONAL,
+                f"notional {notional:.2f} > {self.max_order_notional:.2f}",
+            )
+        if self.max_open_orders is not None and len(self._working) >= self.max_open_orders:
+            return RiskRejection(
+                order, RiskRejectReason.MAX_OPEN_ORDERS, f"{len(self._working)} working orders"
+            )
+
+        side = 1 if order.order_instruction in _BUYS else -1
+        buys, sells = self._buys.get(symbol, 0), self._sells.get(symbol, 0)
+        current = self._exposure.get(symbol, 0.0)
+        projected = self._worst_case(
+            symbol,
+            self._positions.get(symbol, 0),
+            buys + quantity if side > 0 else buys,
+            sells + quantity if side < 0 else sells,
+        )
+        if projected > current:
+            if projected > position_limit:
+                return RiskRejection(
+                    order,
+                    RiskRejectReason.MAX_POSITION,
+                    f"{symbol} exposure {projected:.2f} > {position_limit:.2f}",
+                )
+            total = self.gross_exposure - current + projected
+            if total > exposure_limit:
+                return RiskRejection(
+                    order,
+                    RiskRejectReason.MAX_EXPOSURE,
+                    f"portfolio exposure {total:.2f} > {exposure_limit:.2f}",
+                )
+
+        self._reserve(order.id, symbol, side, quantity)
+        return None
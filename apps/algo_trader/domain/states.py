@@ -88,6 +88,7 @@ class OrderInstruction(Enum):
 class OrderStatus(Enum):
     """Order execution status."""
 
+    PENDING = "PENDING"
     WORKING = "WORKING"
     FILLED = "FILLED"
     PARTIALLY_FILLED = "PARTIALLY_FILLED"
@@ -96,6 +97,18 @@ class OrderStatus(Enum):
     EXPIRED = "EXPIRED"
 
 
+class RiskRejectReason(Enum):
+    """Reasons the pre-trade risk check rejects an order."""
+
+    INVALID_QUANTITY = "INVALID_QUANTITY"
+    NO_PRICE = "NO_PRICE"
+    MAX_ORDER_NOTIONAL = "MAX_ORDER_NOTIONAL"
+    MAX_OPEN_ORDERS = "MAX_OPEN_ORDERS"
+    MAX_POSITION = "MAX_POSITION"
+    MAX_EXPOSURE = "MAX_EXPOSURE"
+    DUPLICATE_ORDER = "DUPLICATE_ORDER"
+
+
 class OrderDuration(Enum):
     """Order duration/time in force."""
 
@@ -0,0 +1,216 @@
+"""Dense in-memory bar store for backtests.
+
+This module provides BarStore, which loads stored OHLCV history from Parquet,
+SQLite or DataFrames and aligns every symbol onto one shared timeline. Each
+field is held as a time-major float64 matrix of shape (bars, symbols), so a
+backtest tick reads one contiguous row per field instead of slicing DataFrames.
+"""
+
+from __future__ import annotations
+
+from datetime import datetime
+
+import numpy as np
+import pandas as pd
+
+from infrastructure.sqlite.sqlite import BaseSQLiteClient
+from system.algo_trader.domain.models import OHLCV_FIELDS
+
+
+def _utc_index(index: pd.Index) -> pd.DatetimeIndex:
+    """Return index as a UTC DatetimeIndex, localizing naive timestamps."""
+    index = pd.DatetimeIndex(index)
+    return index.tz_localize("UTC") if index.tz is None else index.tz_convert("UTC")
+
+
+class BarStore:
+    """Time-aligned OHLCV history for a fixed symbol universe.
+
+    Symbols missing a bar at a timeline step hold NaN in every field for that
+    step. Timestamps are precomputed as datetimes so simulated clocks never
+    convert on the hot path.
+
+    Args:
+        symbols: Symbol universe; column j of each matrix belongs to symbols[j].
+        index: Sorted UTC bar timestamps shared by every symbol.
+        fields: Mapping of OHLCV field name to a (len(index), len(symbols)) matrix.
+        frequency: Bar frequency label (e.g., "1D").
+    """
+
+    def __init__(
+        self,
+        symbols: list[str],
+        index: pd.DatetimeIndex,
+        fields: dict[str, np.ndarray],
+        frequency: str = "1D",
+    ):
+        """Initialize the store from aligned field matrices.
+
+        Args:
+            symbols: Symbol universe; column j of each matrix belongs to symbols[j].
+            index: Sorted UTC bar timestamps shared by every symbol.
+            fields: Mapping of OHLCV field name to a (len(index), len(symbols)) matrix.
+            frequency: Bar frequency label (e.g., "1D").
+        """
+        self.symbols = tuple(symbols)
+        self.index = _utc_index(index)
+        self.frequency = frequency
+
+        shape = (len(self.index), len(self.symbols))
+        self.fields: dict[str, np.ndarray] = {}
+        for name in OHLCV_FIELDS:
+            values = fields.get(name)
+            if values is None:
+                values = np.full(shape, np.nan, dtype=np.float64)
+            values = np.ascontiguousarray(values, dtype=np.float64)
+            if values.shape != shape:
+                raise ValueError(f"BarStore field '{name}' shape {values.shape} != {shape}")
+            self.fields[name] = values
+
+        self.open = self.fields["open"]
+        self.high = self.fields["high"]
+        self.low = self.fields["low"]
+        self.close = self.fields["close"]
+        self.volume = self.fields["volume"]
+
+        self.timestamps = self.index.tz_localize(None).to_numpy(dtype="datetime64[ns]")
+        self.dates = self.timestamps.astype("datetime64[D]")
+        self.datetimes: list[datetime] = list(self.index.to_pydatetime())
+        self._positions = {symbol: j for j, symbol in enumerate(self.symbols)}
+
+    def __len__(self) -> int:
+        """Return the number of timeline steps."""
+        return len(self.index)
+
+    def __contains__(self, symbol: str) -> bool:
+        """Return True if the symbol is in the store."""
+        return symbol in self._positions
+
+    def position(self, symbol: str) -> int:
+        """Return the column of a symbol.
+
+        Raises:
+            KeyError: If the symbol is not in the store.
+        """
+        return self._positions[symbol]
+
+    @classmethod
+    def from_frames(cls, frames: dict[str, pd.DataFrame], frequency: str = "1D") -> BarStore:
+        """Build a store from per-symbol DataFrames indexed by timestamp.
+
+        The timeline is the union of every frame's index; naive timestamps are
+        treated as UTC.
+
+        Args:
+            frames: Mapping of symbol to OHLCV DataFrame.
+            frequency: Bar frequency label.
+
+        Returns:
+            BarStore aligned on the union timeline.
+        """
+        symbols = list(frames)
+        index = pd.DatetimeIndex([], tz="UTC")
+        for frame in frames.values():
+            index = index.union(_utc_index(frame.index))
+
+        fields = {
+            name: np.full((len(index), len(symbols)), np.nan, dtype=np.float64)
+            for name in OHLCV_FIELDS
+        }
+        for j, symbol in enumerate(symbols):
+            frame = frames[symbol]
+            aligned = frame.set_axis(_utc_index(frame.index), axis=0)
+            aligned = aligned[~aligned.index.duplicated(keep="last")].reindex(index)
+            for name in OHLCV_FIELDS:
+                if name in aligned.columns:
+                    fields[name][:, j] = aligned[name].to_numpy(dtype=np.float64, na_value=np.nan)
+
+        return cls(symbols, index, fields, frequency=frequency)
+
+    @classmethod
+    def from_long_frame(
+        cls,
+        frame: pd.DataFrame,
+        symbols: list[str] | None = None,
+        frequency: str = "1D",
+    ) -> BarStore:
+        """Build a store from long-format rows (symbol, timestamp, OHLCV columns).
+
+        Numeric timestamps are interpreted as epoch milliseconds.
+
+        Args:
+            frame: DataFrame with "symbol" and "timestamp" columns.
+            symbols: Optional symbol subset and column order.
+            frequency: Bar frequency label.
+
+        Returns:
+            BarStore aligned on the union timeline.
+        """
+        timestamps = frame["timestamp"]
+        if pd.api.types.is_numeric_dtype(timestamps):
+            timestamps = pd.to_datetime(timestamps, unit="ms", utc=True)
+        else:
+            timestamps = pd.to_datetime(timestamps, utc=True)
+        frame = frame.assign(timestamp=timestamps)
+
+        groups = {
+            symbol: group.set_index("timestamp").sort_index()
+            for symbol, group in frame.groupby("symbol", sort=False)
+        }
+        if symbols is not None:
+            groups = {
+                symbol: groups.get(symbol, pd.DataFrame(index=pd.DatetimeIndex([], tz="UTC")))
+                for symbol in symbols
+            }
+        return cls.from_frames(groups, frequency=frequency)
+
+    @classmethod
+    def from_parquet(
+        cls,
+        path: str,
+        symbols: list[str] | None = None,
+        frequency: str = "1D",
+    ) -> BarStore:
+        """Load a long-format Parquet file of bars.
+
+        Args:
+            path: Parquet file or dataset directory.
+            symbols: Optional symbol subset; pushed down as a row filter.
+            frequency: Bar frequency label.
+
+        Returns:
+            BarStore holding the stored bars.
+        """
+        filters = [("symbol", "in", list(symbols))] if symbols else None
+        frame = pd.read_parquet(
+            path, columns=["symbol", "timestamp", *OHLCV_FIELDS], filters=filters
+        )
+        return cls.from_long_frame(frame, symbols=symbols, frequency=frequency)
+
+    @classmethod
+    def from_sqlite(
+        cls,
+        client: BaseSQLiteClient,
+        table: str = "bars",
+        symbols: list[str] | None = None,
+        frequency: str = "1D",
+    ) -> BarStore:
+        """Load bars from a SQLite table with symbol, timestamp and OHLCV columns.
+
+        Args:
+            client: Connected SQLite client.
+            table: Table name.
+            symbols: Optional symbol subset.
+            frequency: Bar frequency label.
+
+        Returns:
+            BarStore holding the stored bars.
+        """
+        query = f"SELECT symbol, timestamp, {', '.join(OHLCV_FIELDS)} FROM {table}"
+        params = None
+        if symbols:
+            query += f" WHERE symbol IN ({', '.join('?' for _ in symbols)})"
+            params = tuple(symbols)
+        rows = client.fetchall(query + " ORDER BY timestamp", params)
+        frame = pd.DataFrame(rows, columns=["symbol", "timestamp", *OHLCV_FIELDS])
+        return cls.from_long_frame(frame, symbols=symbols, frequency=frequency)
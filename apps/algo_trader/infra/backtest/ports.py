@@ -0,0 +1,434 @@
+"""Simulated ports that replay a BarStore through the Engine.
+
+This module provides the clock, ID factory and port adapters that let the
+unmodified Engine, StrategyPort and PortfolioManagerPort stack run over stored
+history. Data ports read the bar at the clock's current step; account and order
+ports delegate to a SimulatedBroker; the event port drives the simulation one
+bar per TICK.
+"""
+
+from __future__ import annotations
+
+import itertools
+from collections.abc import Callable
+from datetime import datetime, timezone
+from uuid import UUID
+
+import numpy as np
+import pandas as pd
+
+from system.algo_trader.domain.models import (
+    OHLCV_FIELDS,
+    QUOTE_FIELDS,
+    Account,
+    Event,
+    HistoricalOHLCV,
+    JournalError,
+    JournalInput,
+    JournalOutput,
+    OHLCVPanel,
+    Orders,
+    PortfolioManager,
+    Positions,
+    Quote,
+    QuoteBatch,
+)
+from system.algo_trader.domain.ports.account_port import AccountPort
+from system.algo_trader.domain.ports.controller_port import ControllerPort
+from system.algo_trader.domain.ports.event_port import EventPort
+from system.algo_trader.domain.ports.historical_port import HistoricalPort
+from system.algo_trader.domain.ports.journal_port import JournalPort
+from system.algo_trader.domain.ports.order_port import OrderPort
+from system.algo_trader.domain.ports.portfolio_manager_port import PortfolioManagerPort
+from system.algo_trader.domain.ports.quote_port import QuotePort
+from system.algo_trader.domain.states import (
+    ControllerCommand,
+    EngineState,
+    EventType,
+    TickReason,
+    TradingState,
+)
+from system.algo_trader.infra.backtest.bar_store import BarStore
+from system.algo_trader.infra.backtest.simulated_broker import SimulatedBroker
+
+_BID = QUOTE_FIELDS.index("bid")
+_ASK = QUOTE_FIELDS.index("ask")
+_LAST = QUOTE_FIELDS.index("last")
+_VOLUME = QUOTE_FIELDS.index("volume")
+_CHANGE = QUOTE_FIELDS.index("change")
+_CHANGE_PCT = QUOTE_FIELDS.index("change_pct")
+
+
+class SimulationClock:
+    """Clock that reports the timestamp of the current backtest bar.
+
+    Args:
+        store: Bar history whose timeline the clock walks.
+    """
+
+    def __init__(self, store: BarStore):
+        """Initialize the clock before the first bar.
+
+        Args:
+            store: Bar history whose timeline the clock walks.
+        """
+        self._datetimes = store.datetimes
+        self.index = -1
+
+    def advance(self) -> int:
+        """Step to the next bar and return its timeline index."""
+        self.index += 1
+        return self.index
+
+    def now(self) -> datetime:
+        """Return the current bar timestamp (the first bar before the run)."""
+        return self._datetimes[max(self.index, 0)]
+
+
+def sequential_ids(start: int = 1) -> Callable[[], UUID]:
+    """Return a factory producing deterministic, increasing UUIDs.
+
+    Args:
+        start: Integer value of the first UUID.
+
+    Returns:
+        Callable suitable for Engine(id_factory=...).
+    """
+    counter = itertools.count(start)
+    return lambda: UUID(int=next(counter))
+
+
+class BacktestHistoricalPort(HistoricalPort):
+    """HistoricalPort returning the trailing window up to the current bar.
+
+    Full-history frames (or symbol-major field arrays in columnar mode) are
+    built once on the first call; each tick then only slices its window out
+    of them instead of rebuilding a DataFrame per symbol.
+
+    Args:
+        store: Bar history to replay.
+        clock: Simulation clock selecting the current bar.
+        lookback: Bars per window, including the current bar.
+        period: Period label reported on each window.
+        columnar: Return OHLCVPanel windows instead of per-symbol DataFrames.
+    """
+
+    def __init__(
+        self,
+        store: BarStore,
+        clock: SimulationClock,
+        lookback: int = 252,
+        period: str = "1Y",
+        columnar: bool = False,
+    ):
+        """Initialize the port.
+
+        Args:
+            store: Bar history to replay.
+            clock: Simulation clock selecting the current bar.
+            lookback: Bars per window, including the current bar.
+            period: Period label reported on each window.
+            columnar: Return OHLCVPanel windows instead of per-symbol DataFrames.
+        """
+        self.store = store
+        self.clock = clock
+        self.lookback = lookback
+        self.period = period
+        self.columnar = columnar
+        self._frames: dict[str, pd.DataFrame] | None = None
+        self._symbol_major: dict[str, np.ndarray] | None = None
+
+    def _full_frames(self) -> dict[str, pd.DataFrame]:
+        """Return one full-history DataFrame per symbol, built on first use."""
+        if self._frames is None:
+            store = self.store
+            self._frames = {
+                symbol: pd.DataFrame(
+                    {name: store.fields[name][:, j] for name in OHLCV_FIELDS}, index=store.index
+                )
+                for j, symbol in enumerate(store.symbols)
+            }
+        return self._frames
+
+    def _full_columns(self) -> dict[str, np.ndarray]:
+        """Return read-only (symbols, bars) copies of each field, built on first use.
+
+        Symbol-major rows make each window a contiguous slice per symbol, and
+        a single-symbol window a zero-copy view.
+        """
+        if self._symbol_major is None:
+            self._symbol_major = {}
+            for name in OHLCV_FIELDS:
+                column = np.ascontiguousarray(self.store.fields[name].T)
+                column.flags.writeable = False
+                self._symbol_major[name] = column
+        return self._symbol_major
+
+    def get_data(self) -> HistoricalOHLCV | OHLCVPanel:
+        """Return the window ending at the current bar."""
+        store = self.store
+        hi = max(self.clock.index, 0) + 1
+        lo = max(hi - self.lookback, 0)
+        start, end = store.datetimes[lo], store.datetimes[hi - 1]
+
+        if self.columnar:
+            n_symbols, rows = len(store.symbols), hi - lo
+            return OHLCVPanel(
+                period=self.period,
+                frequency=store.frequency,
+                start=start,
+                end=end,
+                symbols=store.symbols,
+                offsets=np.arange(n_symbols + 1, dtype=np.int64) * rows,
+                index=np.tile(store.timestamps[lo:hi], n_symbols),
+                columns={
+                    name: column[:, lo:hi].ravel()
+                    for name, column in self._full_columns().items()
+                },
+            )
+
+        return HistoricalOHLCV(
+            period=self.period,
+            frequency=store.frequency,
+            start=start,
+            end=end,
+            data={symbol: frame.iloc[lo:hi] for symbol, frame in self._full_frames().items()},
+        )
+
+
+class BacktestQuotePort(QuotePort):
+    """QuotePort synthesizing quotes from the current bar's close.
+
+    Bid, ask and last are the close; sizes are unknown (NaN); change is measured
+    against the previous bar's close.
+
+    Args:
+        store: Bar history to replay.
+        clock: Simulation clock selecting the current bar.
+        columnar: Return QuoteBatch instead of dict-per-field Quote.
+        asset_class: Asset class reported on each quote.
+    """
+
+    def __init__(
+        self,
+        store: BarStore,
+        clock: SimulationClock,
+        columnar: bool = False,
+        asset_class: str = "EQUITY",
+    ):
+        """Initialize the port.
+
+        Args:
+            store: Bar history to replay.
+            clock: Simulation clock selecting the current bar.
+            columnar: Return QuoteBatch instead of dict-per-field Quote.
+            asset_class: Asset class reported on each quote.
+        """
+        self.store = store
+        self.clock = clock
+        self.columnar = columnar
+        self.asset_class = asset_class
+
+    def get_quotes(self) -> Quote | QuoteBatch:
+        """Return quotes for the current bar."""
+        store = self.store
+        i = max(self.clock.index, 0)
+        close = store.close[i]
+        previous = store.close[i - 1] if i > 0 else close
+
+        values = np.full((len(QUOTE_FIELDS), len(store.symbols)), np.nan, dtype=np.float64)
+        values[_BID] = close
+        values[_ASK] = close
+        values[_LAST] = close
+        values[_VOLUME] = store.volume[i]
+        np.subtract(close, previous, out=values[_CHANGE])
+        with np.errstate(divide="ignore", invalid="ignore"):
+            np.divide(values[_CHANGE] * 100.0, previous, out=values[_CHANGE_PCT])
+
+        batch = QuoteBatch(
+            timestamp=store.datetimes[i],
+            asset_class=self.asset_class,
+            symbols=store.symbols,
+            values=values,
+        )
+        return batch if self.columnar else batch.to_quote()
+
+
+class BacktestAccountPort(AccountPort):
+    """AccountPort backed by a SimulatedBroker."""
+
+    def __init__(self, broker: SimulatedBroker):
+        """Initialize the port.
+
+        Args:
+            broker: Simulated broker holding the account.
+        """
+        self.broker = broker
+
+    def get_account(self) -> Account:
+        """Return the simulated account snapshot."""
+        return self.broker.account()
+
+    def get_positions(self) -> Positions:
+        """Return simulated positions."""
+        return self.broker.positions()
+
+
+class BacktestOrderPort(OrderPort):
+    """OrderPort backed by a SimulatedBroker."""
+
+    def __init__(self, broker: SimulatedBroker):
+        """Initialize the port.
+
+        Args:
+            broker: Simulated broker matching the orders.
+        """
+        self.broker = broker
+
+    def send_orders(self, orders: Orders) -> Orders:
+        """Submit orders to the simulator."""
+        return self.broker.submit(orders)
+
+    def get_open_orders(self) -> Orders:
+        """Return working simulated orders."""
+        return self.broker.open_orders()
+
+    def cancel_order(self, order_id: str) -> bool:
+        """Cancel a working simulated order."""
+        return self.broker.cancel(order_id)
+
+    def cancel_all_orders(self) -> bool:
+        """Cancel every working simulated order."""
+        return self.broker.cancel_all()
+
+    def get_all_orders(self) -> Orders:
+        """Return every simulated order."""
+        return self.broker.all_orders()
+
+
+class BacktestEventPort(EventPort):
+    """EventPort that emits START, one TICK per bar, then STOP.
+
+    Each TICK advances the clock and lets the broker match working orders
+    against the new bar before the engine observes it.
+
+    Args:
+        clock: Simulation clock to advance.
+        broker: Simulated broker to step with the clock.
+    """
+
+    def __init__(self, clock: SimulationClock, broker: SimulatedBroker):
+        """Initialize the port.
+
+        Args:
+            clock: Simulation clock to advance.
+            broker: Simulated broker to step with the clock.
+        """
+        self.clock = clock
+        self.broker = broker
+        self._bars = len(broker.store)
+        self._started = False
+
+    def wait_for_event(self, timeout_s: float | None) -> Event | None:
+        """Return the next replay event."""
+        if not self._started:
+            self._started = True
+            return Event(
+                timestamp=self.clock.now(),
+                type=EventType.COMMAND,
+                command=ControllerCommand.START,
+            )
+        if self.clock.index + 1 >= self._bars:
+            return Event(
+                timestamp=self.clock.now(),
+                type=EventType.COMMAND,
+                command=ControllerCommand.STOP,
+            )
+        self.broker.process_bar(self.clock.advance())
+        return Event(
+            timestamp=self.clock.now(),
+            type=EventType.TICK,
+            reason=TickReason.SCHEDULED,
+        )
+
+
+class NullJournalPort(JournalPort):
+    """JournalPort that discards everything except errors."""
+
+    def __init__(self):
+        """Initialize with an empty error list."""
+        self.errors: list[JournalError] = []
+
+    def report_input(self, input: JournalInput) -> None:
+        """Discard journal input."""
+
+    def report_output(self, output: JournalOutput) -> None:
+        """Discard journal output."""
+
+    def report_error(self, error: JournalError) -> None:
+        """Keep engine errors for inspection after the run."""
+        self.errors.append(error)
+
+
+class NullControllerPort(ControllerPort):
+    """ControllerPort that issues no commands and records the last status."""
+
+    def __init__(self):
+        """Initialize with no published status."""
+        self.status: EngineState | None = None
+
+    def wait_for_command(self, timeout_s: float | None) -> ControllerCommand | None:
+        """Return no command."""
+        return None
+
+    def publish_status(self, status: EngineState) -> None:
+        """Record the engine status."""
+        self.status = status
+
+
+class PassthroughPortfolioManagerPort(PortfolioManagerPort):
+    """PortfolioManagerPort that forwards strategy signals unchanged.
+
+    Used to backtest a strategy in isolation from sizing and risk rules.
+
+    Args:
+        trading_state: Trading state reported on every tick.
+        max_exposure_pct: Maximum exposure reported on the state.
+        max_position_pct: Maximum position size reported on the state.
+    """
+
+    def __init__(
+        self,
+        trading_state: TradingState = TradingState.NEUTRAL,
+        max_exposure_pct: float = 100.0,
+        max_position_pct: float = 100.0,
+    ):
+        """Initialize the fixed portfolio manager state.
+
+        Args:
+            trading_state: Trading state reported on every tick.
+            max_exposure_pct: Maximum exposure reported on the state.
+            max_position_pct: Maximum position size reported on the state.
+        """
+        self.state = PortfolioManager(
+            timestamp=datetime.min.replace(tzinfo=timezone.utc),
+            trading_state=trading_state,
+            max_exposure_pct=max_exposure_pct,
+            max_position_pct=max_position_pct,
+        )
+
+    def get_state(self) -> PortfolioManager:
+        """Return the fixed portfolio manager state."""
+        return self.state
+
+    def handle_signals(  # noqa: PLR0913
+        self,
+        signals: Orders,
+        quote_data: Quote | QuoteBatch,
+        account_data: Account,
+        position_data: Positions,
+        open_orders: Orders,
+        portfolio_state: PortfolioManager,
+    ) -> Orders:
+        """Return the signals as orders."""
+        return signals
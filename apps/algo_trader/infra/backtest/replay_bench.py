@@ -0,0 +1,161 @@
+"""Benchmark for Backtester replay throughput.
+
+Replays a synthetic random-walk BarStore through the full Engine stack with
+the DataFrame and columnar data paths, once with a strategy that never trades
+(pure replay overhead) and once with SmaCrossoverStrategy. Prints one JSON
+line per case with engine ticks per second and per minute and symbol-bars
+per minute. Whether a case reaches the throughput goal (--target, 1M ticks per
+minute by default) is only known from the measured output; cases below it log
+a warning.
+
+Example:
+    python -m system.algo_trader.infra.backtest.replay_bench --bars 20000 --symbols 1 10 100
+    python -m system.algo_trader.infra.backtest.replay_bench --lookback 50 --repeat 5
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+from typing import Any
+
+import numpy as np
+import pandas as pd
+
+from infrastructure.logging.logger import get_logger
+from system.algo_trader.domain.models import (
+    HistoricalOHLCV,
+    OHLCVPanel,
+    Orders,
+    Positions,
+    Quote,
+    QuoteBatch,
+)
+from system.algo_trader.domain.ports.strategy_port import StrategyPort
+from system.algo_trader.infra.backtest.backtester import Backtester
+from system.algo_trader.infra.backtest.bar_store import BarStore
+from system.algo_trader.infra.backtest.ports import PassthroughPortfolioManagerPort
+from system.algo_trader.infra.backtest.sma_crossover import SmaCrossoverStrategy
+
+logger = get_logger("replay_bench")
+
+# Throughput goal for replay, not a measured result
+TARGET_TICKS_PER_MIN = 1_000_000
+
+
+class NullStrategy(StrategyPort):
+    """Strategy that never trades, so a run times only the replay itself."""
+
+    def get_signals(
+        self,
+        historical_data: HistoricalOHLCV | OHLCVPanel,
+        quote_data: Quote | QuoteBatch,
+        position_data: Positions,
+    ) -> Orders:
+        """Return no orders."""
+        return Orders(timestamp=position_data.timestamp, orders=[])
+
+
+def synthetic_store(bars: int, symbols: int, seed: int = 7) -> BarStore:
+    """Build a random-walk minute-bar BarStore of bars x symbols."""
+    rng = np.random.default_rng(seed)
+    close = 100.0 * np.exp(np.cumsum(rng.normal(0.0, 0.01, (bars, symbols)), axis=0))
+    open_ = np.vstack([close[:1], close[:-1]])
+    return BarStore(
+        [f"SYM{j:04d}" for j in range(symbols)],
+        pd.date_range("2024-01-02", periods=bars, freq="min", tz="UTC"),
+        {
+            "open": open_,
+            "high": np.maximum(open_, close) * 1.001,
+            "low": np.minimum(open_, close) * 0.999,
+            "close": close,
+            "volume": rng.integers(100_000, 1_000_000, (bars, symbols)).astype(np.float64),
+        },
+        frequency="1m",
+    )
+
+
+def run(
+    store: BarStore,
+    lookback: int,
+    repeat: int,
+    strategies: list[str],
+    target: float = TARGET_TICKS_PER_MIN,
+) -> list[dict[str, Any]]:
+    """Replay the store once per data path and strategy, keeping the best run.
+
+    Args:
+        store: Bar history to replay.
+        lookback: Historical window length passed to the strategy.
+        repeat: Timed runs per case.
+        strategies: Strategy names to time ("null" and/or "sma").
+        target: Ticks per minute a case must reach to meet the goal.
+
+    Returns:
+        One result dict per case.
+    """
+    results = []
+    for columnar in (False, True):
+        for name in strategies:
+            best = 0.0
+            for _ in range(repeat):
+                strategy = NullStrategy() if name == "null" else SmaCrossoverStrategy(10, 50)
+                result = Backtester(
+                    store,
+                    strategy,
+                    PassthroughPortfolioManagerPort(),
+                    lookback=lookback,
+                    columnar=columnar,
+                ).run(fast=True)
+                best = max(best, result.ticks_per_second)
+            ticks_per_min = best * 60.0
+            results.append(
+                {
+                    "data": "columnar" if columnar else "dataframe",
+                    "strategy": name,
+                    "bars": len(store),
+                    "symbols": len(store.symbols),
+                    "lookback": lookback,
+                    "ticks_per_s": round(best, 1),
+                    "ticks_per_min": round(ticks_per_min),
+                    "symbol_bars_per_min": round(ticks_per_min * len(store.symbols)),
+                    "meets_target": ticks_per_min >= target,
+                }
+            )
+    return results
+
+
+def main(argv: list[str] | None = None) -> None:
+    """Parse arguments and run the benchmark."""
+    parser = argparse.ArgumentParser(description="Backtester replay throughput benchmark")
+    parser.add_argument("--bars", type=int, default=20_000, help="Bars per symbol")
+    parser.add_argument(
+        "--symbols", type=int, nargs="+", default=[1, 10, 100], help="Universe sizes to time"
+    )
+    parser.add_argument("--lookback", type=int, default=100, help="Strategy window length")
+    parser.add_argument("--repeat", type=int, default=3, help="Timed runs per case")
+    parser.add_argument(
+        "--target", type=float, default=TARGET_TICKS_PER_MIN, help="Goal in ticks per minute"
+    )
+    parser.add_argument(
+        "--strategies",
+        nargs="+",
+        choices=["null", "sma"],
+        default=["null", "sma"],
+        help="Strategies to time",
+    )
+    args = parser.parse_args(argv)
+
+    for symbols in args.symbols:
+        store = synthetic_store(args.bars, symbols)
+        for result in run(store, args.lookback, args.repeat, args.strategies, args.target):
+            if not result["meets_target"]:
+                logger.warning(
+                    f"{result['data']}/{result['strategy']} with {symbols} symbols replays "
+                    f"{result['ticks_per_min']} ticks/min, below the {args.target:.0f} goal"
+                )
+            print(json.dumps(result), flush=True)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,162 @@
+"""Shared-memory publication of a BarStore for worker processes.
+
+This module provides SharedBarStore, which copies a BarStore's field matrices
+and timestamps into multiprocessing.shared_memory blocks once, and
+SharedBarStoreHandle, the small picklable description workers use to attach
+to those blocks. Workers map the same pages as the parent, so no bar data is
+pickled per task. Attached stores must be treated as read-only.
+"""
+
+from __future__ import annotations
+
+import sys
+from dataclasses import dataclass
+from multiprocessing import resource_tracker, shared_memory
+
+import numpy as np
+import pandas as pd
+
+from infrastructure.logging.logger import get_logger
+from system.algo_trader.domain.models import OHLCV_FIELDS
+from system.algo_trader.infra.backtest.bar_store import BarStore
+
+# Store attached in this process, keyed by field block name, with its blocks
+# kept alive for as long as the arrays are in use. Only the latest is kept so
+# long-lived pools do not pin the pages of every finished sweep
+_ATTACHED: dict[str, tuple[BarStore, list[shared_memory.SharedMemory]]] = {}
+
+
+@dataclass(frozen=True)
+class SharedBarStoreHandle:
+    """Picklable reference to a BarStore published in shared memory.
+
+    Attributes:
+        fields_name: Shared memory block holding a (fields, bars, symbols) float64 array.
+        index_name: Shared memory block holding int64 epoch-nanosecond timestamps.
+        bars: Number of timeline steps.
+        symbols: Symbol universe in column order.
+        frequency: Bar frequency label.
+    """
+
+    fields_name: str
+    index_name: str
+    bars: int
+    symbols: tuple[str, ...]
+    frequency: str
+
+
+def _open_block(name: str) -> shared_memory.SharedMemory:
+    """Attach to an existing block without handing its lifetime to this process.
+
+    The publishing process owns and unlinks each block; workers must not let
+    their resource tracker unlink it when they exit.
+    """
+    if sys.version_info >= (3, 13):
+        return shared_memory.SharedMemory(name=name, track=False)
+    block = shared_memory.SharedMemory(name=name)
+    resource_tracker.unregister(block._name, "shared_memory")
+    return block
+
+
+def attach(handle: SharedBarStoreHandle) -> BarStore:
+    """Return a BarStore backed by the shared blocks, attaching once per process.
+
+    Attaching a different handle releases the previously attached store, so
+    callers must not keep using a store once they attach another.
+
+    Args:
+        handle: Handle produced by SharedBarStore.handle.
+
+    Returns:
+        BarStore whose field matrices are views into shared memory.
+    """
+    cached = _ATTACHED.get(handle.fields_name)
+    if cached is not None:
+        return cached[0]
+    _release_attached()
+
+    fields_block = _open_block(handle.fields_name)
+    index_block = _open_block(handle.index_name)
+    shape = (len(OHLCV_FIELDS), handle.bars, len(handle.symbols))
+    values = np.ndarray(shape, dtype=np.float64, buffer=fields_block.buf)
+    timestamps = np.ndarray((handle.bars,), dtype=np.int64, buffer=index_block.buf)
+
+    store = BarStore(
+        list(handle.symbols),
+        pd.DatetimeIndex(timestamps.view("datetime64[ns]")).tz_localize("UTC"),
+        {name: values[k] for k, name in enumerate(OHLCV_FIELDS)},
+        frequency=handle.frequency,
+    )
+    _ATTACHED[handle.fields_name] = (store, [fields_block, index_block])
+    return store
+
+
+def _release_attached() -> None:
+    """Drop every attached store and unmap its blocks where no views remain."""
+    while _ATTACHED:
+        _, (store, blocks) = _ATTACHED.popitem()
+        del store
+        for block in blocks:
+            try:
+                block.close()
+            except BufferError:
+                # Someone still holds a view; the mapping goes when it does
+                pass
+
+
+class SharedBarStore:
+    """Owner of the shared memory blocks holding one BarStore.
+
+    Use as a context manager so the blocks are unlinked when the sweep ends.
+
+    Args:
+        store: Bar history to publish.
+    """
+
+    def __init__(self, store: BarStore):
+        """Copy the store into newly created shared memory blocks.
+
+        Args:
+            store: Bar history to publish.
+        """
+        self.logger = get_logger(self.__class__.__name__)
+        bars, n_symbols = len(store), len(store.symbols)
+        shape = (len(OHLCV_FIELDS), bars, n_symbols)
+
+        self._fields_block = shared_memory.SharedMemory(
+            create=True, size=max(1, int(np.prod(shape)) * 8)
+        )
+        self._index_block = shared_memory.SharedMemory(create=True, size=max(1, bars * 8))
+
+        values = np.ndarray(shape, dtype=np.float64, buffer=self._fields_block.buf)
+        for k, name in enumerate(OHLCV_FIELDS):
+            values[k] = store.fields[name]
+        timestamps = np.ndarray((bars,), dtype=np.int64, buffer=self._index_block.buf)
+        timestamps[:] = store.timestamps.view(np.int64)
+
+        self.handle = SharedBarStoreHandle(
+            fields_name=self._fields_block.name,
+            index_name=self._index_block.name,
+            bars=bars,
+            symbols=store.symbols,
+            frequency=store.frequency,
+        )
+        self.logger.info(
+            f"Published {bars} bars x {n_symbols} symbols "
+            f"({self._fields_block.size / 1e6:.1f} MB) to shared memory"
+        )
+
+    def close(self) -> None:
+        """Release and unlink the shared memory blocks."""
+        _ATTACHED.pop(self.handle.fields_name, None)
+        for block in (self._fields_block, self._index_block):
+            block.close()
+            block.unlink()
+
+    def __enter__(self) -> SharedBarStore:
+        """Return self for use as a context manager."""
+        return self
+
+    def __exit__(self, exc_type, exc_val, exc_tb) -> None:
+        """Unlink the shared memory blocks."""
+        self.close()
@@ -0,0 +1,345 @@
+"""Bar-based fill simulator for backtests.
+
+This module provides SimulatedBroker, which holds cash, positions and working
+orders for a backtest and matches MarketOrder, LimitOrder, StopOrder and
+StopLimitOrder against each bar of a BarStore. Orders placed on bar i are first
+eligible on bar i + 1, so a strategy never trades on the bar it just observed.
+"""
+
+from __future__ import annotations
+
+from dataclasses import dataclass
+from datetime import datetime
+from uuid import UUID
+
+import numpy as np
+
+from infrastructure.logging.logger import get_logger
+from system.algo_trader.domain.models import (
+    Account,
+    LimitOrder,
+    MarketOrder,
+    Orders,
+    Position,
+    Positions,
+    StopLimitOrder,
+    StopOrder,
+)
+from system.algo_trader.domain.states import OrderDuration, OrderInstruction, OrderStatus
+from system.algo_trader.infra.backtest.bar_store import BarStore
+
+_BUY_INSTRUCTIONS = (OrderInstruction.BUY_TO_OPEN, OrderInstruction.BUY_TO_CLOSE)
+
+
+@dataclass
+class Fill:
+    """Executed fill produced by the simulator.
+
+    Attributes:
+        order_id: ID of the filled order.
+        timestamp: Timestamp of the bar the order filled on.
+        symbol: Trading symbol.
+        quantity: Signed quantity (positive for buys, negative for sells).
+        price: Fill price including slippage.
+        commission: Commission charged for the fill.
+    """
+
+    order_id: UUID
+    timestamp: datetime
+    symbol: str
+    quantity: int
+    price: float
+    commission: float
+
+
+@dataclass
+class _WorkingOrder:
+    """Matching state for one working order."""
+
+    order: LimitOrder | MarketOrder | StopOrder | StopLimitOrder
+    column: int
+    sign: int
+    eligible_from: int
+    session: np.datetime64 | None = None
+    triggered: bool = False
+
+
+class SimulatedBroker:
+    """Simulated account and order book driven bar by bar.
+
+    Fill rules, for a buy (sells mirror them):
+        - MarketOrder fills at the bar open.
+        - LimitOrder fills at min(open, limit) when low <= limit.
+        - StopOrder triggers when high >= stop and fills at max(open, stop).
+        - StopLimitOrder triggers like a StopOrder, then fills like a LimitOrder
+          at min(max(open, stop), limit); once triggered it stays triggered.
+
+    Orders fill in full. Slippage applies to market and stop fills only. DAY
+    orders expire after the first session they are eligible in; IOC and FOK
+    orders get a single eligible bar; GTC orders work until filled or
+    cancelled. Bars with no data for a symbol are skipped for matching.
+
+    Args:
+        store: Bar history to match against.
+        initial_cash: Starting cash balance.
+        commission_per_share: Commission charged per filled share.
+        slippage_bps: Adverse slippage for market and stop fills, in basis points.
+    """
+
+    def __init__(
+        self,
+        store: BarStore,
+        initial_cash: float = 100_000.0,
+        commission_per_share: float = 0.0,
+        slippage_bps: float = 0.0,
+    ):
+        """Initialize a flat account positioned before the first bar.
+
+        Args:
+            store: Bar history to match against.
+            initial_cash: Starting cash balance.
+            commission_per_share: Commission charged per filled share.
+            slippage_bps: Adverse slippage for market and stop fills, in basis points.
+        """
+        self.logger = get_logger(self.__class__.__name__)
+        self.store = store
+        self.initial_cash = initial_cash
+        self.commission_per_share = commission_per_share
+        self.slippage = slippage_bps / 10_000.0
+
+        n_symbols = len(store.symbols)
+        self.cash = float(initial_cash)
+        self.commission_and_fees = 0.0
+        self.quantity = np.zeros(n_symbols, dtype=np.int64)
+        self.cost_basis = np.zeros(n_symbols, dtype=np.float64)
+        self.last_price = np.full(n_symbols, np.nan, dtype=np.float64)
+        self.equity_curve = np.full(len(store), np.nan, dtype=np.float64)
+        self.index = -1
+
+        self.orders: dict[UUID, LimitOrder | MarketOrder | StopOrder | StopLimitOrder] = {}
+        self.status: dict[UUID, OrderStatus] = {}
+        self.fills: list[Fill] = []
+        self._working: dict[UUID, _WorkingOrder] = {}
+
+    def now(self) -> datetime:
+        """Return the timestamp of the current bar (the first bar before the run)."""
+        return self.store.datetimes[max(self.index, 0)]
+
+    # Order book
+
+    def submit(self, orders: Orders) -> Orders:
+        """Accept orders for matching from the next bar onward.
+
+        Orders for unknown symbols or with non-positive quantity are rejected.
+
+        Args:
+            orders: Orders to submit.
+
+        Returns:
+            The orders that were accepted.
+        """
+        accepted = []
+        for order in orders.orders:
+            self.orders[order.id] = order
+            column = self.store.position(order.symbol) if order.symbol in self.store else None
+            if column is None or order.quantity <= 0:
+                self.status[order.id] = OrderStatus.REJECTED
+                self.logger.warning(f"Rejected order {order.id} for {order.symbol}")
+                continue
+            sign = 1 if order.order_instruction in _BUY_INSTRUCTIONS else -1
+            self._working[order.id] = _WorkingOrder(order, column, sign, self.index + 1)
+            self.status[order.id] = OrderStatus.WORKING
+            accepted.append(order)
+        return Orders(timestamp=orders.timestamp, orders=accepted)
+
+    def cancel(self, order_id: str) -> bool:
+        """Cancel a working order by its string ID.
+
+        Returns:
+            True if a working order was cancelled.
+        """
+        try:
+            key = UUID(order_id)
+        except ValueError:
+            return False
+        if self._working.pop(key, None) is None:
+            return False
+        self.status[key] = OrderStatus.CANCELLED
+        return True
+
+    def cancel_all(self) -> bool:
+        """Cancel every working order.
+
+        Returns:
+            True once all working orders are cancelled.
+        """
+        for key in self._working:
+            self.status[key] = OrderStatus.CANCELLED
+        self._working.clear()
+        return True
+
+    def open_orders(self) -> Orders:
+        """Return every working order."""
+        return Orders(timestamp=self.now(), orders=[w.order for w in self._working.values()])
+
+    def all_orders(self) -> Orders:
+        """Return every order submitted during the run."""
+        return Orders(timestamp=self.now(), orders=list(self.orders.values()))
+
+    # Simulation
+
+    def process_bar(self, index: int) -> None:
+        """Advance to a bar: match working orders, then mark to the close.
+
+        Args:
+            index: Timeline step of the bar.
+        """
+        self.index = index
+        if self._working:
+            self._match(index)
+        close = self.store.close[index]
+        np.copyto(self.last_price, close, where=~np.isnan(close))
+        self.equity_curve[index] = self.equity()
+
+    def _match(self, index: int) -> None:
+        store = self.store
+        session = store.dates[index]
+        for key, working in list(self._working.items()):
+            if working.eligible_from > index:
+                continue
+            duration = working.order.order_duration
+            if working.session is None:
+                working.session = session
+            elif duration == OrderDuration.DAY and session > working.session:
+                self._expire(key)
+                continue
+
+            j = working.column
+            bar_open = store.open[index, j]
+            if not np.isnan(bar_open):
+                price = self._fill_price(
+                    working, bar_open, store.high[index, j], store.low[index, j]
+                )
+                if price is not None:
+                    self._execute(key, working, price, index)
+                    continue
+
+            if duration in (OrderDuration.IOC, OrderDuration.FOK):
+                self._expire(key)
+
+    def _fill_price(
+        self, working: _WorkingOrder, bar_open: float, high: float, low: float
+    ) -> float | None:
+        """Return the fill price for a working order on this bar, or None."""
+        order = working.order
+        buy = working.sign > 0
+
+        if isinstance(order, MarketOrder):
+            return self._slip(bar_open, working.sign)
+
+        if isinstance(order, LimitOrder):
+            if buy:
+                return min(bar_open, order.price) if low <= order.price else None
+            return max(bar_open, order.price) if high >= order.price else None
+
+        if isinstance(order, StopOrder):
+            if buy:
+                return self._slip(max(bar_open, order.price), 1) if high >= order.price else None
+            return self._slip(min(bar_open, order.price), -1) if low <= order.price else None
+
+        # StopLimitOrder
+        if not working.triggered:
+            working.triggered = high >= order.stop_price if buy else low <= order.stop_price
+            if not working.triggered:
+                return None
+            start = max(bar_open, order.stop_price) if buy else min(bar_open, order.stop_price)
+        else:
+            start = bar_open
+        if buy:
+            return min(start, order.limit_price) if low <= order.limit_price else None
+        return max(start, order.limit_price) if high >= order.limit_price else None
+
+    def _slip(self, price: float, sign: int) -> float:
+        return price * (1.0 + sign * self.slippage) if self.slippage else price
+
+    def _execute(self, key: UUID, working: _WorkingOrder, price: float, index: int) -> None:
+        """Apply a fill to cash and the position, then retire the order."""
+        j = working.column
+        quantity = working.sign * working.order.quantity
+        position = int(self.quantity[j])
+        new_position = position + quantity
+
+        if position == 0 or (position > 0) == (quantity > 0):
+            self.cost_basis[j] = (
+                self.cost_basis[j] * abs(position) + price * abs(quantity)
+            ) / abs(new_position)
+        elif new_position == 0:
+            self.cost_basis[j] = 0.0
+        elif (new_position > 0) != (position > 0):
+            self.cost_basis[j] = price
+
+        commission = self.commission_per_share * abs(quantity)
+        self.quantity[j] = new_position
+        self.cash -= quantity * price + commission
+        self.commission_and_fees += commission
+
+        del self._working[key]
+        self.status[key] = OrderStatus.FILLED
+        self.fills.append(
+            Fill(
+                order_id=key,
+                timestamp=self.store.datetimes[index],
+                symbol=working.order.symbol,
+                quantity=quantity,
+                price=price,
+                commission=commission,
+            )
+        )
+
+    def _expire(self, key: UUID) -> None:
+        del self._working[key]
+        self.status[key] = OrderStatus.EXPIRED
+
+    # Account
+
+    def position_value(self) -> float:
+        """Return the signed market value of all positions at the last prices."""
+        held = self.quantity != 0
+        return float(np.dot(self.quantity[held], self.last_price[held]))
+
+    def equity(self) -> float:
+        """Return cash plus position value."""
+        return self.cash + self.position_value()
+
+    def account(self) -> Account:
+        """Return the simulated account snapshot at the current bar."""
+        position_value = self.position_value()
+        return Account(
+            timestamp=self.now(),
+            cash=self.cash,
+            buying_power=self.cash,
+            position_value=position_value,
+            net_liquidation=self.cash + position_value,
+            commission_and_fees=self.commission_and_fees,
+        )
+
+    def positions(self) -> Positions:
+        """Return every non-flat position marked at the last price."""
+        now = self.now()
+        positions = []
+        for j in np.flatnonzero(self.quantity):
+            quantity = int(self.quantity[j])
+            price = float(self.last_price[j])
+            cost = float(self.cost_basis[j])
+            positions.append(
+                Position(
+                    timestamp=now,
+                    symbol=self.store.symbols[j],
+                    quantity=quantity,
+                    cost_basis=cost,
+                    current_price=price,
+                    pnl_open=(price - cost) * quantity,
+                    net_liquidation=price * quantity,
+                )
+            )
+        return Positions(timestamp=now, positions=positions)
@@ -0,0 +1,145 @@
+"""Long-only SMA crossover strategy for backtests and parameter sweeps.
+
+This module provides SmaCrossoverStrategy, the StrategyPort counterpart of the
+Rust sma_crossover scanner: it buys when the short simple moving average
+crosses above the long one and closes the position on the opposite cross.
+"""
+
+from collections.abc import Callable
+from uuid import UUID, uuid4
+
+import numpy as np
+
+from system.algo_trader.domain.models import (
+    HistoricalOHLCV,
+    MarketOrder,
+    OHLCVPanel,
+    Orders,
+    Positions,
+    Quote,
+    QuoteBatch,
+)
+from system.algo_trader.domain.ports.strategy_port import StrategyPort
+from system.algo_trader.domain.states import (
+    OrderDuration,
+    OrderInstruction,
+    OrderTaxLotMethod,
+    OrderType,
+)
+
+
+def _sma_pair(closes: np.ndarray, window: int) -> tuple[float, float]:
+    """Return the SMAs ending at the previous and the last bar.
+
+    Args:
+        closes: Close prices with at least window + 1 entries.
+        window: Moving average window.
+
+    Returns:
+        Tuple of (previous SMA, last SMA).
+    """
+    tail = closes[-(window + 1) :]
+    shared = float(tail[1:-1].sum())
+    return (shared + tail[0]) / window, (shared + tail[-1]) / window
+
+
+class SmaCrossoverStrategy(StrategyPort):
+    """Trade each symbol on short/long SMA crossovers.
+
+    The crossover rule matches the Rust sma_crossover scanner: a buy fires when
+    short_prev <= long_prev and short_last > long_last. Positions are closed
+    on the mirrored rule. Accepts both DataFrame and columnar historical data.
+
+    Args:
+        short_window: Short SMA window.
+        long_window: Long SMA window; must exceed short_window.
+        quantity: Shares bought per entry.
+        id_factory: Callable returning order IDs; defaults to uuid4.
+    """
+
+    def __init__(
+        self,
+        short_window: int,
+        long_window: int,
+        quantity: int = 100,
+        id_factory: Callable[[], UUID] | None = None,
+    ):
+        """Initialize the strategy.
+
+        Args:
+            short_window: Short SMA window.
+            long_window: Long SMA window; must exceed short_window.
+            quantity: Shares bought per entry.
+            id_factory: Callable returning order IDs; defaults to uuid4.
+
+        Raises:
+            ValueError: If the windows are not 0 < short_window < long_window.
+        """
+        if not 0 < short_window < long_window:
+            raise ValueError(
+                f"SMA windows must satisfy 0 < short < long, got {short_window}/{long_window}"
+            )
+        self.short_window = short_window
+        self.long_window = long_window
+        self.quantity = quantity
+        self.lookback = long_window + 1
+        self._new_id = id_factory or uuid4
+
+    def _closes(self, historical_data: HistoricalOHLCV | OHLCVPanel):
+        """Yield (symbol, close array) for every symbol in the window."""
+        if isinstance(historical_data, OHLCVPanel):
+            for symbol in historical_data.symbols:
+                yield symbol, historical_data.column(symbol, "close")
+            return
+        for symbol, frame in historical_data.data.items():
+            yield symbol, frame["close"].to_numpy(dtype=np.float64)
+
+    def _order(
+        self, timestamp, symbol: str, quantity: int, instruction: OrderInstruction
+    ) -> MarketOrder:
+        return MarketOrder(
+            id=self._new_id(),
+            timestamp=timestamp,
+            symbol=symbol,
+            quantity=quantity,
+            order_type=OrderType.MARKET,
+            order_instruction=instruction,
+            order_duration=OrderDuration.DAY,
+            order_tax_lot_method=OrderTaxLotMethod.FIFO,
+        )
+
+    def get_signals(
+        self,
+        historical_data: HistoricalOHLCV | OHLCVPanel,
+        quote_data: Quote | QuoteBatch,
+        position_data: Positions,
+    ) -> Orders:
+        """Return entry and exit orders for symbols that crossed on the last bar.
+
+        Args:
+            historical_data: Trailing window including the current bar.
+            quote_data: Current quotes; only the timestamp is used.
+            position_data: Current positions.
+
+        Returns:
+            Orders with at most one order per symbol.
+        """
+        held = {position.symbol: position.quantity for position in position_data.positions}
+        now = quote_data.timestamp
+        orders = []
+
+        for symbol, closes in self._closes(historical_data):
+            if len(closes) < self.lookback:
+                continue
+            short_prev, short_last = _sma_pair(closes, self.short_window)
+            long_prev, long_last = _sma_pair(closes, self.long_window)
+            position = held.get(symbol, 0)
+
+            if position == 0 and short_prev <= long_prev and short_last > long_last:
+                orders.append(
+                    self._order(now, symbol, self.quantity, OrderInstruction.BUY_TO_OPEN)
+                )
+            elif position > 0 and short_prev >= long_prev and short_last < long_last:
+                orders.append(self._order(now, symbol, position, OrderInstruction.SELL_TO_CLOSE))
+
+        return Orders(timestamp=now, orders=orders)
@@ -0,0 +1,274 @@
+"""Parallel strategy parameter sweeps over a shared BarStore.
+
+This module provides ParameterSweep, which splits a list of parameter sets into
+chunks, backtests each set with Backtester in ProcessManager pool workers, and
+streams SweepResult records back as chunks complete. The bar history is
+published once through shared memory; each task pickles only a small handle,
+the factories and its parameter chunk.
+"""
+
+from __future__ import annotations
+
+import itertools
+import time
+from collections.abc import Callable, Iterator
+from dataclasses import asdict, dataclass
+from typing import Any
+
+import numpy as np
+
+from infrastructure.logging.logger import get_logger
+from infrastructure.multiprocess.process_manager import ProcessManager
+from system.algo_trader.domain.ports.portfolio_manager_port import PortfolioManagerPort
+from system.algo_trader.domain.ports.strategy_port import StrategyPort
+from system.algo_trader.infra.backtest.backtester import Backtester
+from system.algo_trader.infra.backtest.bar_store import BarStore
+from system.algo_trader.infra.backtest.ports import PassthroughPortfolioManagerPort
+from system.algo_trader.infra.backtest.shared_store import (
+    SharedBarStore,
+    SharedBarStoreHandle,
+    attach,
+)
+
+StrategyFactory = Callable[..., StrategyPort]
+PortfolioManagerFactory = Callable[[], PortfolioManagerPort]
+
+
+def grid(space: dict[str, list[Any]]) -> list[dict[str, Any]]:
+    """Expand a parameter space into the full Cartesian grid.
+
+    Args:
+        space: Mapping of parameter name to candidate values.
+
+    Returns:
+        One dict per combination, in row-major order of the space.
+    """
+    names = list(space)
+    return [dict(zip(names, values, strict=True)) for values in itertools.product(*space.values())]
+
+
+def random_search(
+    space: dict[str, list[Any] | tuple[int, int] | tuple[float, float]],
+    samples: int,
+    seed: int | None = None,
+) -> list[dict[str, Any]]:
+    """Draw parameter sets at random from a space.
+
+    Lists are sampled uniformly by element; (low, high) int tuples are sampled
+    as inclusive integer ranges and float tuples as uniform intervals.
+
+    Args:
+        space: Mapping of parameter name to candidates or bounds.
+        samples: Number of parameter sets to draw.
+        seed: Optional RNG seed for reproducible searches.
+
+    Returns:
+        List of sampled parameter sets.
+    """
+    rng = np.random.default_rng(seed)
+    draws: dict[str, list[Any]] = {}
+    for name, candidates in space.items():
+        if isinstance(candidates, tuple):
+            low, high = candidates
+            if isinstance(low, int) and isinstance(high, int):
+                draws[name] = rng.integers(low, high + 1, size=samples).tolist()
+            else:
+                draws[name] = rng.uniform(low, high, size=samples).tolist()
+        else:
+            picks = rng.integers(0, len(candidates), size=samples)
+            draws[name] = [candidates[i] for i in picks]
+    return [{name: draws[name][i] for name in space} for i in range(samples)]
+
+
+def chunked(param_sets: list[dict[str, Any]], size: int) -> list[list[dict[str, Any]]]:
+    """Split parameter sets into consecutive chunks of at most size entries."""
+    size = max(1, size)
+    return [param_sets[i : i + size] for i in range(0, len(param_sets), size)]
+
+
+@dataclass
+class SweepResult:
+    """Backtest summary for one parameter set.
+
+    Attributes:
+        params: Parameter set passed to the strategy factory.
+        final_equity: Equity at the last bar.
+        total_return: final_equity / initial_cash - 1.
+        max_drawdown: Largest peak-to-trough equity decline, as a fraction.
+        fills: Number of fills.
+        ticks: Engine ticks executed.
+        elapsed_s: Backtest wall-clock time.
+        error: Error message if the backtest raised, else None.
+    """
+
+    params: dict[str, Any]
+    final_equity: float = float("nan")
+    total_return: float = float("nan")
+    max_drawdown: float = float("nan")
+    fills: int = 0
+    ticks: int = 0
+    elapsed_s: float = 0.0
+    error: str | None = None
+
+    def to_dict(self) -> dict[str, Any]:
+        """Return the result as a JSON-serializable dict."""
+        return asdict(self)
+
+
+@dataclass(frozen=True)
+class _SweepTask:
+    """Unit of work sent to a pool worker."""
+
+    handle: SharedBarStoreHandle
+    strategy_factory: StrategyFactory
+    portfolio_manager_factory: PortfolioManagerFactory
+    backtest_kwargs: dict[str, Any]
+    param_sets: list[dict[str, Any]]
+
+
+def _backtest_one(
+    store: BarStore,
+    strategy_factory: StrategyFactory,
+    portfolio_manager_factory: PortfolioManagerFactory,
+    backtest_kwargs: dict[str, Any],
+    params: dict[str, Any],
+) -> SweepResult:
+    """Backtest one parameter set and summarize it, capturing failures."""
+    try:
+        strategy = strategy_factory(**params)
+        kwargs = dict(backtest_kwargs)
+        kwargs.setdefault("lookback", getattr(strategy, "lookback", 252))
+        result = Backtester(store, strategy, portfolio_manager_factory(), **kwargs).run()
+    except Exception as e:
+        return SweepResult(params=params, error=f"{type(e).__name__}: {e}")
+
+    equity = result.equity
+    peaks = np.fmax.accumulate(equity)
+    with np.errstate(divide="ignore", invalid="ignore"):
+        drawdown = np.nanmax(1.0 - equity / peaks) if len(equity) else 0.0
+    initial_cash = kwargs.get("initial_cash", 100_000.0)
+    final_equity = float(equity[-1]) if len(equity) else initial_cash
+    return SweepResult(
+        params=params,
+        final_equity=final_equity,
+        total_return=final_equity / initial_cash - 1.0,
+        max_drawdown=float(drawdown),
+        fills=len(result.fills),
+        ticks=result.ticks,
+        elapsed_s=result.elapsed_s,
+    )
+
+
+def _run_chunk(task: _SweepTask) -> list[SweepResult]:
+    """Pool worker entry point: backtest every parameter set in a chunk."""
+    store = attach(task.handle)
+    return [
+        _backtest_one(
+            store,
+            task.strategy_factory,
+            task.portfolio_manager_factory,
+            task.backtest_kwargs,
+            params,
+        )
+        for params in task.param_sets
+    ]
+
+
+class ParameterSweep:
+    """Backtest many parameter sets of one strategy across a process pool.
+
+    Factories run inside workers, so they must be picklable (module-level
+    functions or classes). The strategy factory is called with each parameter
+    set as keyword arguments; a strategy exposing a ``lookback`` attribute sets
+    the historical window unless backtest_kwargs overrides it.
+
+    Args:
+        store: Bar history shared by every backtest.
+        strategy_factory: Callable building a StrategyPort from parameters.
+        portfolio_manager_factory: Callable building a PortfolioManagerPort.
+        backtest_kwargs: Extra Backtester keyword arguments (e.g., initial_cash).
+        process_manager: Optional ProcessManager; one is created per run if
+            omitted. A supplied manager's pool is left running after each run.
+    """
+
+    def __init__(
+        self,
+        store: BarStore,
+        strategy_factory: StrategyFactory,
+        portfolio_manager_factory: PortfolioManagerFactory = PassthroughPortfolioManagerPort,
+        backtest_kwargs: dict[str, Any] | None = None,
+        process_manager: ProcessManager | None = None,
+    ):
+        """Initialize the sweep.
+
+        Args:
+            store: Bar history shared by every backtest.
+            strategy_factory: Callable building a StrategyPort from parameters.
+            portfolio_manager_factory: Callable building a PortfolioManagerPort.
+            backtest_kwargs: Extra Backtester keyword arguments (e.g., initial_cash).
+            process_manager: Optional ProcessManager; one is created per run if
+                omitted. A supplied manager's pool is left running after each run.
+        """
+        self.logger = get_logger(self.__class__.__name__)
+        self.store = store
+        self.strategy_factory = strategy_factory
+        self.portfolio_manager_factory = portfolio_manager_factory
+        self.backtest_kwargs = dict(backtest_kwargs or {})
+        self.process_manager = process_manager
+
+    def run(
+        self, param_sets: list[dict[str, Any]], chunk_size: int = 8
+    ) -> Iterator[SweepResult]:
+        """Backtest every parameter set, yielding results as chunks finish.
+
+        The shared memory blocks live until the iterator is exhausted or
+        closed. A pool the sweep created is recycled then too; a caller's pool
+        is left running, and on early exit its pending chunks finish against
+        unlinked blocks and fail without being reported.
+
+        Args:
+            param_sets: Parameter sets to evaluate.
+            chunk_size: Parameter sets per worker task.
+
+        Yields:
+            SweepResult per parameter set, in completion order.
+        """
+        owns_pool = self.process_manager is None
+        manager = self.process_manager or ProcessManager()
+        start = time.perf_counter()
+        completed = failed = 0
+
+        with SharedBarStore(self.store) as shared:
+            tasks = [
+                _SweepTask(
+                    handle=shared.handle,
+                    strategy_factory=self.strategy_factory,
+                    portfolio_manager_factory=self.portfolio_manager_factory,
+                    backtest_kwargs=self.backtest_kwargs,
+                    param_sets=chunk,
+                )
+                for chunk in chunked(param_sets, chunk_size)
+            ]
+            self.logger.info(f"Sweeping {len(param_sets)} parameter sets in {len(tasks)} chunks")
+            finished = False
+            try:
+                for results in manager.imap_unordered(_run_chunk, tasks):
+                    for result in results:
+                        completed += 1
+                        if result.error is not None:
+                            failed += 1
+                            self.logger.warning(f"Backtest {result.params} failed: {result.error}")
+                        yield result
+                finished = True
+            finally:
+                # Workers cache their mapping of the shared blocks, so recycle our
+                # own pool with the blocks; abandon pending chunks on early exit
+                if owns_pool and finished:
+                    manager.close_pool()
+                elif owns_pool:
+                    manager.terminate_pool()
+
+        self.logger.info(
+            f"Sweep finished: {completed} backtests ({failed} failed) "
+            f"in {time.perf_counter() - start:.1f}s"
+        )
@@ -0,0 +1,174 @@
+"""Command-line entry point for SMA crossover parameter sweeps.
+
+This script sweeps short/long SMA windows over stored bars and prints one JSON
+line per parameter set as soon as it completes. Two engines are available:
+
+- python: backtests SmaCrossoverStrategy through the full Engine stack with
+  ParameterSweep (grid or random search).
+- rust: exports each symbol's closes to CSV and streams the output of the
+  algo_trader_rust ``sweep`` subcommand, which evaluates the sma_crossover
+  scanner rule in parallel threads (grid only).
+
+Example:
+    python -m system.algo_trader.infra.backtest.sweep_cli --parquet bars.parquet \\
+        --symbols AAPL MSFT --short 5:50:5 --long 20:200:10 --chunk-size 16
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+
+import numpy as np
+
+from infrastructure.config import ProcessConfig, SQLiteConfig
+from infrastructure.logging.logger import get_logger
+from infrastructure.multiprocess.process_manager import ProcessManager
+from infrastructure.sqlite.sqlite import BaseSQLiteClient
+from system.algo_trader.infra.backtest.bar_store import BarStore
+from system.algo_trader.infra.backtest.sma_crossover import SmaCrossoverStrategy
+from system.algo_trader.infra.backtest.sweep import ParameterSweep, grid, random_search
+
+logger = get_logger("sweep_cli")
+
+
+def parse_range(spec: str) -> list[int]:
+    """Parse an inclusive start:end[:step] range or a single integer.
+
+    Args:
+        spec: Range specification (e.g., "5:50:5").
+
+    Returns:
+        Window sizes in the range.
+
+    Raises:
+        argparse.ArgumentTypeError: If the specification is malformed.
+    """
+    try:
+        parts = [int(part) for part in spec.split(":")]
+    except ValueError as e:
+        raise argparse.ArgumentTypeError(f"invalid range '{spec}'") from e
+    if len(parts) == 1:
+        return parts
+    if len(parts) in (2, 3) and (len(parts) == 2 or parts[2] > 0):
+        step = parts[2] if len(parts) == 3 else 1
+        return list(range(parts[0], parts[1] + 1, step))
+    raise argparse.ArgumentTypeError(f"invalid range '{spec}': expected start:end[:step]")
+
+
+def load_store(args: argparse.Namespace) -> BarStore:
+    """Load bars from the Parquet file or SQLite database named on the command line."""
+    if args.parquet:
+        return BarStore.from_parquet(args.parquet, symbols=args.symbols, frequency=args.frequency)
+    client = BaseSQLiteClient(SQLiteConfig(db_path=args.sqlite))
+    try:
+        return BarStore.from_sqlite(
+            client, table=args.table, symbols=args.symbols, frequency=args.frequency
+        )
+    finally:
+        client.close()
+
+
+def _emit(record: dict) -> None:
+    sys.stdout.write(json.dumps(record) + "\n")
+    sys.stdout.flush()
+
+
+def run_python(args: argparse.Namespace, store: BarStore) -> None:
+    """Sweep SmaCrossoverStrategy through the Engine across a process pool."""
+    if args.random:
+        space = {
+            "short_window": (min(args.short), max(args.short)),
+            "long_window": (min(args.long), max(args.long)),
+        }
+        param_sets = random_search(space, args.random, seed=args.seed)
+    else:
+        param_sets = grid({"short_window": args.short, "long_window": args.long})
+    param_sets = [
+        {**params, "quantity": args.quantity}
+        for params in param_sets
+        if params["short_window"] < params["long_window"]
+    ]
+
+    sweep = ParameterSweep(
+        store,
+        SmaCrossoverStrategy,
+        backtest_kwargs={"initial_cash": args.initial_cash, "columnar": True},
+        process_manager=ProcessManager(ProcessConfig(max_processes=args.processes)),
+    )
+    for result in sweep.run(param_sets, chunk_size=args.chunk_size):
+        _emit(result.to_dict())
+
+
+def run_rust(args: argparse.Namespace, store: BarStore) -> None:
+    """Stream the Rust sma_crossover sweep for each symbol's closes."""
+    if args.random:
+        raise SystemExit("--random is only supported by the python engine")
+
+    with tempfile.TemporaryDirectory() as tmp:
+        for j, symbol in enumerate(store.symbols):
+            closes = store.close[:, j]
+            closes = closes[~np.isnan(closes)]
+            path = Path(tmp) / f"{symbol}.csv"
+            path.write_text("close\n" + "\n".join(repr(float(c)) for c in closes) + "\n")
+
+            command = [
+                args.rust_bin,
+                "sweep",
+                str(path),
+                "--short",
+                args.short_spec,
+                "--long",
+                args.long_spec,
+            ]
+            if args.processes:
+                command += ["--threads", str(args.processes)]
+            logger.info(f"Running {' '.join(command)}")
+
+            with subprocess.Popen(command, stdout=subprocess.PIPE, text=True) as process:
+                for line in process.stdout:
+                    _emit({"symbol": symbol, **json.loads(line)})
+            if process.returncode != 0:
+                raise SystemExit(f"{args.rust_bin} exited with status {process.returncode}")
+
+
+def main(argv: list[str] | None = None) -> None:
+    """Parse arguments and run the selected sweep engine."""
+    parser = argparse.ArgumentParser(description="SMA crossover parameter sweep")
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--parquet", help="Long-format Parquet file of bars")
+    source.add_argument("--sqlite", help="SQLite database holding a bars table")
+    parser.add_argument("--table", default="bars", help="SQLite table name")
+    parser.add_argument("--symbols", nargs="+", help="Symbols to load (default: all)")
+    parser.add_argument("--frequency", default="1D", help="Bar frequency label")
+    parser.add_argument("--engine", choices=["python", "rust"], default="python")
+    parser.add_argument("--short", dest="short_spec", default="5:50:5")
+    parser.add_argument("--long", dest="long_spec", default="20:200:10")
+    parser.add_argument("--random", type=int, default=0, help="Random samples instead of grid")
+    parser.add_argument("--seed", type=int, default=None)
+    parser.add_argument("--quantity", type=int, default=100, help="Shares per entry (python)")
+    parser.add_argument("--initial-cash", type=float, default=100_000.0)
+    parser.add_argument("--chunk-size", type=int, default=8, help="Parameter sets per task")
+    parser.add_argument("--processes", type=int, default=None, help="Workers or threads")
+    parser.add_argument("--rust-bin", default="algo_trader_rust", help="Rust binary path")
+    args = parser.parse_args(argv)
+    try:
+        args.short = parse_range(args.short_spec)
+        args.long = parse_range(args.long_spec)
+    except argparse.ArgumentTypeError as e:
+        parser.error(str(e))
+
+    store = load_store(args)
+    logger.info(f"Loaded {len(store)} bars x {len(store.symbols)} symbols")
+    if args.engine == "python":
+        run_python(args, store)
+    else:
+        run_rust(args, store)
+
+
+if __name__ == "__main__":
+    main()
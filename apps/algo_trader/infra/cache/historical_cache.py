@@ -0,0 +1,253 @@
+"""Incremental in-memory cache for historical OHLCV data.
+
+This module provides CachingHistoricalPort, a HistoricalPort decorator that
+keeps each (symbol, frequency) window in a fixed-size ring buffer. The first
+request per key fetches the full window; later ticks only fetch bars from the
+last cached timestamp on, overwrite that bar (it may still have been forming)
+and append the newer ones.
+"""
+
+import threading
+from dataclasses import dataclass
+
+import numpy as np
+import pandas as pd
+
+from infrastructure.logging.logger import get_logger
+from system.algo_trader.domain.models import HistoricalOHLCV
+from system.algo_trader.domain.ports.historical_port import (
+    HistoricalPort,
+    IncrementalHistoricalPort,
+)
+
+
+@dataclass
+class CacheStats:
+    """Hit and miss counters for CachingHistoricalPort.
+
+    Attributes:
+        hits: Lookups served from cache with an incremental fetch.
+        misses: Lookups that required a full-window fetch.
+        bars_fetched: Total bars received from the source.
+    """
+
+    hits: int = 0
+    misses: int = 0
+    bars_fetched: int = 0
+
+
+class BarRingBuffer:
+    """Fixed-capacity ring buffer of OHLCV bars for a single symbol.
+
+    Timestamps are stored as UTC datetime64[ns] and values as a column-major
+    float64 matrix, so appending a few bars never reallocates.
+
+    Args:
+        capacity: Maximum number of bars retained.
+        columns: Column names stored for each bar.
+        tz: Timezone of the source index, restored on read.
+    """
+
+    def __init__(self, capacity: int, columns: list[str], tz=None):
+        """Allocate the ring buffer storage.
+
+        Args:
+            capacity: Maximum number of bars retained.
+            columns: Column names stored for each bar.
+            tz: Timezone of the source index, restored on read.
+        """
+        if capacity <= 0:
+            raise ValueError("capacity must be positive")
+        self.capacity = capacity
+        self.columns = list(columns)
+        self.tz = tz
+        self._index = np.empty(capacity, dtype="datetime64[ns]")
+        self._values = np.empty((len(self.columns), capacity), dtype=np.float64)
+        self._head = 0
+        self._count = 0
+
+    def __len__(self) -> int:
+        """Return the number of bars currently held."""
+        return self._count
+
+    def last_timestamp(self) -> pd.Timestamp | None:
+        """Return the newest cached bar timestamp, or None if empty."""
+        if self._count == 0:
+            return None
+        ts = pd.Timestamp(self._index[(self._head - 1) % self.capacity])
+        return ts.tz_localize("UTC").tz_convert(self.tz) if self.tz is not None else ts
+
+    def append(self, frame: pd.DataFrame) -> int:
+        """Append bars newer than the last cached timestamp.
+
+        A bar with the same timestamp as the last cached one replaces it, so a
+        bar that was still forming when it was cached picks up its latest
+        high, low, close and volume. Older bars are ignored.
+
+        Args:
+            frame: Bars indexed by timestamp, oldest first.
+
+        Returns:
+            Number of bars appended.
+        """
+        if frame.empty:
+            return 0
+
+        index = frame.index
+        if self.tz is not None:
+            index = index.tz_convert("UTC").tz_localize(None)
+        timestamps = index.to_numpy(dtype="datetime64[ns]")
+        values = frame.reindex(columns=self.columns).to_numpy(dtype=np.float64).T
+
+        if self._count:
+            last_slot = (self._head - 1) % self.capacity
+            last = self._index[last_slot]
+            same = np.flatnonzero(timestamps == last)
+            if len(same):
+                self._values[:, last_slot] = values[:, same[-1]]
+            newer = timestamps > last
+            timestamps = timestamps[newer]
+            values = values[:, newer]
+
+        n = len(timestamps)
+        if n == 0:
+            return 0
+        if n > self.capacity:
+            timestamps = timestamps[-self.capacity :]
+            values = values[:, -self.capacity :]
+            n = self.capacity
+
+        positions = (self._head + np.arange(n)) % self.capacity
+        self._index[positions] = timestamps
+        self._values[:, positions] = values
+        self._head = (self._head + n) % self.capacity
+        self._count = min(self.capacity, self._count + n)
+        return n
+
+    def to_frame(self) -> pd.DataFrame:
+        """Return cached bars as a DataFrame, oldest first."""
+        order = (self._head - self._count + np.arange(self._count)) % self.capacity
+        index = pd.DatetimeIndex(self._index[order])
+        if self.tz is not None:
+            index = index.tz_localize("UTC").tz_convert(self.tz)
+        return pd.DataFrame(
+            {name: self._values[i, order] for i, name in enumerate(self.columns)},
+            index=index,
+        )
+
+
+class CachingHistoricalPort(HistoricalPort):
+    """HistoricalPort decorator that caches windows and fetches incrementally.
+
+    Each get_data() call asks the source only for bars from the newest cached
+    timestamp per (symbol, frequency) on, so steady-state payloads are a
+    handful of rows instead of the whole window. The newest cached bar is
+    refetched because it may still be forming.
+
+    Args:
+        source: Incremental per-symbol bar source.
+        symbols: Symbols included in each HistoricalOHLCV.
+        period: Period label reported on HistoricalOHLCV (e.g., "1Y").
+        frequency: Bar frequency requested from the source (e.g., "1D").
+        window_bars: Bars retained per symbol; size it to the longest lookback
+            the strategy reads.
+    """
+
+    def __init__(
+        self,
+        source: IncrementalHistoricalPort,
+        symbols: list[str],
+        period: str,
+        frequency: str,
+        window_bars: int,
+    ):
+        """Initialize the cache with an empty buffer per symbol.
+
+        Args:
+            source: Incremental per-symbol bar source.
+            symbols: Symbols included in each HistoricalOHLCV.
+            period: Period label reported on HistoricalOHLCV (e.g., "1Y").
+            frequency: Bar frequency requested from the source (e.g., "1D").
+            window_bars: Bars retained per symbol; size it to the longest lookback
+                the strategy reads.
+        """
+        self.logger = get_logger(self.__class__.__name__)
+        self.source = source
+        self.symbols = list(symbols)
+        self.period = period
+        self.frequency = frequency
+        self.window_bars = window_bars
+        self.stats = CacheStats()
+        self._buffers: dict[tuple[str, str], BarRingBuffer] = {}
+        self._lock = threading.Lock()
+
+    def _refresh(self, symbol: str) -> BarRingBuffer:
+        """Bring one symbol's buffer up to date with the source.
+
+        Args:
+            symbol: Symbol to refresh.
+
+        Returns:
+            Up-to-date ring buffer for the symbol.
+        """
+        key = (symbol, self.frequency)
+        buffer = self._buffers.get(key)
+
+        if buffer is None or len(buffer) == 0:
+            self.stats.misses += 1
+            frame = self.source.get_bars(symbol, self.frequency, since=None)
+            self.stats.bars_fetched += len(frame)
+            buffer = BarRingBuffer(
+                self.window_bars, list(frame.columns), getattr(frame.index, "tz", None)
+            )
+            buffer.append(frame)
+            self._buffers[key] = buffer
+            self.logger.debug(f"Cache miss {key}: loaded {len(buffer)} bars")
+            return buffer
+
+        self.stats.hits += 1
+        since = buffer.last_timestamp().to_pydatetime()
+        frame = self.source.get_bars(symbol, self.frequency, since=since)
+        self.stats.bars_fetched += len(frame)
+        appended = buffer.append(frame)
+        self.logger.debug(f"Cache hit {key}: refreshed last bar, appended {appended} bars")
+        return buffer
+
+    def get_data(self) -> HistoricalOHLCV:
+        """Return the cached window for every symbol, fetching only new bars.
+
+        Returns:
+            HistoricalOHLCV covering the configured symbols.
+        """
+        with self._lock:
+            data = {symbol: self._refresh(symbol).to_frame() for symbol in self.symbols}
+
+        starts = [frame.index[0] for frame in data.values() if len(frame)]
+        ends = [frame.index[-1] for frame in data.values() if len(frame)]
+        return HistoricalOHLCV(
+            period=self.period,
+            frequency=self.frequency,
+            start=min(starts).to_pydatetime() if starts else None,
+            end=max(ends).to_pydatetime() if ends else None,
+            data=data,
+        )
+
+    def invalidate(self, symbol: str | None = None) -> None:
+        """Drop cached bars so the next get_data() refetches the full window.
+
+        Args:
+            symbol: Symbol to drop, or None to clear every symbol.
+        """
+        with self._lock:
+            if symbol is None:
+                self._buffers.clear()
+            else:
+                self._buffers.pop((symbol, self.frequency), None)
+
+    def get_stats(self) -> dict[str, int]:
+        """Return cache hit, miss and fetched-bar counts."""
+        return {
+            "hits": self.stats.hits,
+            "misses": self.stats.misses,
+            "bars_fetched": self.stats.bars_fetched,
+        }
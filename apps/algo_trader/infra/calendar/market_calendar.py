@@ -0,0 +1,172 @@
+"""Cached market session calendar.
+
+This module provides MarketCalendar, which keeps each day's session windows
+(pre-market, regular and post-market hours as MarketHours) in memory and,
+optionally, in Redis through MarketCalendarBroker so processes share what one
+of them fetched. Days are fetched once per max_age_s, and prefetch() loads
+the weeks ahead in one go so scheduling never waits on the API.
+"""
+
+from __future__ import annotations
+
+import threading
+import time
+from collections.abc import Callable, Iterable
+from datetime import date, datetime, timedelta, timezone
+from typing import Any
+
+from infrastructure.logging.logger import get_logger
+from system.algo_trader.domain.models import MarketHours
+from system.algo_trader.domain.states import MarketStatus
+from system.algo_trader.infra.redis.market_calendar import MarketCalendarBroker
+
+# Sessions during which the engine trades
+ACTIVE_STATUSES = frozenset({MarketStatus.PRE_MARKET, MarketStatus.OPEN, MarketStatus.POST_MARKET})
+
+SessionFetch = Callable[[date], list[MarketHours] | None]
+
+
+def _to_dict(hours: MarketHours) -> dict[str, Any]:
+    return {
+        "timestamp": hours.timestamp.isoformat(),
+        "status": hours.status.value,
+        "start": hours.start.isoformat(),
+        "end": hours.end.isoformat(),
+    }
+
+
+def _from_dict(data: dict[str, Any]) -> MarketHours:
+    return MarketHours(
+        timestamp=datetime.fromisoformat(data["timestamp"]),
+        status=MarketStatus(data["status"]),
+        start=datetime.fromisoformat(data["start"]),
+        end=datetime.fromisoformat(data["end"]),
+    )
+
+
+class MarketCalendar:
+    """Session calendar backed by memory, an optional Redis store and the API.
+
+    Args:
+        fetch: Returns a day's session windows ([] when the market is closed)
+            or None if they could not be fetched, e.g.
+            MarketHandler.get_session_hours.
+        store: Optional Redis store shared with other processes.
+        market: Market name used in store keys.
+        lookahead_days: Days prefetch() loads and next_window() searches.
+        max_age_s: Seconds a fetched day is trusted before it is fetched again.
+    """
+
+    def __init__(  # noqa: PLR0913
+        self,
+        fetch: SessionFetch,
+        store: MarketCalendarBroker | None = None,
+        market: str = "equity",
+        lookahead_days: int = 21,
+        max_age_s: float = 6 * 60 * 60,
+    ):
+        """Initialize the calendar.
+
+        Args:
+            fetch: Returns a day's session windows, or None on failure.
+            store: Optional Redis store shared with other processes.
+            market: Market name used in store keys.
+            lookahead_days: Days prefetch() loads and next_window() searches.
+            max_age_s: Seconds a fetched day is trusted.
+        """
+        self.logger = get_logger(self.__class__.__name__)
+        self.fetch = fetch
+        self.store = store
+        self.market = market
+        self.lookahead_days = lookahead_days
+        self.max_age_s = max_age_s
+        self._lock = threading.Lock()
+        self._days: dict[date, tuple[float, list[MarketHours]]] = {}
+
+    def _load(self, day: date) -> list[MarketHours] | None:
+        """Read a day from the store, falling back to the API."""
+        if self.store is not None:
+            cached = self.store.get_sessions(self.market, day)
+            if cached is not None:
+                return [_from_dict(window) for window in cached]
+
+        hours = self.fetch(day)
+        if hours is None:
+            self.logger.warning(f"Session hours for {day} unavailable")
+            return None
+        hours = sorted(hours, key=lambda window: window.start)
+        if self.store is not None:
+            self.store.set_sessions(
+                self.market, day, [_to_dict(window) for window in hours], ttl=int(self.max_age_s)
+            )
+        return hours
+
+    def sessions(self, day: date) -> list[MarketHours] | None:
+        """Return a day's session windows in start order.
+
+        A day whose refetch fails keeps serving its previous windows.
+
+        Args:
+            day: Trading date.
+
+        Returns:
+            Session windows ([] if the market is closed), or None if the day
+            has never been fetched successfully.
+        """
+        now = time.monotonic()
+        with self._lock:
+            cached = self._days.get(day)
+        if cached is not None and now - cached[0] < self.max_age_s:
+            return cached[1]
+
+        hours = self._load(day)
+        if hours is None:
+            return cached[1] if cached is not None else None
+        with self._lock:
+            self._days[day] = (now, hours)
+        return hours
+
+    def prefetch(self, start: date | None = None, days: int | None = None) -> int:
+        """Load consecutive days into the cache.
+
+        Args:
+            start: First day; defaults to today (UTC).
+            days: Number of days; defaults to lookahead_days.
+
+        Returns:
+            Number of days now available.
+        """
+        start = start or datetime.now(timezone.utc).date()
+        days = self.lookahead_days if days is None else days
+        loaded = sum(
+            self.sessions(start + timedelta(days=offset)) is not None for offset in range(days)
+        )
+        self.logger.info(f"Prefetched {loaded}/{days} days of {self.market} session hours")
+        return loaded
+
+    def next_window(
+        self, at: datetime, statuses: Iterable[MarketStatus] = ACTIVE_STATUSES
+    ) -> MarketHours | None:
+        """Return the window containing at, or else the next one to start.
+
+        Searches from the day before at (post-market sessions run past
+        midnight UTC) through lookahead_days ahead.
+
+        Args:
+            at: Timezone-aware instant.
+            statuses: Session types to consider.
+
+        Returns:
+            The first window with end >= at, or None if there is none within
+            the lookahead or a day on the way could not be fetched.
+        """
+        statuses = frozenset(statuses)
+        day = at.astimezone(timezone.utc).date() - timedelta(days=1)
+        for offset in range(self.lookahead_days + 2):
+            hours = self.sessions(day + timedelta(days=offset))
+            if hours is None:
+                return None
+            for window in hours:
+                if window.status in statuses and window.end >= at:
+                    return window
+        return None
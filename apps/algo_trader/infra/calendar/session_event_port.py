@@ -0,0 +1,158 @@
+"""Session-aware scheduled tick source.
+
+This module provides SessionTickEventPort, an EventPort that emits
+TickReason.SCHEDULED ticks on bar boundaries (multiples of bar_interval_s
+since the epoch) while the market is in an active session, and sleeps
+through closed hours, weekends and holidays instead of ticking every
+interval and discarding ticks outside the session.
+"""
+
+from __future__ import annotations
+
+import math
+import threading
+import time
+from collections import deque
+from collections.abc import Callable, Iterable
+from datetime import datetime, timezone
+
+from infrastructure.logging.logger import get_logger
+from system.algo_trader.domain.models import Event
+from system.algo_trader.domain.ports.event_port import EventPort
+from system.algo_trader.domain.states import EventType, MarketStatus, TickReason
+from system.algo_trader.infra.calendar.market_calendar import ACTIVE_STATUSES, MarketCalendar
+
+# Bound on windows skipped in one next_tick call
+_MAX_WINDOWS = 16
+
+
+class SessionTickEventPort(EventPort):
+    """EventPort emitting SCHEDULED ticks aligned to bar boundaries during sessions.
+
+    Ticks fall on bar boundaries inside the calendar's windows with one of
+    the given statuses (window edges included). A tick the engine was too
+    busy to take is not replayed: the next one is the latest boundary that
+    has passed. Commands passed to submit() are returned ahead of ticks.
+
+    Args:
+        calendar: Session calendar.
+        bar_interval_s: Bar length in seconds.
+        statuses: Session types during which to tick.
+        retry_s: Seconds to wait before asking the calendar again when it
+            has no window.
+        max_sleep_s: Longest single wait, so clock changes and calendar
+            refreshes are picked up.
+        clock: Optional callable returning the current time.
+    """
+
+    def __init__(  # noqa: PLR0913
+        self,
+        calendar: MarketCalendar,
+        bar_interval_s: float = 60.0,
+        statuses: Iterable[MarketStatus] = ACTIVE_STATUSES,
+        retry_s: float = 60.0,
+        max_sleep_s: float = 30.0,
+        clock: Callable[[], datetime] | None = None,
+    ):
+        """Initialize the port.
+
+        Args:
+            calendar: Session calendar.
+            bar_interval_s: Bar length in seconds.
+            statuses: Session types during which to tick.
+            retry_s: Seconds to wait when the calendar has no window.
+            max_sleep_s: Longest single wait.
+            clock: Optional callable returning the current time.
+        """
+        self.logger = get_logger(self.__class__.__name__)
+        self.calendar = calendar
+        self.bar_interval_s = bar_interval_s
+        self.statuses = frozenset(statuses)
+        self.retry_s = retry_s
+        self.max_sleep_s = max_sleep_s
+        self.clock = clock or (lambda: datetime.now(timezone.utc))
+        self.ticks = 0
+        self.last_tick: float | None = None
+        self._first_call: float | None = None
+        self._changed = threading.Condition()
+        self._commands: deque[Event] = deque()
+
+    def submit(self, event: Event) -> None:
+        """Queue a command event ahead of pending ticks.
+
+        Args:
+            event: Event to return from the next wait_for_event.
+        """
+        with self._changed:
+            self._commands.append(event)
+            self._changed.notify_all()
+
+    def _ceil(self, ts: float) -> float:
+        return math.ceil(ts / self.bar_interval_s) * self.bar_interval_s
+
+    def next_tick(self, now: datetime) -> datetime | None:
+        """Return the due time of the next tick.
+
+        Args:
+            now: Current time (timezone-aware).
+
+        Returns:
+            Due time of the next tick, which is at or before now if one is
+            due, or None if the calendar has no upcoming window.
+        """
+        now_ts = now.timestamp()
+        if self.last_tick is None:
+            # Before the first tick, start from the boundary after the first call
+            if self._first_call is None:
+                self._first_call = now_ts
+            earliest = self._ceil(self._first_call)
+        else:
+            earliest = self.last_tick + self.bar_interval_s
+        latest = math.floor(now_ts / self.bar_interval_s) * self.bar_interval_s
+        candidate = max(earliest, latest)
+
+        for _ in range(_MAX_WINDOWS):
+            at = datetime.fromtimestamp(candidate, tz=timezone.utc)
+            window = self.calendar.next_window(at, self.statuses)
+            if window is None:
+                return None
+            candidate = max(candidate, self._ceil(window.start.timestamp()))
+            if candidate <= window.end.timestamp():
+                return datetime.fromtimestamp(candidate, tz=timezone.utc)
+        return None
+
+    def wait_for_event(self, timeout_s: float | None) -> Event | None:
+        """Wait for a command or the next scheduled tick.
+
+        Args:
+            timeout_s: Optional timeout in seconds. None means wait indefinitely.
+
+        Returns:
+            Command or TICK event, or None on timeout.
+        """
+        deadline = None if timeout_s is None else time.monotonic() + timeout_s
+        while True:
+            with self._changed:
+                if self._commands:
+                    return self._commands.popleft()
+
+            now = self.clock()
+            due = self.next_tick(now)
+            if due is not None and now >= due:
+                self.last_tick = due.timestamp()
+                self.ticks += 1
+                return Event(timestamp=due, type=EventType.TICK, reason=TickReason.SCHEDULED)
+
+            if due is None:
+                self.logger.debug(f"No session window ahead; retrying in {self.retry_s}s")
+            wait_s = self.retry_s if due is None else (due - now).total_seconds()
+            wait_s = min(wait_s, self.max_sleep_s)
+            if deadline is not None:
+                remaining = deadline - time.monotonic()
+                if remaining <= 0:
+                    return None
+                wait_s = min(wait_s, remaining)
+
+            with self._changed:
+                if not self._commands:
+                    self._changed.wait(wait_s)
@@ -0,0 +1,335 @@
+"""Asynchronous, batched JournalPort implementation.
+
+This module provides BatchedJournalPort, which takes journaling off the engine
+tick path: report_* calls only append the entry to a bounded in-memory queue,
+and a background writer thread serializes entries and hands them to a
+JournalSink in batches. A backpressure policy decides what happens when the
+sink falls behind, and writer metrics expose queue depth and flush latency.
+"""
+
+from __future__ import annotations
+
+import threading
+import time
+from collections import deque
+from collections.abc import Callable
+from dataclasses import dataclass
+from enum import Enum
+from typing import Any
+
+from infrastructure.logging.logger import get_logger
+from system.algo_trader.domain.models import JournalError, JournalInput, JournalOutput
+from system.algo_trader.domain.ports.journal_port import JournalPort
+from system.algo_trader.infra.journal.sinks import JournalRecord, JournalSink, encode_entry
+
+
+class BackpressurePolicy(Enum):
+    """Behavior when the journal queue is full.
+
+    DROP discards new entries once the queue is full. BLOCK stalls the caller
+    until the writer frees space. SAMPLE keeps only every Nth entry once the
+    queue passes its high-water mark and drops entries when it is full.
+    """
+
+    DROP = "DROP"
+    BLOCK = "BLOCK"
+    SAMPLE = "SAMPLE"
+
+
+@dataclass
+class JournalWriterMetrics:
+    """Snapshot of journal writer counters.
+
+    Attributes:
+        queue_depth: Entries waiting to be written.
+        max_queue_depth: Highest queue depth observed.
+        enqueued: Entries accepted onto the queue.
+        dropped: Entries discarded because the queue was full.
+        sampled_out: Entries skipped by the SAMPLE policy.
+        processed: Entries the writer has finished with, written or failed.
+        written: Entries persisted by the sink.
+        failed: Entries lost to serialization or sink errors.
+        records_written: Records persisted by the sink; exceeds written when
+            the encoder splits entries across several records.
+        batches: Batches handed to the sink.
+        last_flush_ms: Latency of the most recent batch.
+        max_flush_ms: Slowest batch latency.
+        total_flush_ms: Sum of batch latencies.
+    """
+
+    queue_depth: int = 0
+    max_queue_depth: int = 0
+    enqueued: int = 0
+    dropped: int = 0
+    sampled_out: int = 0
+    processed: int = 0
+    written: int = 0
+    failed: int = 0
+    records_written: int = 0
+    batches: int = 0
+    last_flush_ms: float = 0.0
+    max_flush_ms: float = 0.0
+    total_flush_ms: float = 0.0
+
+    @property
+    def mean_flush_ms(self) -> float:
+        """Return the mean batch latency in milliseconds."""
+        return self.total_flush_ms / self.batches if self.batches else 0.0
+
+
+class BatchedJournalPort(JournalPort):
+    """JournalPort that queues entries and writes them in background batches.
+
+    The enqueue path takes no lock: entries are appended to a deque (atomic
+    under the GIL) and the writer is only signalled once a full batch is
+    waiting; otherwise it wakes every flush_interval_s. Serialization and sink
+    I/O happen on the writer thread. Errors are always queued, bypassing the
+    backpressure policy, so failures are never lost to sampling.
+
+    Args:
+        sink: Destination for serialized record batches.
+        max_queue_size: Queue capacity for input and output entries.
+        batch_size: Maximum records per sink write.
+        flush_interval_s: Maximum time an entry waits before being flushed.
+        policy: Behavior when the queue is full.
+        sample_every: SAMPLE policy keeps one in this many entries.
+        sample_threshold: Queue fill fraction at which SAMPLE starts skipping.
+        include_history: Serialize full historical bars (else bar counts).
+        encoder: Optional callable turning (kind, entry) into a JournalRecord
+            or a list of them (e.g., DeltaJournalEncoder); defaults to JSON via
+            encode_entry.
+    """
+
+    def __init__(  # noqa: PLR0913
+        self,
+        sink: JournalSink,
+        max_queue_size: int = 10_000,
+        batch_size: int = 100,
+        flush_interval_s: float = 1.0,
+        policy: BackpressurePolicy = BackpressurePolicy.DROP,
+        sample_every: int = 10,
+        sample_threshold: float = 0.5,
+        include_history: bool = True,
+        encoder: Callable[[str, Any], JournalRecord | list[JournalRecord]] | None = None,
+    ):
+        """Initialize the port and start the writer thread.
+
+        Args:
+            sink: Destination for serialized record batches.
+            max_queue_size: Queue capacity for input and output entries.
+            batch_size: Maximum records per sink write.
+            flush_interval_s: Maximum time an entry waits before being flushed.
+            policy: Behavior when the queue is full.
+            sample_every: SAMPLE policy keeps one in this many entries.
+            sample_threshold: Queue fill fraction at which SAMPLE starts skipping.
+            include_history: Serialize full historical bars (else bar counts).
+            encoder: Optional callable turning (kind, entry) into a JournalRecord
+                or a list of them (e.g., DeltaJournalEncoder); defaults to JSON via
+                encode_entry.
+
+        Raises:
+            ValueError: If a size or sampling parameter is not positive.
+        """
+        if max_queue_size <= 0 or batch_size <= 0 or sample_every <= 0:
+            raise ValueError("max_queue_size, batch_size and sample_every must be positive")
+        self.logger = get_logger(self.__class__.__name__)
+        self.sink = sink
+        self.max_queue_size = max_queue_size
+        self.batch_size = batch_size
+        self.flush_interval_s = flush_interval_s
+        self.policy = policy
+        self.sample_every = sample_every
+        self.sample_high_water = max(1, int(max_queue_size * sample_threshold))
+        self.include_history = include_history
+        self.encoder = encoder or self._encode_json
+
+        self._queue: deque[tuple[str, Any]] = deque()
+        self._metrics = JournalWriterMetrics()
+        self._sample_counter = 0
+        self._wake = threading.Event()
+        self._space = threading.Event()
+        self._flushed = threading.Condition()
+        self._closed = False
+        self._thread = threading.Thread(target=self._run, name="journal-writer", daemon=True)
+        self._thread.start()
+
+    def report_input(self, input: JournalInput) -> None:
+        """Queue journal input data.
+
+        Args:
+            input: Journal input containing market and account data.
+        """
+        self._offer("input", input)
+
+    def report_output(self, output: JournalOutput) -> None:
+        """Queue journal output data.
+
+        Args:
+            output: Journal output containing signals and orders.
+        """
+        self._offer("output", output)
+
+    def report_error(self, error: JournalError) -> None:
+        """Queue an engine error, ignoring the backpressure policy.
+
+        Args:
+            error: Journal error containing error details and engine state.
+        """
+        self._append("error", error)
+
+    def _offer(self, kind: str, entry: Any) -> None:
+        """Apply the backpressure policy and queue an entry."""
+        if self._closed:
+            self._metrics.dropped += 1
+            return
+        depth = len(self._queue)
+
+        if self.policy == BackpressurePolicy.SAMPLE and depth >= self.sample_high_water:
+            self._sample_counter += 1
+            if self._sample_counter % self.sample_every:
+                self._metrics.sampled_out += 1
+                return
+
+        if depth >= self.max_queue_size:
+            if self.policy != BackpressurePolicy.BLOCK:
+                self._metrics.dropped += 1
+                return
+            self._wait_for_space()
+
+        self._append(kind, entry)
+
+    def _wait_for_space(self) -> None:
+        """Block until the writer drains the queue below capacity."""
+        while len(self._queue) >= self.max_queue_size and not self._closed:
+            self._space.clear()
+            if len(self._queue) < self.max_queue_size:
+                break
+            self._wake.set()
+            self._space.wait(self.flush_interval_s)
+
+    def _append(self, kind: str, entry: Any) -> None:
+        """Append an entry and wake the writer once a batch is ready."""
+        self._queue.append((kind, entry))
+        metrics = self._metrics
+        metrics.enqueued += 1
+        depth = len(self._queue)
+        if depth > metrics.max_queue_depth:
+            metrics.max_queue_depth = depth
+        if depth >= self.batch_size:
+            self._wake.set()
+
+    def _run(self) -> None:
+        """Writer thread loop: drain on wake-up or every flush interval."""
+        try:
+            while True:
+                self._wake.wait(self.flush_interval_s)
+                self._wake.clear()
+                self._drain()
+                if self._closed and not self._queue:
+                    break
+        finally:
+            try:
+                self.sink.close()
+            except Exception as e:
+                self.logger.warning(f"Error closing journal sink: {e}")
+
+    def _drain(self) -> None:
+        """Write every queued entry in batches of at most batch_size."""
+        while self._queue:
+            entries = []
+            while self._queue and len(entries) < self.batch_size:
+                entries.append(self._queue.popleft())
+            self._space.set()
+            self._write_batch(entries)
+            with self._flushed:
+                self._flushed.notify_all()
+
+    def _encode_json(self, kind: str, entry: Any) -> JournalRecord:
+        """Default encoder: one JSON document per entry."""
+        return encode_entry(kind, entry, self.include_history)
+
+    def _write_batch(self, entries: list[tuple[str, Any]]) -> None:
+        """Serialize entries and write them as one sink batch."""
+        metrics = self._metrics
+        start = time.perf_counter()
+        records = []
+        encoded_entries = 0
+        for kind, entry in entries:
+            try:
+                encoded = self.encoder(kind, entry)
+                if isinstance(encoded, JournalRecord):
+                    records.append(encoded)
+                else:
+                    records.extend(encoded)
+                encoded_entries += 1
+            except Exception as e:
+                metrics.failed += 1
+                self.logger.error(f"Cannot serialize journal {kind} entry: {e}")
+
+        if records:
+            try:
+                self.sink.write(records)
+                metrics.written += encoded_entries
+                metrics.records_written += len(records)
+            except Exception as e:
+                metrics.failed += encoded_entries
+                self.logger.error(f"Journal batch of {len(records)} records failed: {e}")
+        metrics.processed += len(entries)
+
+        elapsed_ms = (time.perf_counter() - start) * 1000.0
+        metrics.batches += 1
+        metrics.last_flush_ms = elapsed_ms
+        metrics.max_flush_ms = max(metrics.max_flush_ms, elapsed_ms)
+        metrics.total_flush_ms += elapsed_ms
+
+    def metrics(self) -> JournalWriterMetrics:
+        """Return a snapshot of the writer metrics.
+
+        Returns:
+            JournalWriterMetrics with the current queue depth.
+        """
+        snapshot = JournalWriterMetrics(**vars(self._metrics))
+        snapshot.queue_depth = len(self._queue)
+        return snapshot
+
+    def flush(self, timeout_s: float = 5.0) -> bool:
+        """Write all queued entries now and wait for them to reach the sink.
+
+        Args:
+            timeout_s: Maximum time to wait.
+
+        Returns:
+            True if everything enqueued so far was processed, False on timeout.
+        """
+        target = self._metrics.enqueued
+        deadline = time.monotonic() + timeout_s
+
+        def processed() -> bool:
+            return self._metrics.processed >= target
+
+        self._wake.set()
+        with self._flushed:
+            while not processed():
+                remaining = deadline - time.monotonic()
+                if remaining <= 0 or not self._thread.is_alive():
+                    return processed()
+                self._flushed.wait(min(remaining, self.flush_interval_s))
+        return True
+
+    def close(self, timeout_s: float = 10.0) -> None:
+        """Flush remaining entries, stop the writer and close the sink.
+
+        Args:
+            timeout_s: Maximum time to wait for the writer thread.
+        """
+        self._closed = True
+        self._space.set()
+        self._wake.set()
+        self._thread.join(timeout_s)
+        if self._thread.is_alive():
+            self.logger.warning(f"Journal writer still running with {len(self._queue)} entries")
+        metrics = self.metrics()
+        self.logger.info(
+            f"Journal closed: {metrics.written} written, {metrics.dropped} dropped, "
+            f"{metrics.sampled_out} sampled out, {metrics.failed} failed"
+        )
@@ -0,0 +1,703 @@
+"""Delta-encoded journal inputs.
+
+This module provides DeltaEncoder, which turns a stream of JournalInput entries
+into frames holding a full keyframe every N ticks and only what changed in
+between (new bars, changed quotes, changed positions, open-order and order
+status transitions), and DeltaJournalReader, which rebuilds the JournalInput
+of any tick from those frames. DeltaJournalEncoder plugs the format into
+BatchedJournalPort, splitting frames too large for one record.
+
+Rebuilt inputs compare equal to the originals field by field; DataFrames are
+equal under DataFrame.equals with identical columns, dtypes and index.
+Frames are stored as typed JSON (see frame_codec), never pickled.
+"""
+
+from __future__ import annotations
+
+import copy
+from collections.abc import Callable, Hashable, Iterable, Iterator
+from dataclasses import fields, is_dataclass, replace
+from typing import Any
+
+import numpy as np
+import pandas as pd
+
+from infrastructure.logging.logger import get_logger
+from infrastructure.sqlite.sqlite import BaseSQLiteClient
+from system.algo_trader.domain.models import (
+    HistoricalOHLCV,
+    JournalInput,
+    OHLCVPanel,
+    Quote,
+    QuoteBatch,
+)
+from system.algo_trader.infra.journal import frame_codec
+from system.algo_trader.infra.journal.sinks import JournalRecord, encode_entry
+
+KEY_KIND = "input.key"
+DELTA_KIND = "input.delta"
+# One piece of a frame split across records; see DeltaJournalEncoder
+PART_KIND = "input.part"
+_FRAME_KINDS = (KEY_KIND, DELTA_KIND, PART_KIND)
+
+# Room reserved in each part record for its "seq part parts" header line
+_PART_HEADER_BYTES = 64
+
+# JournalInput fields that are diffed; timestamp and port_latency_ms are always stored
+_DIFFED_FIELDS = (
+    "historical_data",
+    "quote_data",
+    "account_data",
+    "position_data",
+    "open_orders",
+    "portfolio_manager_state",
+    "order_status",
+)
+
+# Quote fields holding per-symbol maps
+_QUOTE_MAPS = ("bid", "ask", "bid_size", "ask_size", "last", "volume", "change", "change_pct")
+
+Delta = tuple[str, Any]
+
+# Identity of items in keyed collections: Positions by symbol, Orders by id
+_ITEM_KEYS: dict[str, Callable[[Any], Hashable]] = {
+    "positions": lambda position: position.symbol,
+    "orders": lambda order: order.id,
+}
+
+
+def _same_array(a: np.ndarray, b: np.ndarray) -> bool:
+    """Return True if two arrays are bitwise identical (NaN-safe)."""
+    if a.dtype != b.dtype or a.shape != b.shape:
+        return False
+    if a.dtype.hasobject:
+        return bool(np.array_equal(a, b))
+    return bool(np.array_equal(a.view(np.uint8), b.view(np.uint8)))
+
+
+def _same(a: Any, b: Any) -> bool:
+    """Return True if two values are equal, treating NaN as equal to NaN."""
+    return a == b or (a != a and b != b)  # noqa: PLR0124
+
+
+def _diff_meta(prev: Any, cur: Any, names: tuple[str, ...]) -> dict[str, Any]:
+    """Return the scalar attributes that changed."""
+    return {
+        name: getattr(cur, name)
+        for name in names
+        if not _same(getattr(prev, name), getattr(cur, name))
+    }
+
+
+# --- Flat dataclasses (Account, PortfolioManager, Position, orders) ---
+
+
+def _diff_object(prev: Any, cur: Any) -> Delta | None:
+    """Diff two flat dataclasses field by field."""
+    if prev is cur:
+        return None
+    if prev is None or cur is None or type(prev) is not type(cur) or not is_dataclass(cur):
+        return ("full", cur)
+    changed = {
+        f.name: getattr(cur, f.name)
+        for f in fields(cur)
+        if not _same(getattr(prev, f.name), getattr(cur, f.name))
+    }
+    return ("fields", changed) if changed else None
+
+
+# --- Flat mappings (order status by id) ---
+
+
+def _diff_map(prev: dict[Hashable, Any], cur: dict[Hashable, Any]) -> Delta | None:
+    """Diff two flat mappings as updated entries plus dropped keys."""
+    updates = {k: v for k, v in cur.items() if k not in prev or not _same(prev[k], v)}
+    dropped = [k for k in prev if k not in cur]
+    return ("map", (updates, dropped)) if updates or dropped else None
+
+
+# --- Keyed collections (Positions by symbol, Orders by id) ---
+
+
+def _diff_items(prev: Any, cur: Any, attr: str) -> Delta | None:
+    """Diff two collections holding a timestamp and a list of keyed items."""
+    key = _ITEM_KEYS[attr]
+    if prev is cur:
+        return None
+    if prev is None or type(prev) is not type(cur):
+        return ("full", cur)
+    prev_items, cur_items = getattr(prev, attr), getattr(cur, attr)
+    prev_keys = [key(item) for item in prev_items]
+    cur_keys = [key(item) for item in cur_items]
+    if len(set(prev_keys)) != len(prev_keys) or len(set(cur_keys)) != len(cur_keys):
+        return ("full", cur)
+
+    by_key = dict(zip(prev_keys, prev_items, strict=True))
+    changes = {}
+    for k, item in zip(cur_keys, cur_items, strict=True):
+        delta = _diff_object(by_key.get(k), item)
+        if delta is not None:
+            changes[k] = delta
+
+    diff: dict[str, Any] = {}
+    if prev.timestamp != cur.timestamp:
+        diff["timestamp"] = cur.timestamp
+    if prev_keys != cur_keys:
+        diff["keys"] = cur_keys
+    if changes:
+        diff["changes"] = changes
+    return ("items", (attr, diff)) if diff else None
+
+
+# --- Quotes ---
+
+
+def _diff_quote(prev: Quote, cur: Quote) -> Delta | None:
+    """Diff per-symbol quote maps; maps whose symbols changed are sent whole."""
+    diff: dict[str, Any] = {"meta": _diff_meta(prev, cur, ("timestamp", "asset_class"))}
+    for name in _QUOTE_MAPS:
+        old, new = getattr(prev, name), getattr(cur, name)
+        if list(old) != list(new):
+            diff[name] = ("full", new)
+            continue
+        updates = {
+            symbol: value for symbol, value in new.items() if not _same(old[symbol], value)
+        }
+        if updates:
+            diff[name] = ("update", updates)
+    return ("quote", diff) if len(diff) > 1 or diff["meta"] else None
+
+
+def _diff_quote_batch(prev: QuoteBatch, cur: QuoteBatch) -> Delta | None:
+    """Diff columnar quotes by sending only symbols whose values changed."""
+    if prev.symbols != cur.symbols:
+        return ("full", cur)
+    changed = np.flatnonzero((prev.values.view(np.int64) != cur.values.view(np.int64)).any(axis=0))
+    meta = _diff_meta(prev, cur, ("timestamp", "asset_class"))
+    if not len(changed) and not meta:
+        return None
+    return ("batch", (meta, changed, cur.values[:, changed].copy()))
+
+
+# --- Historical bars ---
+
+
+def _appended_frame(old: pd.DataFrame, new: pd.DataFrame) -> tuple[int, pd.DataFrame] | None:
+    """Express new as old minus leading rows plus appended rows, if possible."""
+    if (
+        not len(old)
+        or not len(new)
+        or list(old.columns) != list(new.columns)
+        or not old.dtypes.equals(new.dtypes)
+        or old.index.dtype != new.index.dtype
+        or old.index.name != new.index.name
+    ):
+        return None
+    drop = int(old.index.searchsorted(new.index[0]))
+    keep = len(old) - drop
+    if keep > len(new):
+        return None
+    overlap = new.iloc[:keep]
+    if not overlap.index.equals(old.index[drop:]) or not overlap.equals(old.iloc[drop:]):
+        return None
+    return drop, new.iloc[keep:]
+
+
+def _diff_frames(prev: HistoricalOHLCV, cur: HistoricalOHLCV) -> Delta | None:
+    """Diff per-symbol DataFrames as dropped leading rows plus new bars."""
+    changes: dict[str, Delta] = {}
+    for symbol, frame in cur.data.items():
+        old = prev.data.get(symbol)
+        if old is frame:
+            continue
+        appended = _appended_frame(old, frame) if old is not None else None
+        if appended is None:
+            changes[symbol] = ("full", frame)
+        elif appended[0] or len(appended[1]):
+            changes[symbol] = ("append", appended)
+
+    diff = {"meta": _diff_meta(prev, cur, ("period", "frequency", "start", "end"))}
+    if list(prev.data) != list(cur.data):
+        diff["symbols"] = list(cur.data)
+    if not changes and len(diff) == 1 and not diff["meta"]:
+        return None
+    diff["changes"] = changes
+    return ("frames", diff)
+
+
+def _appended_run(
+    old: tuple[np.ndarray, dict[str, np.ndarray]], new: tuple[np.ndarray, dict[str, np.ndarray]]
+) -> int | None:
+    """Return the leading rows dropped from old if new extends its tail, else None."""
+    old_index, old_columns = old
+    new_index, new_columns = new
+    if not len(old_index) or not len(new_index):
+        return None
+    drop = int(np.searchsorted(old_index, new_index[0]))
+    keep = len(old_index) - drop
+    if keep > len(new_index) or not _same_array(old_index[drop:], new_index[:keep]):
+        return None
+    for name, values in old_columns.items():
+        if not _same_array(values[drop:], new_columns[name][:keep]):
+            return None
+    return drop
+
+
+def _panel_run(panel: OHLCVPanel, symbol: str) -> tuple[np.ndarray, dict[str, np.ndarray]]:
+    return panel.symbol_index(symbol), panel.symbol_view(symbol)
+
+
+def _diff_panel(prev: OHLCVPanel, cur: OHLCVPanel) -> Delta | None:
+    """Diff columnar bars per symbol run as dropped leading rows plus new bars."""
+    if list(prev.columns) != list(cur.columns) or prev.index.dtype != cur.index.dtype:
+        return ("full", cur)
+    changes: dict[str, Any] = {}
+    for symbol in cur.symbols:
+        run = _panel_run(cur, symbol)
+        drop = _appended_run(_panel_run(prev, symbol), run) if symbol in prev else None
+        if drop is None:
+            changes[symbol] = ("full", (run[0].copy(), {n: v.copy() for n, v in run[1].items()}))
+            continue
+        keep = len(prev.symbol_index(symbol)) - drop
+        if drop or keep < len(run[0]):
+            tail = (run[0][keep:].copy(), {n: v[keep:].copy() for n, v in run[1].items()})
+            changes[symbol] = ("append", (drop, tail))
+
+    diff = {"meta": _diff_meta(prev, cur, ("period", "frequency", "start", "end"))}
+    if prev.symbols != cur.symbols:
+        diff["symbols"] = cur.symbols
+    if not changes and len(diff) == 1 and not diff["meta"]:
+        return None
+    diff["changes"] = changes
+    return ("panel", diff)
+
+
+# --- Dispatch ---
+
+
+def _diff(name: str, prev: Any, cur: Any) -> Delta | None:
+    """Return the delta turning prev into cur for one JournalInput field."""
+    if prev is cur:
+        return None
+    if prev is None or cur is None or type(prev) is not type(cur):
+        return ("full", cur)
+    if name == "historical_data":
+        return _diff_panel(prev, cur) if isinstance(cur, OHLCVPanel) else _diff_frames(prev, cur)
+    if name == "quote_data":
+        if isinstance(cur, QuoteBatch):
+            return _diff_quote_batch(prev, cur)
+        return _diff_quote(prev, cur)
+    if name == "position_data":
+        return _diff_items(prev, cur, "positions")
+    if name == "open_orders":
+        return _diff_items(prev, cur, "orders")
+    if name == "order_status":
+        return _diff_map(prev, cur)
+    return _diff_object(prev, cur)
+
+
+def _concat_frames(old: pd.DataFrame, drop: int, new: pd.DataFrame) -> pd.DataFrame:
+    parts = [part for part in (old.iloc[drop:], new) if len(part)]
+    if len(parts) == 1:
+        return parts[0]
+    return pd.concat(parts) if parts else new
+
+
+def _apply_frames(prev: HistoricalOHLCV, diff: dict[str, Any]) -> HistoricalOHLCV:
+    data = {}
+    for symbol in diff.get("symbols", prev.data):
+        change = diff["changes"].get(symbol)
+        if change is None:
+            data[symbol] = prev.data[symbol]
+        elif change[0] == "full":
+            data[symbol] = change[1]
+        else:
+            drop, new = change[1]
+            data[symbol] = _concat_frames(prev.data[symbol], drop, new)
+    return replace(prev, data=data, **diff["meta"])
+
+
+def _apply_panel(prev: OHLCVPanel, diff: dict[str, Any]) -> OHLCVPanel:
+    symbols = tuple(diff.get("symbols", prev.symbols))
+    names = list(prev.columns)
+    indexes: list[np.ndarray] = []
+    columns: dict[str, list[np.ndarray]] = {name: [] for name in names}
+    lengths = []
+    for symbol in symbols:
+        change = diff["changes"].get(symbol)
+        if change is None:
+            runs = [_panel_run(prev, symbol)]
+        elif change[0] == "full":
+            runs = [change[1]]
+        else:
+            drop, tail = change[1]
+            index, values = _panel_run(prev, symbol)
+            runs = [(index[drop:], {n: v[drop:] for n, v in values.items()}), tail]
+        lengths.append(sum(len(index) for index, _ in runs))
+        for index, values in runs:
+            indexes.append(index)
+            for name in names:
+                columns[name].append(values[name])
+
+    offsets = np.zeros(len(symbols) + 1, dtype=np.int64)
+    offsets[1:] = np.cumsum(lengths, dtype=np.int64)
+    return replace(
+        prev,
+        symbols=symbols,
+        offsets=offsets,
+        index=np.concatenate(indexes) if indexes else prev.index[:0].copy(),
+        columns={
+            name: np.concatenate(parts) if parts else prev.columns[name][:0].copy()
+            for name, parts in columns.items()
+        },
+        **diff["meta"],
+    )
+
+
+def _apply_quote(prev: Quote, diff: dict[str, Any]) -> Quote:
+    maps = {}
+    for name in _QUOTE_MAPS:
+        change = diff.get(name)
+        if change is None:
+            maps[name] = getattr(prev, name)
+        elif change[0] == "full":
+            maps[name] = change[1]
+        else:
+            maps[name] = {**getattr(prev, name), **change[1]}
+    return replace(prev, **maps, **diff["meta"])
+
+
+def _apply_quote_batch(prev: QuoteBatch, change: tuple) -> QuoteBatch:
+    meta, changed, values = change
+    merged = prev.values.copy()
+    merged[:, changed] = values
+    return replace(prev, values=merged, **meta)
+
+
+def _apply_items(prev: Any, change: tuple) -> Any:
+    attr, diff = change
+    key = _ITEM_KEYS[attr]
+    by_key = {key(item): item for item in getattr(prev, attr)}
+    changes = diff.get("changes", {})
+    items = [
+        _apply(by_key.get(k), changes[k]) if k in changes else by_key[k]
+        for k in diff.get("keys", by_key)
+    ]
+    return replace(prev, timestamp=diff.get("timestamp", prev.timestamp), **{attr: items})
+
+
+def _apply_map(prev: dict[Hashable, Any], change: tuple) -> dict[Hashable, Any]:
+    updates, dropped = change
+    merged = {k: v for k, v in prev.items() if k not in dropped}
+    merged.update(updates)
+    return merged
+
+
+def _apply(prev: Any, delta: Delta) -> Any:
+    """Apply a delta produced by _diff to the previous field value."""
+    op, value = delta
+    if op == "full":
+        return value
+    if op == "fields":
+        return replace(prev, **value)
+    if op == "items":
+        return _apply_items(prev, value)
+    if op == "map":
+        return _apply_map(prev, value)
+    if op == "quote":
+        return _apply_quote(prev, value)
+    if op == "batch":
+        return _apply_quote_batch(prev, value)
+    if op == "frames":
+        return _apply_frames(prev, value)
+    if op == "panel":
+        return _apply_panel(prev, value)
+    raise ValueError(f"Unknown journal delta '{op}'")
+
+
+def _copy_items(collection: Any, attr: str) -> Any:
+    if collection is None:
+        return None
+    return replace(collection, **{attr: [copy.copy(item) for item in getattr(collection, attr)]})
+
+
+def _snapshot(entry: JournalInput) -> JournalInput:
+    """Copy what ports may mutate in place between ticks.
+
+    Deltas are taken against this copy rather than the reported entry, so an
+    order, position or quote map updated in place still shows up as a change.
+    Bars are not copied; ports build a new window every tick.
+    """
+    quote = entry.quote_data
+    if isinstance(quote, QuoteBatch):
+        quote = replace(quote, values=quote.values.copy())
+    elif quote is not None:
+        quote = replace(quote, **{name: dict(getattr(quote, name)) for name in _QUOTE_MAPS})
+    return replace(
+        entry,
+        quote_data=quote,
+        account_data=copy.copy(entry.account_data),
+        position_data=_copy_items(entry.position_data, "positions"),
+        open_orders=_copy_items(entry.open_orders, "orders"),
+        portfolio_manager_state=copy.copy(entry.portfolio_manager_state),
+        order_status=dict(entry.order_status),
+    )
+
+
+class DeltaEncoder:
+    """Encode consecutive JournalInput entries as keyframes and deltas.
+
+    Every keyframe_interval-th frame (starting with the first) carries the full
+    JournalInput; the others carry only the fields that changed since the
+    previous entry. Frames are dicts with "seq" and "key" entries and must be
+    encoded in tick order.
+
+    Args:
+        keyframe_interval: Number of frames per keyframe.
+    """
+
+    def __init__(self, keyframe_interval: int = 100):
+        """Initialize the encoder.
+
+        Args:
+            keyframe_interval: Number of frames per keyframe.
+
+        Raises:
+            ValueError: If keyframe_interval is not positive.
+        """
+        if keyframe_interval <= 0:
+            raise ValueError("keyframe_interval must be positive")
+        self.keyframe_interval = keyframe_interval
+        self._seq = 0
+        self._prev: JournalInput | None = None
+
+    def encode(self, entry: JournalInput) -> dict[str, Any]:
+        """Encode the next entry.
+
+        Args:
+            entry: Journal input of the current tick.
+
+        Returns:
+            Keyframe or delta frame for the entry.
+        """
+        seq = self._seq
+        self._seq += 1
+        prev, self._prev = self._prev, _snapshot(entry)
+        if prev is None or seq % self.keyframe_interval == 0:
+            return {"seq": seq, "key": True, "input": entry}
+
+        frame: dict[str, Any] = {
+            "seq": seq,
+            "key": False,
+            "timestamp": entry.timestamp,
+            "port_latency_ms": entry.port_latency_ms,
+        }
+        for name in _DIFFED_FIELDS:
+            delta = _diff(name, getattr(prev, name), getattr(entry, name))
+            if delta is not None:
+                frame[name] = delta
+        return frame
+
+
+def encode_frame(frame: dict[str, Any]) -> str:
+    """Serialize a frame as ASCII JSON for a JournalRecord payload."""
+    return frame_codec.dumps(frame)
+
+
+def decode_frame(payload: str) -> dict[str, Any]:
+    """Deserialize a frame written by encode_frame."""
+    return frame_codec.loads(payload)
+
+
+def assemble_frames(
+    records: Iterable[tuple[str, str]], logger: Any = None
+) -> Iterator[dict[str, Any]]:
+    """Decode (kind, payload) frame records, joining split frames.
+
+    A split frame is yielded once all of its PART_KIND records have been seen;
+    frames with missing parts are dropped, which the reader treats as a gap.
+
+    Args:
+        records: Record kinds and payloads in write order.
+        logger: Optional logger warned about incomplete frames.
+
+    Yields:
+        Decoded frames.
+    """
+    pending: dict[int, list[str | None]] = {}
+    for kind, payload in records:
+        if kind != PART_KIND:
+            yield decode_frame(payload)
+            continue
+        header, _, piece = payload.partition("\n")
+        seq, part, parts = (int(value) for value in header.split())
+        pieces = pending.setdefault(seq, [None] * parts)
+        pieces[part] = piece
+        if None not in pieces:
+            del pending[seq]
+            yield decode_frame("".join(pieces))
+    if logger is not None:
+        for seq in pending:
+            logger.warning(f"Journal frame {seq} is missing parts; dropping it")
+
+
+class DeltaJournalEncoder:
+    """BatchedJournalPort encoder writing journal inputs as delta frames.
+
+    Inputs become records of kind KEY_KIND or DELTA_KIND; outputs and errors
+    keep the JSON encoding. A frame whose payload exceeds max_payload_bytes
+    (typically a keyframe of a wide universe) is split into PART_KIND records
+    whose payloads start with a "seq part parts" header line. The port calls
+    the encoder from its single writer thread in enqueue order, so entries
+    dropped by backpressure never break the delta chain.
+
+    Args:
+        keyframe_interval: Number of input frames per keyframe.
+        max_payload_bytes: Largest record payload; the default fits InfluxDB's
+            64KB string field limit. None never splits frames.
+    """
+
+    def __init__(self, keyframe_interval: int = 100, max_payload_bytes: int | None = 60_000):
+        """Initialize the encoder.
+
+        Args:
+            keyframe_interval: Number of input frames per keyframe.
+            max_payload_bytes: Largest record payload; the default fits InfluxDB's
+                64KB string field limit. None never splits frames.
+
+        Raises:
+            ValueError: If max_payload_bytes leaves no room for a part header.
+        """
+        if max_payload_bytes is not None and max_payload_bytes <= _PART_HEADER_BYTES:
+            raise ValueError(f"max_payload_bytes must exceed {_PART_HEADER_BYTES}")
+        self.encoder = DeltaEncoder(keyframe_interval)
+        self.max_payload_bytes = max_payload_bytes
+
+    def __call__(self, kind: str, entry: Any) -> JournalRecord | list[JournalRecord]:
+        """Encode one journal entry.
+
+        Args:
+            kind: Entry kind ("input", "output" or "error").
+            entry: Journal dataclass to serialize.
+
+        Returns:
+            JournalRecord for the entry, or its PART_KIND records if split.
+        """
+        if kind != "input":
+            return encode_entry(kind, entry)
+        frame = self.encoder.encode(entry)
+        payload = encode_frame(frame)
+        limit = self.max_payload_bytes
+        if limit is None or len(payload) <= limit:
+            return JournalRecord(
+                timestamp=entry.timestamp,
+                kind=KEY_KIND if frame["key"] else DELTA_KIND,
+                payload=payload,
+            )
+        step = limit - _PART_HEADER_BYTES
+        pieces = [payload[i : i + step] for i in range(0, len(payload), step)]
+        return [
+            JournalRecord(
+                timestamp=entry.timestamp,
+                kind=PART_KIND,
+                payload=f"{frame['seq']} {part} {len(pieces)}\n{piece}",
+                part=part,
+            )
+            for part, piece in enumerate(pieces)
+        ]
+
+
+class DeltaJournalReader:
+    """Rebuild full JournalInput entries from keyframes and deltas.
+
+    A gap in the frame sequence (e.g., a failed sink write) invalidates the
+    following deltas; the reader skips them until the next keyframe.
+
+    Args:
+        frames: Frames in the order they were encoded.
+    """
+
+    def __init__(self, frames: Iterable[dict[str, Any]]):
+        """Initialize the reader.
+
+        Args:
+            frames: Frames in the order they were encoded.
+        """
+        self.logger = get_logger(self.__class__.__name__)
+        self.frames = sorted(frames, key=lambda frame: frame["seq"])
+        self._positions = {frame["seq"]: i for i, frame in enumerate(self.frames)}
+
+    @classmethod
+    def from_records(cls, records: Iterable[JournalRecord]) -> DeltaJournalReader:
+        """Build a reader from journal records, ignoring non-input kinds."""
+        frames = ((r.kind, r.payload) for r in records if r.kind in _FRAME_KINDS)
+        return cls(assemble_frames(frames, get_logger(cls.__name__)))
+
+    @classmethod
+    def from_sqlite(cls, client: BaseSQLiteClient, table: str = "journal") -> DeltaJournalReader:
+        """Build a reader from a table written by SQLiteJournalSink."""
+        rows = client.fetchall(
+            f"SELECT kind, payload FROM {table} WHERE kind IN (?, ?, ?) ORDER BY id",
+            _FRAME_KINDS,
+        )
+        frames = ((row["kind"], row["payload"]) for row in rows)
+        return cls(assemble_frames(frames, get_logger(cls.__name__)))
+
+    def __len__(self) -> int:
+        """Return the number of frames."""
+        return len(self.frames)
+
+    def _replay(self, frames: Iterable[dict[str, Any]]) -> Iterator[tuple[int, JournalInput]]:
+        current: JournalInput | None = None
+        last_seq = None
+        for frame in frames:
+            seq = frame["seq"]
+            if frame["key"]:
+                current = frame["input"]
+            elif current is None or seq != last_seq + 1:
+                if current is not None:
+                    self.logger.warning(f"Journal gap before frame {seq}; waiting for keyframe")
+                current = None
+                continue
+            else:
+                changes = {
+                    name: _apply(getattr(current, name), frame[name])
+                    for name in _DIFFED_FIELDS
+                    if name in frame
+                }
+                current = replace(
+                    current,
+                    timestamp=frame["timestamp"],
+                    port_latency_ms=frame["port_latency_ms"],
+                    **changes,
+                )
+            last_seq = seq
+            yield seq, current
+
+    def __iter__(self) -> Iterator[JournalInput]:
+        """Yield every reconstructible JournalInput in tick order."""
+        for _, entry in self._replay(self.frames):
+            yield entry
+
+    def at(self, seq: int) -> JournalInput:
+        """Rebuild the JournalInput of one tick.
+
+        Replays from the closest keyframe at or before the tick.
+
+        Args:
+            seq: Frame sequence number of the tick.
+
+        Returns:
+            The JournalInput as it was reported.
+
+        Raises:
+            KeyError: If the tick is missing or not reachable from a keyframe.
+        """
+        end = self._positions[seq]
+        start = end
+        while start > 0 and not self.frames[start]["key"]:
+            start -= 1
+        for frame_seq, entry in self._replay(self.frames[start : end + 1]):
+            if frame_seq == seq:
+                return entry
+        raise KeyError(f"Journal frame {seq} is not reachable from a keyframe")
@@ -0,0 +1,238 @@
+"""Typed JSON codec for journal delta frames.
+
+This module provides dumps() and loads(), which serialize the values held in
+DeltaEncoder frames (domain dataclasses and enums, datetimes, UUIDs, tuples,
+non-string mapping keys, numpy arrays and DataFrames) as plain JSON and
+rebuild them exactly. Values JSON cannot express are written as objects
+tagged with a "$t" entry; array buffers are base64-encoded so floats,
+including NaN payloads, round-trip bit for bit.
+
+Only dataclasses and enums defined in the domain models and states modules
+are rebuilt, so decoding a journal never runs code named by its payload.
+"""
+
+from __future__ import annotations
+
+import base64
+import json
+import math
+from dataclasses import fields, is_dataclass
+from datetime import date, datetime
+from enum import Enum
+from typing import Any
+from uuid import UUID
+
+import numpy as np
+import pandas as pd
+
+from system.algo_trader.domain import models, states
+
+_TAG = "$t"
+
+# Types a payload may name; everything else is rejected on decode
+_TYPES: dict[str, type] = {
+    name: obj
+    for module in (models, states)
+    for name, obj in vars(module).items()
+    if isinstance(obj, type)
+    and obj.__module__ == module.__name__
+    and (is_dataclass(obj) or issubclass(obj, Enum))
+}
+
+
+def _registered(obj: Any) -> str:
+    """Return the registry name of obj's type, or raise if it is not a domain type."""
+    name = type(obj).__name__
+    if _TYPES.get(name) is not type(obj):
+        raise TypeError(f"Object of type {name} is not a journaled domain type")
+    return name
+
+
+def _pack_array(array: np.ndarray) -> dict[str, Any]:
+    if array.dtype.hasobject:
+        return {_TAG: "objects", "shape": list(array.shape), "v": [_pack(x) for x in array.flat]}
+    return {
+        _TAG: "ndarray",
+        "dtype": array.dtype.str,
+        "shape": list(array.shape),
+        "data": base64.b64encode(np.ascontiguousarray(array).tobytes()).decode("ascii"),
+    }
+
+
+def _pack_index(index: pd.Index) -> dict[str, Any]:
+    if isinstance(index, pd.RangeIndex):
+        return {
+            _TAG: "range",
+            "name": _pack(index.name),
+            "v": [index.start, index.stop, index.step],
+        }
+    if isinstance(index, pd.DatetimeIndex):
+        tz = str(index.tz) if index.tz is not None else None
+        naive = index.tz_convert(None) if tz is not None else index
+        return {
+            _TAG: "datetimes",
+            "name": _pack(index.name),
+            "tz": tz,
+            "v": _pack_array(naive.to_numpy()),
+        }
+    return {
+        _TAG: "index",
+        "name": _pack(index.name),
+        "dtype": str(index.dtype),
+        "v": _pack_array(index.to_numpy()),
+    }
+
+
+def _pack_frame(frame: pd.DataFrame) -> dict[str, Any]:
+    return {
+        _TAG: "frame",
+        "columns": _pack_index(frame.columns),
+        "dtypes": [str(dtype) for dtype in frame.dtypes],
+        "index": _pack_index(frame.index),
+        "data": [_pack_array(frame.iloc[:, i].to_numpy()) for i in range(frame.shape[1])],
+    }
+
+
+def _pack(obj: Any) -> Any:  # noqa: PLR0911, PLR0912
+    """Convert a frame value into JSON-safe data."""
+    if isinstance(obj, Enum):
+        return {_TAG: "enum", "cls": _registered(obj), "v": _pack(obj.value)}
+    if obj is None or isinstance(obj, (bool, str, int)):
+        return obj
+    if isinstance(obj, float):
+        return obj if math.isfinite(obj) else {_TAG: "float", "v": repr(obj)}
+    if isinstance(obj, pd.Timestamp):
+        tz = str(obj.tz) if obj.tz is not None else None
+        return {_TAG: "timestamp", "v": obj.value, "tz": tz}
+    if isinstance(obj, datetime):
+        return {_TAG: "datetime", "v": obj.isoformat()}
+    if isinstance(obj, date):
+        return {_TAG: "date", "v": obj.isoformat()}
+    if isinstance(obj, UUID):
+        return {_TAG: "uuid", "v": str(obj)}
+    if isinstance(obj, list):
+        return [_pack(item) for item in obj]
+    if isinstance(obj, tuple):
+        return {_TAG: "tuple", "v": [_pack(item) for item in obj]}
+    if isinstance(obj, dict):
+        if _TAG not in obj and all(isinstance(key, str) for key in obj):
+            return {key: _pack(value) for key, value in obj.items()}
+        return {_TAG: "dict", "v": [[_pack(k), _pack(v)] for k, v in obj.items()]}
+    if isinstance(obj, np.ndarray):
+        return _pack_array(obj)
+    if isinstance(obj, np.generic):
+        return _pack(obj.item())
+    if isinstance(obj, pd.DataFrame):
+        return _pack_frame(obj)
+    if isinstance(obj, pd.Index):
+        return _pack_index(obj)
+    if is_dataclass(obj) and not isinstance(obj, type):
+        return {
+            _TAG: "dataclass",
+            "cls": _registered(obj),
+            "v": {f.name: _pack(getattr(obj, f.name)) for f in fields(obj) if f.init},
+        }
+    raise TypeError(f"Object of type {type(obj).__name__} cannot be journaled")
+
+
+def _unpack_array(doc: dict[str, Any]) -> np.ndarray:
+    if doc[_TAG] == "objects":
+        array = np.empty(len(doc["v"]), dtype=object)
+        for i, item in enumerate(doc["v"]):
+            array[i] = _unpack(item)
+        return array.reshape(doc["shape"])
+    buffer = base64.b64decode(doc["data"])
+    return np.frombuffer(buffer, dtype=np.dtype(doc["dtype"])).reshape(doc["shape"]).copy()
+
+
+def _unpack_index(doc: dict[str, Any]) -> pd.Index:
+    name = _unpack(doc["name"])
+    if doc[_TAG] == "range":
+        return pd.RangeIndex(*doc["v"], name=name)
+    if doc[_TAG] == "datetimes":
+        index = pd.DatetimeIndex(_unpack_array(doc["v"]), name=name)
+        return index.tz_localize("UTC").tz_convert(doc["tz"]) if doc["tz"] else index
+    return pd.Index(_unpack_array(doc["v"]), dtype=doc["dtype"], name=name)
+
+
+def _unpack_frame(doc: dict[str, Any]) -> pd.DataFrame:
+    arrays = [_unpack_array(column) for column in doc["data"]]
+    frame = pd.DataFrame(dict(enumerate(arrays)), index=_unpack_index(doc["index"]))
+    frame.columns = _unpack_index(doc["columns"])
+    for i, dtype in enumerate(doc["dtypes"]):
+        if str(frame.dtypes.iloc[i]) != dtype:
+            frame.isetitem(i, frame.iloc[:, i].astype(dtype))
+    return frame
+
+
+def _domain_type(name: str) -> type:
+    cls = _TYPES.get(name)
+    if cls is None:
+        raise ValueError(f"Journal payload names unknown type '{name}'")
+    return cls
+
+
+def _unpack(doc: Any) -> Any:  # noqa: PLR0911, PLR0912
+    """Rebuild a frame value from data produced by _pack."""
+    if isinstance(doc, list):
+        return [_unpack(item) for item in doc]
+    if not isinstance(doc, dict):
+        return doc
+    tag = doc.get(_TAG)
+    if tag is None:
+        return {key: _unpack(value) for key, value in doc.items()}
+    if tag == "float":
+        return float(doc["v"])
+    if tag == "enum":
+        return _domain_type(doc["cls"])(_unpack(doc["v"]))
+    if tag == "timestamp":
+        return pd.Timestamp(doc["v"], tz=doc["tz"])
+    if tag == "datetime":
+        return datetime.fromisoformat(doc["v"])
+    if tag == "date":
+        return date.fromisoformat(doc["v"])
+    if tag == "uuid":
+        return UUID(doc["v"])
+    if tag == "tuple":
+        return tuple(_unpack(item) for item in doc["v"])
+    if tag == "dict":
+        return {_unpack(k): _unpack(v) for k, v in doc["v"]}
+    if tag in ("ndarray", "objects"):
+        return _unpack_array(doc)
+    if tag == "frame":
+        return _unpack_frame(doc)
+    if tag in ("range", "datetimes", "index"):
+        return _unpack_index(doc)
+    if tag == "dataclass":
+        return _domain_type(doc["cls"])(**{k: _unpack(v) for k, v in doc["v"].items()})
+    raise ValueError(f"Unknown journal value tag '{tag}'")
+
+
+def dumps(value: Any) -> str:
+    """Serialize a frame value as ASCII JSON.
+
+    Args:
+        value: Frame or frame value to serialize.
+
+    Returns:
+        JSON document; its length in characters equals its length in bytes.
+
+    Raises:
+        TypeError: If the value holds a type the codec does not support.
+    """
+    return json.dumps(_pack(value), separators=(",", ":"), allow_nan=False)
+
+
+def loads(payload: str) -> Any:
+    """Rebuild a value written by dumps().
+
+    Args:
+        payload: JSON document produced by dumps().
+
+    Returns:
+        The serialized value.
+
+    Raises:
+        ValueError: If the payload names an unknown type or tag.
+    """
+    return _unpack(json.loads(payload))
@@ -0,0 +1,224 @@
+"""Batch sinks for the asynchronous journal writer.
+
+This module defines JournalRecord, the serialized form of a journal entry, the
+JournalSink interface consumed by BatchedJournalPort, and sinks that persist
+record batches to SQLite or InfluxDB.
+"""
+
+from __future__ import annotations
+
+import json
+from abc import ABC, abstractmethod
+from dataclasses import dataclass, fields, is_dataclass
+from datetime import datetime
+from enum import Enum
+from typing import Any
+from uuid import UUID
+
+import numpy as np
+import pandas as pd
+
+from infrastructure.influxdb.influxdb import BaseInfluxDBClient
+from infrastructure.logging.logger import get_logger
+from infrastructure.sqlite.sqlite import BaseSQLiteClient
+
+
+@dataclass(frozen=True)
+class JournalRecord:
+    """Serialized journal entry.
+
+    Attributes:
+        timestamp: Timestamp of the journal entry.
+        kind: Entry kind ("input", "output" or "error").
+        payload: JSON document of the entry fields.
+        part: Index of the record within an entry split across several
+            records, or None for an entry stored whole.
+    """
+
+    timestamp: datetime
+    kind: str
+    payload: str
+    part: int | None = None
+
+
+def _summarize_history(historical_data: Any) -> dict[str, int]:
+    """Return the number of bars per symbol instead of the bars themselves."""
+    if hasattr(historical_data, "offsets"):
+        return {
+            symbol: int(historical_data.offsets[i + 1] - historical_data.offsets[i])
+            for i, symbol in enumerate(historical_data.symbols)
+        }
+    return {symbol: len(frame) for symbol, frame in historical_data.data.items()}
+
+
+def _json_keys(value: Any) -> Any:
+    """Stringify UUID mapping keys (e.g., order status by ID), which json rejects."""
+    if isinstance(value, dict) and isinstance(next(iter(value), None), UUID):
+        return {str(key): item for key, item in value.items()}
+    return value
+
+
+def _encode(obj: Any) -> Any:  # noqa: PLR0911
+    """JSON fallback for domain models, enums, timestamps and array data."""
+    if isinstance(obj, datetime):
+        return obj.isoformat()
+    if isinstance(obj, UUID):
+        return str(obj)
+    if isinstance(obj, Enum):
+        return obj.value
+    if isinstance(obj, BaseException):
+        return f"{type(obj).__name__}: {obj}"
+    if is_dataclass(obj):
+        # Shallow field walk; dataclasses.asdict would deep-copy every DataFrame
+        return {
+            f.name: _json_keys(getattr(obj, f.name))
+            for f in fields(obj)
+            if not f.name.startswith("_")
+        }
+    if isinstance(obj, pd.DataFrame):
+        return obj.to_dict(orient="split")
+    if isinstance(obj, np.ndarray):
+        if obj.dtype.kind == "M":
+            return np.datetime_as_string(obj).tolist()
+        return obj.tolist()
+    if isinstance(obj, np.generic):
+        return obj.item()
+    raise TypeError(f"Object of type {type(obj).__name__} is not JSON serializable")
+
+
+def encode_entry(kind: str, entry: Any, include_history: bool = True) -> JournalRecord:
+    """Serialize a JournalInput, JournalOutput or JournalError.
+
+    Args:
+        kind: Entry kind stored with the record.
+        entry: Journal dataclass to serialize.
+        include_history: If False, historical bars are replaced by per-symbol
+            bar counts to keep payloads small.
+
+    Returns:
+        JournalRecord holding the JSON payload.
+    """
+    document = _encode(entry)
+    if not include_history and "historical_data" in document:
+        document["historical_data"] = _summarize_history(entry.historical_data)
+    return JournalRecord(
+        timestamp=entry.timestamp,
+        kind=kind,
+        payload=json.dumps(document, default=_encode),
+    )
+
+
+class JournalSink(ABC):
+    """Destination for batches of serialized journal records.
+
+    All sink methods are called from the journal writer thread only.
+    """
+
+    @abstractmethod
+    def write(self, records: list[JournalRecord]) -> None:
+        """Persist one batch of records.
+
+        Args:
+            records: Records in enqueue order.
+        """
+        ...
+
+    def close(self) -> None:
+        """Release resources once the writer stops."""
+
+
+class SQLiteJournalSink(JournalSink):
+    """Write journal batches to a SQLite table, one transaction per batch.
+
+    The sink owns the client. SQLite connections are bound to the thread that
+    opens them, so the client must not be used from other threads.
+
+    Args:
+        client: SQLite client used by the writer thread.
+        table: Journal table name; created on first write.
+    """
+
+    def __init__(self, client: BaseSQLiteClient, table: str = "journal"):
+        """Initialize the sink.
+
+        Args:
+            client: SQLite client used by the writer thread.
+            table: Journal table name; created on first write.
+        """
+        self.logger = get_logger(self.__class__.__name__)
+        self.client = client
+        self.table = table
+        self._created = False
+
+    def write(self, records: list[JournalRecord]) -> None:
+        """Insert a batch of records.
+
+        Args:
+            records: Records in enqueue order.
+        """
+        if not self._created:
+            self.client.execute(
+                f"CREATE TABLE IF NOT EXISTS {self.table} ("
+                "id INTEGER PRIMARY KEY AUTOINCREMENT, "
+                "timestamp TEXT NOT NULL, kind TEXT NOT NULL, payload TEXT NOT NULL)"
+            )
+            self._created = True
+        self.client.execute_many(
+            f"INSERT INTO {self.table} (timestamp, kind, payload) VALUES (?, ?, ?)",
+            [(r.timestamp.isoformat(), r.kind, r.payload) for r in records],
+        )
+
+    def close(self) -> None:
+        """Close the SQLite connection."""
+        self.client.close()
+
+
+def _line_protocol(measurement: str, record: JournalRecord) -> str:
+    """Format a record as an InfluxDB line protocol row."""
+    payload = record.payload.replace("\\", "\\\\").replace('"', '\\"')
+    ts = record.timestamp
+    ts_ns = int(ts.timestamp()) * 1_000_000_000 + ts.microsecond * 1_000
+    # Parts of one entry share a timestamp; tag them apart so none overwrites another
+    tags = f"kind={record.kind}"
+    if record.part is not None:
+        tags += f",part={record.part}"
+    return f'{measurement},{tags} payload="{payload}" {ts_ns}'
+
+
+class InfluxDBJournalSink(JournalSink):
+    """Write journal batches to InfluxDB as line protocol.
+
+    Each record becomes one point tagged with its kind (and part index, for
+    split entries) and carrying the JSON payload as a string field. The
+    client's own batching write options still apply on top of the journal
+    batches. InfluxDB caps string fields at 64KB, so pair this sink with
+    include_history=False or DeltaJournalEncoder (which splits oversized
+    frames) for large universes.
+
+    Args:
+        client: InfluxDB client; closed (and flushed) when the writer stops.
+        measurement: Measurement name for journal points.
+    """
+
+    def __init__(self, client: BaseInfluxDBClient, measurement: str = "journal"):
+        """Initialize the sink.
+
+        Args:
+            client: InfluxDB client; closed (and flushed) when the writer stops.
+            measurement: Measurement name for journal points.
+        """
+        self.logger = get_logger(self.__class__.__name__)
+        self.client = client
+        self.measurement = measurement
+
+    def write(self, records: list[JournalRecord]) -> None:
+        """Write a batch of records.
+
+        Args:
+            records: Records in enqueue order.
+        """
+        self.client.client.write(record=[_line_protocol(self.measurement, r) for r in records])
+
+    def close(self) -> None:
+        """Flush pending points and close the client."""
+        self.client.close()
@@ -8,6 +8,12 @@ from infrastructure.redis.redis import BaseRedisClient
 ACCESS_TOKEN_TTL_SECONDS = 30 * 60  # 30 minutes
 REFRESH_TOKEN_TTL_SECONDS = 90 * 24 * 60 * 60  # 90 days
 
+# Pub/sub channel announcing the outcome of an access token refresh
+TOKEN_EVENTS_CHANNEL = "schwab:token_events"
+TOKEN_REFRESHED = "refreshed"
+TOKEN_REFRESH_FAILED = "failed"
+TOKEN_REFRESH_SKIPPED = "skipped"
+
 
 class AccountBroker(BaseRedisClient):
     """Broker responsible for Schwab token storage and locking."""
@@ -25,6 +31,14 @@ class AccountBroker(BaseRedisClient):
         """Cache the Schwab access token with the standard TTL."""
         return self.set("schwab:access_token", token, ttl=ACCESS_TOKEN_TTL_SECONDS)
 
+    def get_access_token_ttl(self) -> int:
+        """Return seconds until the access token expires (negative if unknown)."""
+        return self.ttl("schwab:access_token")
+
+    def delete_access_token(self) -> bool:
+        """Drop the cached Schwab access token (e.g., after the API rejected it)."""
+        return self.delete("schwab:access_token")
+
     # Refresh token operations
     def get_refresh_token(self) -> str | None:
         """Return the cached Schwab refresh token, if present."""
@@ -33,3 +47,12 @@ class AccountBroker(BaseRedisClient):
     def set_refresh_token(self, token: str) -> bool:
         """Cache the Schwab refresh token with the standard TTL."""
         return self.set("schwab:refresh_token", token, ttl=REFRESH_TOKEN_TTL_SECONDS)
+
+    # Refresh coordination
+    def publish_token_event(self, event: str) -> int:
+        """Announce a refresh outcome (one of the TOKEN_REFRESH* events)."""
+        return self.publish(TOKEN_EVENTS_CHANNEL, event)
+
+    def subscribe_token_events(self):
+        """Return a PubSub subscribed to refresh outcomes, or None on error."""
+        return self.subscribe(TOKEN_EVENTS_CHANNEL)
@@ -0,0 +1,25 @@
+"""Redis broker for cached market session hours."""
+
+from __future__ import annotations
+
+from datetime import date
+from typing import Any
+
+from infrastructure.redis.redis import BaseRedisClient
+
+
+class MarketCalendarBroker(BaseRedisClient):
+    """Broker sharing fetched session hours per market and day across processes."""
+
+    def _get_namespace(self) -> str:
+        return "algo_trader"
+
+    def get_sessions(self, market: str, day: date) -> list[dict[str, Any]] | None:
+        """Return the cached session windows for a day, [] if closed, None if absent."""
+        return self.get_json(f"calendar:{market}:{day.isoformat()}")
+
+    def set_sessions(
+        self, market: str, day: date, sessions: list[dict[str, Any]], ttl: int
+    ) -> bool:
+        """Cache a day's session windows ([] for a closed day) for ttl seconds."""
+        return self.set_json(f"calendar:{market}:{day.isoformat()}", sessions, ttl=ttl)
@@ -0,0 +1,338 @@
+"""Redis-shared adaptive rate limiter for Schwab API requests.
+
+This module provides SharedRateLimiter, a token bucket per Schwab endpoint
+class whose state (tokens, refill time and current rate) lives in Redis, so
+every process and handler talking to Schwab draws from the same budget. Each
+bucket is updated in an optimistic WATCH/MULTI transaction timed by the Redis
+server clock. The rate adapts with AIMD: successful responses raise it
+additively, and 429 or 5xx responses cut it multiplicatively.
+"""
+
+from __future__ import annotations
+
+import threading
+import time
+from collections.abc import Callable
+from dataclasses import dataclass, replace
+from enum import Enum
+from typing import Any
+
+from redis.exceptions import WatchError
+
+from infrastructure.redis.redis import BaseRedisClient
+from system.algo_trader.infra.schwab.rate_limit import TokenBucket
+
+_THROTTLE_STATUS = 429
+_SERVER_ERROR = 500
+
+
+class EndpointClass(Enum):
+    """Schwab endpoint groups that share a request budget."""
+
+    MARKET_DATA = "market_data"
+    ACCOUNTS = "accounts"
+    ORDERS = "orders"
+
+
+def classify_request(method: str, url: str) -> EndpointClass:
+    """Return the endpoint class a Schwab request counts against.
+
+    Args:
+        method: HTTP method.
+        url: Request URL.
+
+    Returns:
+        MARKET_DATA for /marketdata/ URLs, ORDERS for order placement,
+        replacement and cancellation, and ACCOUNTS for other trader calls.
+    """
+    if "/marketdata/" in url:
+        return EndpointClass.MARKET_DATA
+    if "/orders" in url and method.upper() != "GET":
+        return EndpointClass.ORDERS
+    return EndpointClass.ACCOUNTS
+
+
+@dataclass(frozen=True)
+class RateLimitConfig:
+    """Bucket and AIMD parameters for one endpoint class.
+
+    Attributes:
+        initial_rate: Requests per second before any feedback.
+        min_rate: Floor for multiplicative decrease.
+        max_rate: Ceiling for additive increase.
+        capacity: Burst size in requests.
+        increase_step: Requests per second added per successful response.
+        decrease_factor: Rate multiplier applied on 429 or 5xx.
+        decrease_cooldown_s: Minimum time between decreases, so one burst of
+            errors counts as a single congestion signal.
+    """
+
+    initial_rate: float = 2.0
+    min_rate: float = 0.2
+    max_rate: float = 2.0
+    capacity: float = 10.0
+    increase_step: float = 0.01
+    decrease_factor: float = 0.5
+    decrease_cooldown_s: float = 5.0
+
+
+# Schwab allows 120 requests per minute per endpoint group
+DEFAULT_CONFIGS = {
+    EndpointClass.MARKET_DATA: RateLimitConfig(),
+    EndpointClass.ACCOUNTS: RateLimitConfig(),
+    EndpointClass.ORDERS: RateLimitConfig(capacity=5.0),
+}
+
+
+@dataclass
+class RateLimitStats:
+    """Limiter metrics for one endpoint class, as seen by this process.
+
+    Attributes:
+        endpoint: Endpoint class.
+        rate: Shared rate in requests per second at the last update.
+        requests: Requests admitted.
+        waits: Requests that had to wait for a token.
+        wait_s_total: Total time spent waiting.
+        wait_s_max: Longest single wait.
+        throttled: 429 and 5xx responses recorded.
+        fallbacks: Requests admitted by the local fallback bucket.
+    """
+
+    endpoint: EndpointClass
+    rate: float
+    requests: int = 0
+    waits: int = 0
+    wait_s_total: float = 0.0
+    wait_s_max: float = 0.0
+    throttled: int = 0
+    fallbacks: int = 0
+
+
+class SharedRateLimiter(BaseRedisClient):
+    """Token buckets per endpoint class shared through Redis.
+
+    acquire() reserves a token (letting the balance go negative) and sleeps
+    until the reservation is covered, so callers in all processes are served
+    in order without polling Redis. Additive increases from successes are
+    batched locally and folded into the next acquire() transaction, keeping
+    the hot path at one transaction per request. If Redis is unreachable or
+    contended past max_watch_retries, a local bucket at min_rate admits the
+    request instead.
+
+    Args:
+        configs: Per-endpoint parameters; missing classes use DEFAULT_CONFIGS.
+        metrics_sink: Optional callable receiving stats() snapshots.
+        metrics_interval_s: Minimum seconds between metrics_sink calls.
+        sleep: Sleep function used while waiting for tokens.
+        max_watch_retries: Transaction attempts before falling back.
+        redis_config: Optional RedisConfig; defaults to the environment.
+    """
+
+    def __init__(  # noqa: PLR0913
+        self,
+        configs: dict[EndpointClass, RateLimitConfig] | None = None,
+        metrics_sink: Callable[[list[RateLimitStats]], None] | None = None,
+        metrics_interval_s: float = 15.0,
+        sleep: Callable[[float], None] = time.sleep,
+        max_watch_retries: int = 10,
+        redis_config=None,
+    ):
+        """Initialize the limiter and its Redis connection pool.
+
+        Args:
+            configs: Per-endpoint parameters; missing classes use DEFAULT_CONFIGS.
+            metrics_sink: Optional callable receiving stats() snapshots.
+            metrics_interval_s: Minimum seconds between metrics_sink calls.
+            sleep: Sleep function used while waiting for tokens.
+            max_watch_retries: Transaction attempts before falling back.
+            redis_config: Optional RedisConfig; defaults to the environment.
+        """
+        super().__init__(redis_config)
+        self.configs = {**DEFAULT_CONFIGS, **(configs or {})}
+        self.metrics_sink = metrics_sink
+        self.metrics_interval_s = metrics_interval_s
+        self.max_watch_retries = max_watch_retries
+        self._sleep = sleep
+        self._lock = threading.Lock()
+        self._pending_increase = dict.fromkeys(EndpointClass, 0.0)
+        self._stats = {
+            endpoint: RateLimitStats(endpoint, config.initial_rate)
+            for endpoint, config in self.configs.items()
+        }
+        self._fallback = {
+            endpoint: TokenBucket(config.min_rate, 1.0)
+            for endpoint, config in self.configs.items()
+        }
+        self._last_publish = time.monotonic()
+
+    def _get_namespace(self) -> str:
+        return "algo_trader"
+
+    def _key(self, endpoint: EndpointClass) -> str:
+        return self._build_key(f"ratelimit:{endpoint.value}")
+
+    def _transact(
+        self,
+        endpoint: EndpointClass,
+        update: Callable[[dict[str, float], float], tuple[dict[str, float], Any]],
+    ) -> Any | None:
+        """Apply update(state, now) -> (new_state, result) to a bucket atomically.
+
+        Returns:
+            The update's result, or None if Redis failed or stayed contended.
+        """
+        key = self._key(endpoint)
+        try:
+            with self.client.pipeline() as pipe:
+                for _ in range(self.max_watch_retries):
+                    try:
+                        pipe.watch(key)
+                        raw = pipe.hgetall(key)
+                        seconds, micros = pipe.time()
+                        state = {
+                            (k.decode() if isinstance(k, bytes) else k): float(v)
+                            for k, v in raw.items()
+                        }
+                        new_state, result = update(state, seconds + micros / 1e6)
+                        pipe.multi()
+                        pipe.hset(key, mapping=new_state)
+                        pipe.expire(key, 3600)
+                        pipe.execute()
+                        return result
+                    except WatchError:
+                        continue
+            self.logger.warning(f"Rate limit state for {endpoint.value} stayed contended")
+        except Exception as e:
+            self.logger.error(f"Rate limit transaction for {endpoint.value} failed: {e}")
+        return None
+
+    def acquire(self, endpoint: EndpointClass, tokens: float = 1.0) -> float:
+        """Take tokens from an endpoint's shared bucket, sleeping until available.
+
+        Args:
+            endpoint: Endpoint class the request counts against.
+            tokens: Number of tokens to take.
+
+        Returns:
+            Seconds spent waiting.
+        """
+        config = self.configs[endpoint]
+        with self._lock:
+            increase, self._pending_increase[endpoint] = self._pending_increase[endpoint], 0.0
+
+        def update(state: dict[str, float], now: float):
+            rate = state.get("rate", config.initial_rate)
+            updated = state.get("updated", now)
+            available = state.get("tokens", config.capacity)
+            available = min(config.capacity, available + max(0.0, now - updated) * rate)
+            rate = min(config.max_rate, rate + increase)
+            available -= tokens
+            wait = max(0.0, -available / rate)
+            return {**state, "rate": rate, "tokens": available, "updated": now}, (wait, rate)
+
+        outcome = self._transact(endpoint, update)
+        fallback = outcome is None
+        if fallback:
+            wait, rate = self._fallback[endpoint].reserve(tokens), config.min_rate
+        else:
+            wait, rate = outcome
+        if wait > 0:
+            self._sleep(wait)
+
+        with self._lock:
+            stats = self._stats[endpoint]
+            stats.rate = rate
+            stats.requests += 1
+            stats.fallbacks += fallback
+            if wait > 0:
+                stats.waits += 1
+                stats.wait_s_total += wait
+                stats.wait_s_max = max(stats.wait_s_max, wait)
+        self._maybe_publish()
+        return wait
+
+    def record(self, endpoint: EndpointClass, status_code: int | None) -> None:
+        """Feed a response status back into the endpoint's rate.
+
+        Successes (status below 400) queue an additive increase for the next
+        acquire(); 429 and 5xx responses apply a multiplicative decrease at
+        most once per decrease_cooldown_s and drop any banked burst. Other
+        errors and missing responses leave the rate unchanged.
+
+        Args:
+            endpoint: Endpoint class the request counted against.
+            status_code: HTTP status, or None if no response was received.
+        """
+        if status_code is None:
+            return
+        config = self.configs[endpoint]
+        if status_code < 400:
+            with self._lock:
+                self._pending_increase[endpoint] += config.increase_step
+            return
+        if status_code != _THROTTLE_STATUS and status_code < _SERVER_ERROR:
+            return
+
+        with self._lock:
+            self._pending_increase[endpoint] = 0.0
+            self._stats[endpoint].throttled += 1
+
+        def update(state: dict[str, float], now: float):
+            rate = state.get("rate", config.initial_rate)
+            if now - state.get("decreased", float("-inf")) < config.decrease_cooldown_s:
+                return state, rate
+            # Settle the refill at the old rate before dropping the burst, so
+            # the next acquire() only credits time since the decrease
+            elapsed = max(0.0, now - state.get("updated", now))
+            tokens = min(config.capacity, state.get("tokens", config.capacity) + elapsed * rate)
+            rate = max(config.min_rate, rate * config.decrease_factor)
+            new_state = {
+                **state,
+                "rate": rate,
+                "tokens": min(tokens, 0.0),
+                "updated": now,
+                "decreased": now,
+            }
+            return new_state, rate
+
+        rate = self._transact(endpoint, update)
+        if rate is not None:
+            self.logger.warning(f"{endpoint.value} throttled ({status_code}), rate {rate:.2f}/s")
+            with self._lock:
+                self._stats[endpoint].rate = rate
+
+    def rate(self, endpoint: EndpointClass) -> float:
+        """Return the endpoint's rate as last seen by this process.
+
+        Args:
+            endpoint: Endpoint class.
+
+        Returns:
+            Requests per second.
+        """
+        with self._lock:
+            return self._stats[endpoint].rate
+
+    def stats(self) -> list[RateLimitStats]:
+        """Return a snapshot of this process's limiter metrics.
+
+        Returns:
+            One RateLimitStats per endpoint class.
+        """
+        with self._lock:
+            return [replace(stats) for stats in self._stats.values()]
+
+    def _maybe_publish(self) -> None:
+        """Hand stats to the metrics sink at most once per interval."""
+        if self.metrics_sink is None:
+            return
+        now = time.monotonic()
+        with self._lock:
+            if now - self._last_publish < self.metrics_interval_s:
+                return
+            self._last_publish = now
+        try:
+            self.metrics_sink(self.stats())
+        except Exception as e:
+            self.logger.warning(f"Failed to publish rate limit metrics: {e}")
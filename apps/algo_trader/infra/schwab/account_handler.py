@@ -7,6 +7,9 @@ information, positions, and balances from Schwab's account endpoints.
 from typing import Any
 
 from infrastructure.logging.logger import get_logger
+from system.algo_trader.domain.models import Positions
+from system.algo_trader.infra.redis.rate_limiter import SharedRateLimiter
+from system.algo_trader.infra.schwab.decoding import decode_positions
 from system.algo_trader.infra.schwab.schwab_client import SchwabClient
 
 
@@ -17,9 +20,13 @@ class AccountHandler(SchwabClient):
     operations. Inherits from SchwabClient for authentication and token management.
     """
 
-    def __init__(self):
-        """Initialize AccountHandler with account API endpoint."""
-        super().__init__()
+    def __init__(self, rate_limiter: SharedRateLimiter | None = None):
+        """Initialize AccountHandler with account API endpoint.
+
+        Args:
+            rate_limiter: Optional rate limiter shared with other handlers.
+        """
+        super().__init__(rate_limiter=rate_limiter)
         self.account_url = f"{self.base_url}/trader/v1"
         self.logger = get_logger(self.__class__.__name__)
         self.logger.info("AccountHandler initialized successfully")
@@ -83,6 +90,27 @@ class AccountHandler(SchwabClient):
             self.logger.error(f"Failed to get positions: {response.status_code} - {response.text}")
             return {}
 
+    def get_positions_snapshot(self, account_number: str) -> Positions | None:
+        """Get positions for a specific account as the domain Positions model.
+
+        Unlike get_positions, the raw response body is decoded in one pass
+        (with orjson when installed), skipping the intermediate dicts.
+
+        Args:
+            account_number: The account number to get positions for
+
+        Returns:
+            Positions, or None if the request failed
+        """
+        url = f"{self.account_url}/accounts/{account_number}/positions"
+        response = self.make_authenticated_request("GET", url)
+
+        if response.status_code == 200:
+            return decode_positions(response.content)
+        else:
+            self.logger.error(f"Failed to get positions: {response.status_code} - {response.text}")
+            return None
+
     def get_orders(self, account_number: str) -> dict[str, Any]:
         """Get orders for a specific account.
 
@@ -6,20 +6,37 @@ token retrieval, refresh, and loading from environment variables.
 
 import base64
 import os
+import threading
 import time
+from concurrent.futures import Future
 
 import requests
 
 from infrastructure.logging.logger import get_logger
-from system.algo_trader.infra.redis.account import AccountBroker
+from system.algo_trader.infra.redis.account import (
+    TOKEN_REFRESH_FAILED,
+    TOKEN_REFRESH_SKIPPED,
+    TOKEN_REFRESHED,
+    AccountBroker,
+)
 from system.algo_trader.infra.schwab.auth.oauth2 import OAuth2Handler
 
+REFRESH_LOCK_NAME = "token-refresh"
+
+# Minimum spacing between background refresh-ahead attempts
+REFRESH_AHEAD_RETRY_S = 30.0
+
 
 class TokenManager:
     """Manages OAuth2 access tokens for Schwab API.
 
     Handles token lifecycle including retrieval, refresh, and validation.
-    Uses distributed locking to prevent concurrent refresh operations.
+    Refreshes are single-flight: concurrent callers in one process share one
+    in-flight refresh, and across processes only the holder of the Redis
+    refresh lock talks to Schwab while the others wait for its outcome on a
+    pub/sub channel instead of polling. Once the token is within
+    refresh_ahead_s of expiry, a background refresh replaces it before
+    callers see it expire.
 
     Args:
         api_key: Schwab API key (client ID).
@@ -28,9 +45,14 @@ class TokenManager:
         account_broker: AccountBroker instance for token storage.
         oauth2_handler: OAuth2Handler instance for token refresh.
         logger: Optional logger instance. If not provided, creates a new logger.
+        refresh_ahead_s: Remaining token lifetime at which a background
+            refresh starts.
+        lock_ttl_s: Expiry of the refresh lock, bounding how long a crashed
+            holder can stall other processes.
+        wait_timeout_s: Longest a caller waits for another process's refresh.
     """
 
-    def __init__(
+    def __init__(  # noqa: PLR0913
         self,
         api_key: str,
         secret: str,
@@ -38,6 +60,9 @@ class TokenManager:
         account_broker: AccountBroker,
         oauth2_handler: OAuth2Handler,
         logger=None,
+        refresh_ahead_s: float = 300.0,
+        lock_ttl_s: int = 10,
+        wait_timeout_s: float = 30.0,
     ):
         """Initialize TokenManager with API credentials and handlers.
 
@@ -48,6 +73,10 @@ class TokenManager:
             account_broker: AccountBroker instance for token storage.
             oauth2_handler: OAuth2Handler instance for token refresh.
             logger: Optional logger instance. If not provided, creates a new logger.
+            refresh_ahead_s: Remaining token lifetime that triggers a
+                background refresh.
+            lock_ttl_s: Expiry of the cross-process refresh lock.
+            wait_timeout_s: Longest wait for another process's refresh.
         """
         self.api_key = api_key
         self.secret = secret
@@ -55,73 +84,273 @@ class TokenManager:
         self.account_broker = account_broker
         self.oauth2_handler = oauth2_handler
         self.logger = logger or get_logger(self.__class__.__name__)
+        self.refresh_ahead_s = refresh_ahead_s
+        self.lock_ttl_s = lock_ttl_s
+        self.wait_timeout_s = wait_timeout_s
+        self._flight_lock = threading.Lock()
+        self._flight: tuple[Future, bool] | None = None
+        self._refresh_ahead_after = 0.0
 
     def get_valid_access_token(self) -> str:
         """Get a valid access token, refreshing if necessary.
 
-        Retrieves access token from Redis, or refreshes it if not available.
-        Uses distributed locking to prevent concurrent refresh operations.
-
         Returns:
             Valid access token string.
 
         Raises:
-            Exception: If token refresh fails or is blocked by another thread.
+            Exception: If token refresh fails here or in another process.
+        """
+        return self.get_valid_access_token_with_ttl()[0]
+
+    def get_valid_access_token_with_ttl(self) -> tuple[str, int]:
+        """Get a valid access token and its remaining lifetime.
+
+        Returns the token from Redis if present, starting a background
+        refresh when it is within refresh_ahead_s of expiry. Otherwise the
+        caller joins this process's in-flight refresh or starts one.
+
+        Returns:
+            Tuple of (access token, seconds until expiry in Redis, negative
+            if unknown).
+
+        Raises:
+            Exception: If token refresh fails here or in another process.
         """
         self.logger.debug("Attempting to get valid access token")
 
         access_token = self.account_broker.get_access_token()
         if access_token:
             self.logger.debug("Found valid access token in Redis")
-            return access_token
+            ttl = self.account_broker.get_access_token_ttl()
+            if 0 < ttl <= self.refresh_ahead_s:
+                self._start_refresh_ahead()
+            return access_token, ttl
 
         self.logger.info("No valid access token in Redis, attempting refresh")
+        access_token = self._join_refresh(proactive=False)
+        return access_token, self.account_broker.get_access_token_ttl()
+
+    def force_refresh(self, rejected: str) -> str | None:
+        """Replace an access token the API rejected before its TTL ran out.
+
+        Under the refresh lock, the rejected token is deleted if Redis still
+        holds it; the caller then joins the usual single-flight refresh. A
+        token already replaced by another caller or process is returned as is,
+        so a burst of 401s across processes posts one refresh grant.
+
+        Args:
+            rejected: Access token sent with the rejected request.
+
+        Returns:
+            The replacement access token.
 
-        lock_name = "token-refresh"
-        if self.account_broker.acquire_lock(lock_name, ttl=10, retry_interval=0.1, max_retries=50):
+        Raises:
+            Exception: If the refresh fails here or in another process.
+        """
+        if self.account_broker.acquire_lock(REFRESH_LOCK_NAME, ttl=self.lock_ttl_s, max_retries=1):
             try:
-                access_token = self.account_broker.get_access_token()
-                if access_token:
-                    self.logger.info("Access token was refreshed by another thread")
-                    return access_token
+                if self.account_broker.get_access_token() == rejected:
+                    self.logger.info("Access token rejected, deleting it before refresh")
+                    self.account_broker.delete_access_token()
+            finally:
+                self.account_broker.release_lock(REFRESH_LOCK_NAME)
+        return self._join_refresh(proactive=False)
+
+    def _start_refresh_ahead(self) -> None:
+        """Refresh the still-valid token in a background thread."""
+        with self._flight_lock:
+            now = time.monotonic()
+            if self._flight is not None or now < self._refresh_ahead_after:
+                return
+            self._refresh_ahead_after = now + REFRESH_AHEAD_RETRY_S
+        self.logger.info("Access token close to expiry, refreshing ahead")
+        threading.Thread(
+            target=self._refresh_ahead, name="token-refresh-ahead", daemon=True
+        ).start()
+
+    def _refresh_ahead(self) -> None:
+        """Background thread body for _start_refresh_ahead."""
+        try:
+            self._join_refresh(proactive=True)
+        except Exception as e:
+            self.logger.error(f"Token refresh-ahead failed: {e}")
 
-                self.logger.info("Lock acquired, refreshing token")
+    def _join_refresh(self, proactive: bool) -> str | None:
+        """Run this process's single in-flight refresh, or wait for it.
 
-                if self.refresh_token():
-                    access_token = self.account_broker.get_access_token()
-                    if access_token:
-                        self.logger.info("Successfully refreshed access token from Redis")
-                        return access_token
+        Args:
+            proactive: Refresh ahead of expiry; only the refresh token is
+                tried and failure returns None instead of raising.
 
-                self.logger.info("Redis refresh failed, checking environment file")
+        Returns:
+            Refreshed access token, or None if a proactive refresh failed.
 
-                if self.load_token():
-                    if self.refresh_token():
-                        access_token = self.account_broker.get_access_token()
-                        if access_token:
-                            self.logger.info("Successfully refreshed access token from env file")
-                            return access_token
+        Raises:
+            Exception: If a blocking refresh fails.
+        """
+        while True:
+            with self._flight_lock:
+                leader = self._flight is None
+                if leader:
+                    self._flight = (Future(), proactive)
+                future, flight_proactive = self._flight
+
+            if leader:
+                try:
+                    token = self._refresh_across_processes(proactive)
+                except Exception as e:
+                    with self._flight_lock:
+                        self._flight = None
+                    future.set_exception(e)
+                    raise
+                with self._flight_lock:
+                    self._flight = None
+                future.set_result(token)
+                return token
+
+            self.logger.debug("Joining in-flight token refresh")
+            token = future.result()
+            # A failed refresh-ahead leaves blocking callers to refresh for real
+            if token is not None or proactive or not flight_proactive:
+                return token
+
+    def _refresh_across_processes(self, proactive: bool) -> str | None:
+        """Refresh under the Redis lock, or wait for the process holding it.
+
+        The lock holder announces the outcome on the token events channel
+        after releasing the lock. If a holder dies, its lock expires after
+        lock_ttl_s and a waiter takes over.
 
-                self.logger.warning("All refresh attempts failed, initiating OAuth2 flow")
+        Args:
+            proactive: Refresh ahead of expiry rather than on a missing token.
 
-                tokens = self.oauth2_handler.authenticate()
-                if tokens and tokens.get("access_token"):
-                    self.logger.info("OAuth2 flow completed successfully")
-                    return tokens["access_token"]
+        Returns:
+            Access token, or None if a proactive refresh did not produce one.
 
-                raise Exception("Unable to obtain valid access token after all attempts")
-            finally:
-                self.account_broker.release_lock(lock_name)
-        else:
-            self.logger.info("Another thread is refreshing token, waiting...")
-            time.sleep(0.5)
+        Raises:
+            Exception: If the refresh fails or waiting times out.
+        """
+        deadline = time.monotonic() + self.wait_timeout_s
+        while True:
+            if self.account_broker.acquire_lock(
+                REFRESH_LOCK_NAME, ttl=self.lock_ttl_s, max_retries=1
+            ):
+                try:
+                    token = self._refresh_holding_lock(proactive)
+                except Exception:
+                    self.account_broker.release_lock(REFRESH_LOCK_NAME)
+                    self.account_broker.publish_token_event(TOKEN_REFRESH_FAILED)
+                    raise
+                self.account_broker.release_lock(REFRESH_LOCK_NAME)
+                self.account_broker.publish_token_event(
+                    TOKEN_REFRESHED if token else TOKEN_REFRESH_SKIPPED
+                )
+                return token
+
+            if proactive:
+                self.logger.debug("Another process is refreshing the token")
+                return None
+
+            self.logger.info("Another process is refreshing token, waiting...")
+            access_token = self._wait_for_refresh(min(deadline, time.monotonic() + self.lock_ttl_s))
+            if access_token:
+                self.logger.info("Successfully retrieved access token refreshed by another process")
+                return access_token
+            if time.monotonic() >= deadline:
+                raise Exception("Timed out waiting for token refresh by another process")
+
+    def _wait_for_refresh(self, until: float) -> str | None:
+        """Wait for the lock holder's refresh outcome.
+
+        Args:
+            until: Monotonic time to stop waiting.
 
+        Returns:
+            The refreshed token, or None if the lock should be retried.
+
+        Raises:
+            Exception: If the other process reported a failed refresh.
+        """
+        pubsub = self.account_broker.subscribe_token_events()
+        if pubsub is None:
+            time.sleep(max(0.0, min(1.0, until - time.monotonic())))
+            return self.account_broker.get_access_token()
+        try:
+            # The refresh may have completed before the subscription started
             access_token = self.account_broker.get_access_token()
             if access_token:
-                self.logger.info("Successfully retrieved access token refreshed by another thread")
                 return access_token
+            while (remaining := until - time.monotonic()) > 0:
+                message = pubsub.get_message(timeout=remaining)
+                if message is None:
+                    continue
+                event = message["data"]
+                if isinstance(event, bytes):
+                    event = event.decode()
+                if event == TOKEN_REFRESHED:
+                    return self.account_broker.get_access_token()
+                if event == TOKEN_REFRESH_FAILED:
+                    raise Exception("Token refresh by another process failed")
+                return None
+            return None
+        finally:
+            pubsub.close()
+
+    def _refresh_holding_lock(self, proactive: bool) -> str | None:
+        """Obtain a new access token while holding the refresh lock.
+
+        A blocking refresh tries the refresh token from Redis, then from the
+        environment, then the interactive OAuth2 flow. A proactive refresh
+        only tries the Redis refresh token.
+
+        Args:
+            proactive: Refresh ahead of expiry rather than on a missing token.
+
+        Returns:
+            Access token, or None if a proactive refresh failed.
+
+        Raises:
+            Exception: If every blocking refresh attempt fails.
+        """
+        if proactive:
+            if self.account_broker.get_access_token_ttl() > self.refresh_ahead_s:
+                self.logger.info("Access token was refreshed by another process")
+                return self.account_broker.get_access_token()
+            if self.refresh_token():
+                return self.account_broker.get_access_token()
+            self.logger.warning("Refresh-ahead failed, the token will be refreshed on expiry")
+            return None
+
+        access_token = self.account_broker.get_access_token()
+        if access_token:
+            self.logger.info("Access token was refreshed by another thread")
+            return access_token
+
+        self.logger.info("Lock acquired, refreshing token")
+
+        if self.refresh_token():
+            access_token = self.account_broker.get_access_token()
+            if access_token:
+                self.logger.info("Successfully refreshed access token from Redis")
+                return access_token
+
+        self.logger.info("Redis refresh failed, checking environment file")
+
+        if self.load_token():
+            if self.refresh_token():
+                access_token = self.account_broker.get_access_token()
+                if access_token:
+                    self.logger.info("Successfully refreshed access token from env file")
+                    return access_token
+
+        self.logger.warning("All refresh attempts failed, initiating OAuth2 flow")
+
+        tokens = self.oauth2_handler.authenticate()
+        if tokens and tokens.get("access_token"):
+            self.logger.info("OAuth2 flow completed successfully")
+            return tokens["access_token"]
 
-            raise Exception("Token refresh by another thread failed")
+        raise Exception("Unable to obtain valid access token after all attempts")
 
     def refresh_token(self) -> bool:
         """Refresh access token using refresh token.
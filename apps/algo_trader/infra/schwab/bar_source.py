@@ -0,0 +1,129 @@
+"""Schwab price history as an incremental per-symbol bar source.
+
+This module provides SchwabBarSource, an IncrementalHistoricalPort over
+MarketHandler.get_price_history. The first request for a symbol fetches the
+configured period window; later requests pass the cutoff as startDate, so
+CachingHistoricalPort refreshes a window with a few candles per tick instead
+of the whole history.
+"""
+
+from collections.abc import Callable
+from datetime import datetime, timezone
+from typing import Any
+
+import pandas as pd
+
+from infrastructure.logging.logger import get_logger
+from system.algo_trader.domain.ports.historical_port import IncrementalHistoricalPort
+from system.algo_trader.infra.schwab.market_handler import MarketHandler
+from system.algo_trader.infra.schwab.timescale_enum import FrequencyType, PeriodType
+
+# Bar frequency labels (as used by BarStore and CachingHistoricalPort) to Schwab units
+SCHWAB_FREQUENCIES: dict[str, tuple[FrequencyType, int]] = {
+    "1m": (FrequencyType.MINUTE, 1),
+    "5m": (FrequencyType.MINUTE, 5),
+    "10m": (FrequencyType.MINUTE, 10),
+    "15m": (FrequencyType.MINUTE, 15),
+    "30m": (FrequencyType.MINUTE, 30),
+    "1D": (FrequencyType.DAILY, 1),
+    "1W": (FrequencyType.WEEKLY, 1),
+    "1M": (FrequencyType.MONTHLY, 1),
+}
+
+OHLCV_COLUMNS = ["open", "high", "low", "close", "volume"]
+
+
+def candles_to_frame(history: dict[str, Any]) -> pd.DataFrame:
+    """Convert a Schwab price-history response into an OHLCV DataFrame.
+
+    Args:
+        history: Response with a "candles" list of epoch-millisecond bars.
+
+    Returns:
+        Float OHLCV columns indexed by UTC bar time, oldest first.
+    """
+    candles = history.get("candles") or []
+    index = pd.to_datetime([c["datetime"] for c in candles], unit="ms", utc=True)
+    frame = pd.DataFrame(
+        {name: [float(c.get(name, "nan")) for c in candles] for name in OHLCV_COLUMNS},
+        index=index,
+    )
+    return frame.sort_index()
+
+
+class SchwabBarSource(IncrementalHistoricalPort):
+    """IncrementalHistoricalPort backed by the Schwab pricehistory endpoint.
+
+    Args:
+        market_handler: Handler used for the requests.
+        period_type: Period type of the full window fetched on a cache miss.
+        period: Number of periods in the full window.
+        extended_hours: Whether to include extended hours bars.
+        clock: Optional callable returning the request end time.
+    """
+
+    def __init__(
+        self,
+        market_handler: MarketHandler,
+        period_type: PeriodType = PeriodType.YEAR,
+        period: int = 1,
+        extended_hours: bool = False,
+        clock: Callable[[], datetime] | None = None,
+    ):
+        """Initialize the source.
+
+        Args:
+            market_handler: Handler used for the requests.
+            period_type: Period type of the full window fetched on a cache miss.
+            period: Number of periods in the full window.
+            extended_hours: Whether to include extended hours bars.
+            clock: Optional callable returning the request end time.
+        """
+        self.logger = get_logger(self.__class__.__name__)
+        self.market_handler = market_handler
+        self.period_type = period_type
+        self.period = period
+        self.extended_hours = extended_hours
+        self.clock = clock or (lambda: datetime.now(timezone.utc))
+
+    def get_bars(self, symbol: str, frequency: str, since: datetime | None) -> pd.DataFrame:
+        """Retrieve OHLCV bars for a single symbol.
+
+        Args:
+            symbol: Trading symbol.
+            frequency: Bar frequency label, a key of SCHWAB_FREQUENCIES.
+            since: Only request bars from this time on (naive times are taken
+                as UTC); None requests the configured period window.
+
+        Returns:
+            DataFrame of OHLCV columns indexed by UTC bar time, oldest first.
+
+        Raises:
+            ValueError: If the frequency has no Schwab equivalent.
+            ConnectionError: If the request failed after its retries.
+        """
+        if frequency not in SCHWAB_FREQUENCIES:
+            raise ValueError(f"Unsupported bar frequency '{frequency}'")
+        frequency_type, frequency_value = SCHWAB_FREQUENCIES[frequency]
+        if since is not None and since.tzinfo is None:
+            since = since.replace(tzinfo=timezone.utc)
+        # Schwab ends the range at the previous close unless endDate is given
+        history = self.market_handler.get_price_history(
+            symbol,
+            self.period_type,
+            self.period,
+            frequency_type,
+            frequency_value,
+            self.extended_hours,
+            start_date=since,
+            end_date=self.clock() if since is not None else None,
+        )
+        if "_error_status" in history:
+            raise ConnectionError(
+                f"Price history for {symbol} failed with status {history['_error_status']}"
+            )
+        frame = candles_to_frame(history)
+        if since is not None:
+            frame = frame[frame.index >= pd.Timestamp(since)]
+        self.logger.debug(f"Fetched {len(frame)} {frequency} bars for {symbol}")
+        return frame
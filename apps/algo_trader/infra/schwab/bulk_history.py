@@ -0,0 +1,273 @@
+"""Bulk price-history downloads for large symbol universes.
+
+This module provides BulkPriceHistoryDownloader, which fetches price history
+for many tickers concurrently under a shared TokenBucket. Transient errors are
+retried from a schedule kept by the dispatching thread, so worker threads never
+sleep on a backoff and retries overlap with other tickers' requests. Each
+result is handed to a caller-provided PriceHistorySink as soon as it
+completes. An append-only DownloadCheckpoint records finished tickers so an
+interrupted backfill resumes where it stopped.
+"""
+
+import heapq
+import os
+import threading
+import time
+from abc import ABC, abstractmethod
+from collections.abc import Callable, Iterable
+from concurrent.futures import FIRST_COMPLETED, Future, ThreadPoolExecutor, wait
+from dataclasses import dataclass, field
+from typing import Any
+
+from infrastructure.logging.logger import get_logger
+from system.algo_trader.infra.schwab.rate_limit import TokenBucket
+
+# Status codes worth retrying: throttling and transient server errors
+RETRYABLE_STATUSES = frozenset({429, 500, 502, 503, 504})
+
+FetchResult = tuple[dict[str, Any] | None, int | None]
+
+
+class PriceHistorySink(ABC):
+    """Destination for downloaded price history (e.g., InfluxDB or Parquet).
+
+    write() is called from the downloader's dispatching thread only, one
+    ticker at a time, so implementations need no locking.
+    """
+
+    @abstractmethod
+    def write(self, ticker: str, history: dict[str, Any]) -> None:
+        """Store one ticker's price history.
+
+        Args:
+            ticker: Symbol the history belongs to.
+            history: Schwab price-history response (symbol, candles, ...).
+        """
+        ...
+
+    def close(self) -> None:
+        """Flush and release resources once the download finishes."""
+
+
+class DownloadCheckpoint:
+    """Append-only record of finished tickers.
+
+    Each finished ticker is one "TICKER<TAB>STATUS" line, flushed as it is
+    written, so a crash loses at most the line being written. Tickers that
+    exhausted their retries on transient errors are not recorded and are
+    fetched again on resume.
+
+    Args:
+        path: Checkpoint file; created if missing.
+    """
+
+    def __init__(self, path: str):
+        """Load finished tickers from an existing checkpoint.
+
+        Args:
+            path: Checkpoint file; created if missing.
+        """
+        self.path = path
+        self.finished: dict[str, str] = {}
+        if os.path.exists(path):
+            with open(path, encoding="utf-8") as f:
+                for line in f:
+                    ticker, sep, status = line.rstrip("\n").partition("\t")
+                    if sep and status:
+                        self.finished[ticker] = status
+        self._file = open(path, "a", encoding="utf-8")  # noqa: SIM115
+
+    def __contains__(self, ticker: str) -> bool:
+        """Return True if the ticker finished in an earlier or current run."""
+        return ticker in self.finished
+
+    def mark(self, ticker: str, status: str) -> None:
+        """Record a finished ticker.
+
+        Args:
+            ticker: Finished symbol.
+            status: "ok", "empty" or the non-retryable HTTP status.
+        """
+        self.finished[ticker] = status
+        self._file.write(f"{ticker}\t{status}\n")
+        self._file.flush()
+
+    def close(self) -> None:
+        """Close the checkpoint file."""
+        self._file.close()
+
+
+@dataclass
+class BulkDownloadResult:
+    """Outcome of a bulk download.
+
+    Attributes:
+        completed: Tickers written to the sink.
+        empty: Tickers the API returned no candles for.
+        failed: Tickers that failed, with their last status code.
+        skipped: Tickers already finished according to the checkpoint.
+        requests: HTTP requests made, including retries.
+        elapsed_s: Wall-clock duration.
+    """
+
+    completed: list[str] = field(default_factory=list)
+    empty: list[str] = field(default_factory=list)
+    failed: dict[str, int | None] = field(default_factory=dict)
+    skipped: int = 0
+    requests: int = 0
+    elapsed_s: float = 0.0
+
+
+class BulkPriceHistoryDownloader:
+    """Concurrent, rate-limited, resumable price-history downloader.
+
+    Args:
+        fetch: Single-attempt request for one ticker, returning
+            (response, status_code) like MarketHandler._send_request.
+        sink: Destination for each completed ticker.
+        rate_budget: Shared request budget; every attempt takes one token.
+        max_workers: Concurrent requests in flight.
+        max_retries: Retries per ticker for RETRYABLE_STATUSES and network errors.
+        retry_delay_s: Base backoff; attempt n waits retry_delay_s * 2**(n - 1).
+        checkpoint: Optional progress record for resuming.
+    """
+
+    def __init__(  # noqa: PLR0913
+        self,
+        fetch: Callable[[str], FetchResult],
+        sink: PriceHistorySink,
+        rate_budget: TokenBucket,
+        max_workers: int = 8,
+        max_retries: int = 3,
+        retry_delay_s: float = 1.0,
+        checkpoint: DownloadCheckpoint | None = None,
+    ):
+        """Initialize the downloader.
+
+        Args:
+            fetch: Single-attempt request for one ticker.
+            sink: Destination for each completed ticker.
+            rate_budget: Shared request budget.
+            max_workers: Concurrent requests in flight.
+            max_retries: Retries per ticker for transient errors.
+            retry_delay_s: Base exponential backoff in seconds.
+            checkpoint: Optional progress record for resuming.
+        """
+        self.logger = get_logger(self.__class__.__name__)
+        self.fetch = fetch
+        self.sink = sink
+        self.rate_budget = rate_budget
+        self.max_workers = max_workers
+        self.max_retries = max_retries
+        self.retry_delay_s = retry_delay_s
+        self.checkpoint = checkpoint
+        self._stop = threading.Event()
+
+    def stop(self) -> None:
+        """Ask a running download to return once in-flight requests finish.
+
+        Unstarted tickers and pending retries are left for a resumed run.
+        """
+        self._stop.set()
+
+    def _attempt(self, ticker: str) -> FetchResult:
+        """Run one rate-limited request in a worker thread."""
+        self.rate_budget.acquire()
+        try:
+            return self.fetch(ticker)
+        except Exception as e:
+            self.logger.error(f"Request for {ticker} failed: {e}")
+            return None, None
+
+    def _finish(self, result: BulkDownloadResult, ticker: str, response, status) -> None:
+        """Deliver a final outcome to the sink, result and checkpoint."""
+        if response is not None:
+            if response.get("empty") or not response.get("candles"):
+                result.empty.append(ticker)
+                outcome = "empty"
+            else:
+                self.sink.write(ticker, response)
+                result.completed.append(ticker)
+                outcome = "ok"
+        else:
+            result.failed[ticker] = status
+            if status in RETRYABLE_STATUSES or status is None:
+                self.logger.error(f"Giving up on {ticker} after transient error {status}")
+                return
+            outcome = str(status)
+        if self.checkpoint is not None:
+            self.checkpoint.mark(ticker, outcome)
+
+    def download(self, tickers: Iterable[str]) -> BulkDownloadResult:
+        """Download price history for every ticker.
+
+        Args:
+            tickers: Symbols to fetch; duplicates and checkpointed symbols are
+                skipped.
+
+        Returns:
+            BulkDownloadResult summarizing the run.
+        """
+        start = time.monotonic()
+        self._stop.clear()
+        result = BulkDownloadResult()
+        queue: list[str] = []
+        seen: set[str] = set()
+        for ticker in tickers:
+            if ticker in seen:
+                continue
+            seen.add(ticker)
+            if self.checkpoint is not None and ticker in self.checkpoint:
+                result.skipped += 1
+            else:
+                queue.append(ticker)
+        queue.reverse()
+        self.logger.info(f"Downloading {len(queue)} tickers ({result.skipped} already done)")
+
+        retries: list[tuple[float, str, int]] = []
+        in_flight: dict[Future, tuple[str, int]] = {}
+        with ThreadPoolExecutor(
+            max_workers=self.max_workers, thread_name_prefix="price-history"
+        ) as executor:
+            while in_flight or ((queue or retries) and not self._stop.is_set()):
+                now = time.monotonic()
+                while (
+                    not self._stop.is_set()
+                    and len(in_flight) < self.max_workers
+                    and ((retries and retries[0][0] <= now) or queue)
+                ):
+                    if retries and retries[0][0] <= now:
+                        _, ticker, attempt = heapq.heappop(retries)
+                    else:
+                        ticker, attempt = queue.pop(), 0
+                    in_flight[executor.submit(self._attempt, ticker)] = (ticker, attempt)
+                    result.requests += 1
+
+                timeout = None
+                if retries and len(in_flight) < self.max_workers:
+                    timeout = max(0.0, retries[0][0] - time.monotonic())
+                if not in_flight:
+                    self._stop.wait(timeout)
+                    continue
+                done, _ = wait(in_flight, timeout=timeout, return_when=FIRST_COMPLETED)
+                for future in done:
+                    ticker, attempt = in_flight.pop(future)
+                    response, status = future.result()
+                    retryable = response is None and (
+                        status in RETRYABLE_STATUSES or status is None
+                    )
+                    if retryable and attempt < self.max_retries:
+                        delay = self.retry_delay_s * 2**attempt
+                        self.logger.warning(
+                            f"Error {status} for {ticker}, retry {attempt + 1} in {delay:.1f}s"
+                        )
+                        heapq.heappush(retries, (time.monotonic() + delay, ticker, attempt + 1))
+                    else:
+                        self._finish(result, ticker, response, status)
+
+        result.elapsed_s = time.monotonic() - start
+        self.logger.info(
+            f"Downloaded {len(result.completed)} tickers, {len(result.empty)} empty, "
+            f"{len(result.failed)} failed in {result.elapsed_s:.1f}s"
+        )
+        return result
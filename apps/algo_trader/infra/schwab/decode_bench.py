@@ -0,0 +1,294 @@
+"""Benchmark for decoding Schwab quote, option chain and position payloads.
+
+Times the existing dict path (json.loads followed by
+MarketHandler._extract_quote_data) against the single-pass decoders in
+system.algo_trader.infra.schwab.decoding, with both the standard library
+parser and orjson. Prints the environment (Python, numpy and orjson versions,
+machine) as a first JSON line, then one line per case with the best and median
+time in milliseconds, so quoted timings can be tied to where they were taken.
+
+Payloads are either recorded response bodies or synthetic ones shaped like
+Schwab's. Record a quotes payload with --record (requires a valid token):
+
+Example:
+    python -m system.algo_trader.infra.schwab.decode_bench --record quotes.json \\
+        --tickers AAPL MSFT NVDA
+    python -m system.algo_trader.infra.schwab.decode_bench --quotes quotes.json --repeat 200
+    python -m system.algo_trader.infra.schwab.decode_bench --symbols 500 --contracts 20000
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import platform
+import statistics
+import time
+from collections.abc import Callable, Iterator
+from contextlib import contextmanager
+from datetime import datetime, timezone
+from pathlib import Path
+from types import SimpleNamespace
+from typing import Any
+
+from infrastructure.logging.logger import get_logger
+from system.algo_trader.domain.models import Quote
+from system.algo_trader.infra.schwab import decoding
+from system.algo_trader.infra.schwab.market_handler import MarketHandler
+
+logger = get_logger("decode_bench")
+
+
+def synthetic_quotes(count: int) -> bytes:
+    """Build a quotes payload for count symbols in Schwab's response shape."""
+    payload = {}
+    for i in range(count):
+        symbol = f"SYM{i:04d}"
+        price = 100.0 + i * 0.25
+        payload[symbol] = {
+            "assetMainType": "EQUITY",
+            "symbol": symbol,
+            "realtime": True,
+            "quote": {
+                "52WeekHigh": price * 1.3,
+                "52WeekLow": price * 0.7,
+                "askPrice": price + 0.01,
+                "askSize": 200,
+                "bidPrice": price - 0.01,
+                "bidSize": 300,
+                "closePrice": price - 0.5,
+                "highPrice": price + 1.0,
+                "lastPrice": price,
+                "lastSize": 100,
+                "lowPrice": price - 1.0,
+                "mark": price,
+                "netChange": 0.5,
+                "netPercentChange": 0.5 / price * 100,
+                "openPrice": price - 0.25,
+                "quoteTime": 1_700_000_000_000 + i,
+                "totalVolume": 1_000_000 + i,
+                "tradeTime": 1_700_000_000_000 + i,
+            },
+            "reference": {"description": f"Synthetic {i}", "exchange": "Q"},
+        }
+    return json.dumps(payload).encode()
+
+
+def synthetic_positions(count: int) -> bytes:
+    """Build an account payload with count positions in Schwab's response shape."""
+    positions = []
+    for i in range(count):
+        price = 50.0 + i
+        positions.append(
+            {
+                "shortQuantity": 0.0,
+                "averagePrice": price - 1.0,
+                "longQuantity": 10.0 + i,
+                "longOpenProfitLoss": 10.0 + i,
+                "shortOpenProfitLoss": 0.0,
+                "instrument": {"assetType": "EQUITY", "symbol": f"SYM{i:04d}"},
+                "marketValue": price * (10.0 + i),
+            }
+        )
+    return json.dumps({"securitiesAccount": {"positions": positions}}).encode()
+
+
+def synthetic_option_chain(count: int, strikes_per_expiry: int = 200) -> bytes:
+    """Build a chains payload with about count contracts in Schwab's response shape."""
+    expiries = max(1, count // (2 * strikes_per_expiry))
+    maps: dict[str, dict[str, dict[str, list[dict[str, Any]]]]] = {
+        "callExpDateMap": {},
+        "putExpDateMap": {},
+    }
+    for e in range(expiries):
+        expiry_key = f"2025-{1 + e // 28 % 12:02d}-{1 + e % 28:02d}:{e + 1}"
+        for side, put_call in (("callExpDateMap", "CALL"), ("putExpDateMap", "PUT")):
+            strikes = {}
+            for k in range(strikes_per_expiry):
+                strike = 4000.0 + 5.0 * k
+                strikes[f"{strike:.1f}"] = [
+                    {
+                        "putCall": put_call,
+                        "symbol": f"SPX   25{e:04d}{put_call[0]}{int(strike * 1000):08d}",
+                        "bid": 10.0 + k * 0.1,
+                        "ask": 10.2 + k * 0.1,
+                        "last": 10.1 + k * 0.1,
+                        "mark": 10.1 + k * 0.1,
+                        "bidSize": 10,
+                        "askSize": 12,
+                        "totalVolume": 100 + k,
+                        "volatility": 18.5,
+                        "delta": 0.5,
+                        "gamma": 0.01,
+                        "theta": -0.2,
+                        "vega": 0.3,
+                        "rho": 0.05,
+                        "openInterest": 1000 + k,
+                        "strikePrice": strike,
+                        "expirationDate": f"{expiry_key.partition(':')[0]}T20:00:00.000+00:00",
+                        "daysToExpiration": e + 1,
+                        "inTheMoney": False,
+                    }
+                ]
+            maps[side][expiry_key] = strikes
+    return json.dumps({"symbol": "$SPX", "underlyingPrice": 4500.0, **maps}).encode()
+
+
+def legacy_quote(payload: bytes) -> Quote:
+    """Decode quotes the way get_quotes callers do: parse, extract, then regroup."""
+    handler = SimpleNamespace(logger=logger)
+    extracted = MarketHandler._extract_quote_data(handler, json.loads(payload))
+    fields = {
+        "bid": "bid",
+        "ask": "ask",
+        "last": "price",
+        "volume": "volume",
+        "change": "change",
+        "change_pct": "change_pct",
+    }
+    maps = {name: {s: q[key] for s, q in extracted.items()} for name, key in fields.items()}
+    return Quote(
+        timestamp=datetime.now(timezone.utc),
+        asset_class="EQUITY",
+        bid_size={},
+        ask_size={},
+        **maps,
+    )
+
+
+def environment() -> dict[str, Any]:
+    """Describe the interpreter, parser libraries and machine a run used."""
+    return {
+        "python": platform.python_version(),
+        "numpy": decoding.np.__version__,
+        "orjson": getattr(decoding.orjson, "__version__", None),
+        "machine": platform.machine(),
+        "processor": platform.processor() or None,
+        "system": platform.system(),
+    }
+
+
+@contextmanager
+def json_parser(use_orjson: bool) -> Iterator[None]:
+    """Temporarily select the JSON parser used by the decoders."""
+    original = decoding.orjson
+    decoding.orjson = original if use_orjson else None
+    try:
+        yield
+    finally:
+        decoding.orjson = original
+
+
+def time_case(func: Callable[[bytes], Any], payload: bytes, repeat: int) -> tuple[float, float]:
+    """Return the best and median time of func(payload) in milliseconds."""
+    func(payload)
+    samples = []
+    for _ in range(repeat):
+        start = time.perf_counter()
+        func(payload)
+        samples.append((time.perf_counter() - start) * 1000.0)
+    return min(samples), statistics.median(samples)
+
+
+def run(
+    quotes: bytes, positions: bytes, repeat: int, options: bytes | None = None
+) -> list[dict[str, Any]]:
+    """Time every decoder on the given payloads.
+
+    Args:
+        quotes: Quotes response body.
+        positions: Account-with-positions response body.
+        repeat: Timed runs per case.
+        options: Optional option chains response body.
+
+    Returns:
+        One result dict per case.
+    """
+    cases = [
+        ("quotes", "json+extract", False, legacy_quote, quotes),
+        ("quotes", "json+decode_quote", False, decoding.decode_quote, quotes),
+        ("quotes", "json+decode_quote_batch", False, decoding.decode_quote_batch, quotes),
+        ("positions", "json+decode_positions", False, decoding.decode_positions, positions),
+    ]
+    decode_chain = decoding.decode_option_chain
+    if options is not None:
+        cases.append(("options", "json+decode_option_chain", False, decode_chain, options))
+    if decoding.orjson is not None:
+        cases += [
+            ("quotes", "orjson+decode_quote", True, decoding.decode_quote, quotes),
+            ("quotes", "orjson+decode_quote_batch", True, decoding.decode_quote_batch, quotes),
+            ("positions", "orjson+decode_positions", True, decoding.decode_positions, positions),
+        ]
+        if options is not None:
+            cases.append(("options", "orjson+decode_option_chain", True, decode_chain, options))
+    else:
+        logger.warning("orjson is not installed; only standard library cases are timed")
+
+    results = []
+    for payload_name, decoder, use_orjson, func, payload in cases:
+        with json_parser(use_orjson):
+            best_ms, median_ms = time_case(func, payload, repeat)
+        results.append(
+            {
+                "payload": payload_name,
+                "decoder": decoder,
+                "bytes": len(payload),
+                "best_ms": round(best_ms, 4),
+                "median_ms": round(median_ms, 4),
+            }
+        )
+    return results
+
+
+def record(path: str, tickers: list[str]) -> None:
+    """Fetch a live quotes response body and save it for later runs."""
+    handler = MarketHandler()
+    response = handler.make_authenticated_request(
+        "GET", f"{handler.market_url}/quotes", params={"symbols": ",".join(tickers)}
+    )
+    if response.status_code != 200:
+        raise SystemExit(f"Quote request failed with status {response.status_code}")
+    Path(path).write_bytes(response.content)
+    logger.info(f"Recorded {len(response.content)} bytes to {path}")
+
+
+def main(argv: list[str] | None = None) -> None:
+    """Parse arguments and run or record the benchmark."""
+    parser = argparse.ArgumentParser(description="Schwab payload decoding benchmark")
+    parser.add_argument("--quotes", help="Recorded quotes response body")
+    parser.add_argument("--positions", help="Recorded account-with-positions response body")
+    parser.add_argument("--options", help="Recorded option chains response body")
+    parser.add_argument("--symbols", type=int, default=500, help="Synthetic payload size")
+    parser.add_argument(
+        "--contracts", type=int, default=0, help="Synthetic option chain size (0 to skip)"
+    )
+    parser.add_argument("--repeat", type=int, default=50, help="Timed runs per case")
+    parser.add_argument("--record", help="Fetch live quotes for --tickers into this file")
+    parser.add_argument("--tickers", nargs="+", default=[], help="Symbols to record")
+    args = parser.parse_args(argv)
+
+    if args.record:
+        if not args.tickers:
+            parser.error("--record requires --tickers")
+        record(args.record, args.tickers)
+        return
+
+    quotes = Path(args.quotes).read_bytes() if args.quotes else synthetic_quotes(args.symbols)
+    positions = (
+        Path(args.positions).read_bytes()
+        if args.positions
+        else synthetic_positions(args.symbols)
+    )
+    if args.options:
+        options = Path(args.options).read_bytes()
+    elif args.contracts:
+        options = synthetic_option_chain(args.contracts)
+    else:
+        options = None
+    print(json.dumps({"environment": environment()}), flush=True)
+    for result in run(quotes, positions, args.repeat, options):
+        print(json.dumps(result), flush=True)
+
+
+if __name__ == "__main__":
+    main()
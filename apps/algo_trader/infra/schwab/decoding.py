@@ -0,0 +1,250 @@
+"""Fast decoding of Schwab quote, option chain and position payloads into domain models.
+
+MarketHandler.get_quotes and AccountHandler.get_positions return the parsed
+JSON as nested dicts, which callers then walk again to pick out fields. The
+decoders here take the raw response body, parse it with orjson when it is
+installed (falling back to the standard library parser), and fill the domain
+Quote, QuoteBatch, OptionChain or Positions models in a single pass over the payload, so
+no per-symbol intermediate dicts are built on top of the parsed document.
+"""
+
+from __future__ import annotations
+
+import json
+from datetime import datetime, timezone
+from typing import Any
+
+import numpy as np
+
+from system.algo_trader.domain.models import (
+    OPTION_FIELDS,
+    QUOTE_FIELDS,
+    OptionChain,
+    Position,
+    Positions,
+    Quote,
+    QuoteBatch,
+)
+
+try:
+    import orjson
+except ImportError:  # optional dependency; decoding falls back to json
+    orjson = None
+
+# Schwab quote keys, in QUOTE_FIELDS order
+SCHWAB_QUOTE_KEYS = (
+    "bidPrice",
+    "askPrice",
+    "bidSize",
+    "askSize",
+    "lastPrice",
+    "totalVolume",
+    "netChange",
+    "netPercentChange",
+)
+
+# Schwab option contract keys, in OPTION_FIELDS order
+SCHWAB_OPTION_KEYS = (
+    "strikePrice",
+    "bid",
+    "ask",
+    "last",
+    "mark",
+    "delta",
+    "gamma",
+    "theta",
+    "vega",
+    "rho",
+    "volatility",
+    "openInterest",
+    "totalVolume",
+)
+
+# Schwab reports unavailable greeks and volatility as -999.0
+_OPTION_SENTINEL = -999.0
+
+_NAN = float("nan")
+
+
+def loads(payload: bytes | str) -> Any:
+    """Parse JSON with orjson if available, otherwise the standard library.
+
+    Args:
+        payload: Raw response body.
+
+    Returns:
+        Parsed JSON document.
+    """
+    if orjson is not None:
+        return orjson.loads(payload)
+    return json.loads(payload)
+
+
+def _quote_timestamp(latest_ms: int, default: datetime | None) -> datetime:
+    """Return the newest quote time, or default/now if no quote carried one."""
+    if latest_ms:
+        return datetime.fromtimestamp(latest_ms / 1000.0, tz=timezone.utc)
+    return default or datetime.now(timezone.utc)
+
+
+def decode_quote(payload: bytes | str, timestamp: datetime | None = None) -> Quote:
+    """Decode a /marketdata/v1/quotes response into a Quote.
+
+    Symbols without a quote section (such as the "errors" entry for invalid
+    symbols) are skipped, and missing fields are omitted from their maps.
+
+    Args:
+        payload: Raw response body.
+        timestamp: Quote timestamp if no quote carries a quoteTime; defaults
+            to now.
+
+    Returns:
+        Quote with one map per field.
+    """
+    data = loads(payload)
+    maps: dict[str, dict[str, float]] = {name: {} for name in QUOTE_FIELDS}
+    targets = tuple(zip(SCHWAB_QUOTE_KEYS, (maps[name] for name in QUOTE_FIELDS), strict=True))
+    asset_class = None
+    latest_ms = 0
+    for symbol, entry in data.items():
+        quote = entry.get("quote")
+        if not quote:
+            continue
+        for key, target in targets:
+            value = quote.get(key)
+            if value is not None:
+                target[symbol] = float(value)
+        asset_class = asset_class or entry.get("assetMainType")
+        latest_ms = max(latest_ms, quote.get("quoteTime") or 0)
+
+    return Quote(
+        timestamp=_quote_timestamp(latest_ms, timestamp),
+        asset_class=asset_class or "EQUITY",
+        **maps,
+    )
+
+
+def decode_quote_batch(payload: bytes | str, timestamp: datetime | None = None) -> QuoteBatch:
+    """Decode a /marketdata/v1/quotes response into a columnar QuoteBatch.
+
+    Field values are gathered into one flat list and converted to the value
+    matrix with a single numpy call; missing fields become NaN.
+
+    Args:
+        payload: Raw response body.
+        timestamp: Quote timestamp if no quote carries a quoteTime; defaults
+            to now.
+
+    Returns:
+        QuoteBatch with one column per quoted symbol.
+    """
+    data = loads(payload)
+    symbols = []
+    flat: list[float | None] = []
+    asset_class = None
+    latest_ms = 0
+    for symbol, entry in data.items():
+        quote = entry.get("quote")
+        if not quote:
+            continue
+        symbols.append(symbol)
+        flat.extend([quote.get(key, _NAN) for key in SCHWAB_QUOTE_KEYS])
+        asset_class = asset_class or entry.get("assetMainType")
+        latest_ms = max(latest_ms, quote.get("quoteTime") or 0)
+
+    values = np.array(flat, dtype=np.float64).reshape(len(symbols), len(QUOTE_FIELDS)).T
+    return QuoteBatch(
+        timestamp=_quote_timestamp(latest_ms, timestamp),
+        asset_class=asset_class or "EQUITY",
+        symbols=tuple(symbols),
+        values=values,
+    )
+
+
+def decode_positions(payload: bytes | str, timestamp: datetime | None = None) -> Positions:
+    """Decode an account response with positions into Positions.
+
+    Accepts a single account ({"securitiesAccount": {...}}) or the list
+    returned for all accounts; positions from every account are combined.
+    Short positions have negative quantity, and current_price is derived
+    from the market value.
+
+    Args:
+        payload: Raw response body.
+        timestamp: Positions timestamp; defaults to now.
+
+    Returns:
+        Positions for every non-flat holding.
+    """
+    data = loads(payload)
+    accounts = data if isinstance(data, list) else [data]
+    now = timestamp or datetime.now(timezone.utc)
+    positions = []
+    for account in accounts:
+        for raw in account.get("securitiesAccount", account).get("positions", ()):
+            quantity = int(raw.get("longQuantity", 0) - raw.get("shortQuantity", 0))
+            if quantity == 0:
+                continue
+            market_value = float(raw.get("marketValue", 0.0))
+            if quantity > 0:
+                cost_basis = raw.get("averageLongPrice", raw.get("averagePrice", 0.0))
+            else:
+                cost_basis = raw.get("averageShortPrice", raw.get("averagePrice", 0.0))
+            positions.append(
+                Position(
+                    timestamp=now,
+                    symbol=raw["instrument"]["symbol"],
+                    quantity=quantity,
+                    cost_basis=float(cost_basis),
+                    current_price=market_value / quantity,
+                    pnl_open=float(
+                        raw.get("longOpenProfitLoss", 0.0) + raw.get("shortOpenProfitLoss", 0.0)
+                    ),
+                    net_liquidation=market_value,
+                )
+            )
+    return Positions(timestamp=now, positions=positions)
+
+
+def decode_option_chain(payload: bytes | str, timestamp: datetime | None = None) -> OptionChain:
+    """Decode a /marketdata/v1/chains response into a columnar OptionChain.
+
+    Contracts from callExpDateMap and putExpDateMap (keyed by
+    "YYYY-MM-DD:days" and then by strike) are gathered into flat lists and
+    converted to arrays with one numpy call per column. Missing fields and
+    Schwab's -999.0 placeholders become NaN.
+
+    Args:
+        payload: Raw response body.
+        timestamp: Chain timestamp; defaults to now.
+
+    Returns:
+        OptionChain with one column per contract.
+    """
+    data = loads(payload)
+    symbols = []
+    expiries = []
+    is_call = []
+    flat: list[float | None] = []
+    for side, call in (("callExpDateMap", True), ("putExpDateMap", False)):
+        for expiry_key, strikes in (data.get(side) or {}).items():
+            expiry = expiry_key.partition(":")[0]
+            for contracts in strikes.values():
+                for contract in contracts:
+                    symbols.append(contract.get("symbol", ""))
+                    expiries.append(expiry)
+                    is_call.append(call)
+                    flat.extend([contract.get(key, _NAN) for key in SCHWAB_OPTION_KEYS])
+
+    values = np.array(flat, dtype=np.float64).reshape(len(symbols), len(OPTION_FIELDS)).T
+    values[values == _OPTION_SENTINEL] = np.nan
+    underlying_price = data.get("underlyingPrice")
+    return OptionChain(
+        underlying=data.get("symbol", ""),
+        timestamp=timestamp or datetime.now(timezone.utc),
+        underlying_price=_NAN if underlying_price is None else float(underlying_price),
+        symbols=np.array(symbols, dtype=np.str_),
+        expiries=np.array(expiries, dtype="datetime64[D]"),
+        is_call=np.array(is_call, dtype=np.bool_),
+        values=values,
+    )
@@ -5,14 +5,38 @@ market data endpoints, including price history, quotes, and market hours
 information.
 """
 
+import threading
 import time
-from datetime import datetime
+from collections.abc import Iterable
+from datetime import date, datetime, timezone
 from typing import Any
 
 from infrastructure.logging.logger import get_logger
+from system.algo_trader.domain.models import MarketHours, OptionChain, Quote, QuoteBatch
+from system.algo_trader.domain.states import MarketStatus
+from system.algo_trader.infra.redis.rate_limiter import SharedRateLimiter
+from system.algo_trader.infra.schwab.bulk_history import (
+    BulkDownloadResult,
+    BulkPriceHistoryDownloader,
+    DownloadCheckpoint,
+    PriceHistorySink,
+)
+from system.algo_trader.infra.schwab.decoding import (
+    decode_option_chain,
+    decode_quote,
+    decode_quote_batch,
+)
+from system.algo_trader.infra.schwab.rate_limit import TokenBucket
 from system.algo_trader.infra.schwab.schwab_client import SchwabClient
 from system.algo_trader.infra.schwab.timescale_enum import FrequencyType, PeriodType
 
+# Schwab sessionHours keys and the status each session maps to
+SESSION_STATUSES = {
+    "preMarket": MarketStatus.PRE_MARKET,
+    "regularMarket": MarketStatus.OPEN,
+    "postMarket": MarketStatus.POST_MARKET,
+}
+
 
 class MarketHandler(SchwabClient):
     """Schwab Market Data API Handler.
@@ -21,10 +45,20 @@ class MarketHandler(SchwabClient):
     and market hours. Inherits from SchwabClient for authentication and token management.
     """
 
-    def __init__(self):
-        """Initialize MarketHandler with market data API endpoint."""
-        super().__init__()
+    def __init__(
+        self, rate_limiter: SharedRateLimiter | None = None, option_chain_ttl_s: float = 5.0
+    ):
+        """Initialize MarketHandler with market data API endpoint.
+
+        Args:
+            rate_limiter: Optional rate limiter shared with other handlers.
+            option_chain_ttl_s: Seconds a fetched option chain is reused.
+        """
+        super().__init__(rate_limiter=rate_limiter)
         self.market_url = f"{self.base_url}/marketdata/v1"
+        self.option_chain_ttl_s = option_chain_ttl_s
+        self._option_chains: dict[tuple, tuple[float, OptionChain]] = {}
+        self._option_chains_lock = threading.Lock()
         self.logger = get_logger(self.__class__.__name__)
         self.logger.info("MarketHandler initialized successfully")
 
@@ -112,6 +146,83 @@ class MarketHandler(SchwabClient):
             self.logger.error("Failed to get quotes")
             return {}
 
+    def get_quote_snapshot(
+        self, tickers: list[str], columnar: bool = False
+    ) -> Quote | QuoteBatch | None:
+        """Get real-time quotes decoded straight into a domain model.
+
+        Unlike get_quotes, the raw response body is decoded in one pass
+        (with orjson when installed), skipping the intermediate dicts.
+
+        Args:
+            tickers: List of stock symbols to get quotes for
+            columnar: Return a QuoteBatch instead of a dict-per-field Quote.
+
+        Returns:
+            Quote or QuoteBatch, or None if the request failed
+        """
+        self.logger.debug(f"Getting quote snapshot for {len(tickers)} tickers")
+        url = f"{self.market_url}/quotes"
+        try:
+            response = self.make_authenticated_request(
+                "GET", url, params={"symbols": ",".join(tickers)}
+            )
+        except Exception as e:
+            self.logger.error(f"Error making request: {e}")
+            return None
+        if response.status_code != 200:
+            self.logger.error(
+                f"Request failed with status {response.status_code}: {response.text}"
+            )
+            return None
+        if columnar:
+            return decode_quote_batch(response.content)
+        return decode_quote(response.content)
+
+    def _price_history_params(  # noqa: PLR0913
+        self,
+        ticker: str,
+        period_type: PeriodType,
+        period: int,
+        frequency_type: FrequencyType,
+        frequency: int,
+        extended_hours: bool,
+        start_date: datetime | None = None,
+        end_date: datetime | None = None,
+    ) -> dict[str, Any]:
+        """Validate the timescale and build price history query parameters.
+
+        Args:
+            ticker: Stock symbol to get history for
+            period_type: Type of period (day, month, year, ytd)
+            period: Number of periods
+            frequency_type: Frequency of data points (minute, daily, weekly, monthly)
+            frequency: Frequency value (1, 5, 10, 15, 30 for minutes)
+            extended_hours: Whether to include extended hours data
+            start_date: Optional first bar time; replaces the period window
+            end_date: Optional last bar time (Schwab defaults to the previous close)
+
+        Returns:
+            Query parameters for the pricehistory endpoint
+
+        Raises:
+            ValueError: If the period/frequency combination is invalid.
+        """
+        period_type.validate_combination(period, frequency_type, frequency)
+        params: dict[str, Any] = {
+            "symbol": ticker,
+            "periodType": period_type.value,
+            "period": period,
+            "frequencyType": frequency_type.value,
+            "frequency": frequency,
+            "needExtendedHoursData": extended_hours,
+        }
+        if start_date is not None:
+            params["startDate"] = int(start_date.timestamp() * 1000)
+        if end_date is not None:
+            params["endDate"] = int(end_date.timestamp() * 1000)
+        return params
+
     def get_price_history(
         self,
         ticker: str,
@@ -122,6 +233,8 @@ class MarketHandler(SchwabClient):
         extended_hours: bool = False,
         max_retries: int = 2,
         retry_delay: float = 1.0,
+        start_date: datetime | None = None,
+        end_date: datetime | None = None,
     ) -> dict[str, Any]:
         """Get historical price data for a ticker.
 
@@ -134,22 +247,25 @@ class MarketHandler(SchwabClient):
             extended_hours: Whether to include extended hours data
             max_retries: Maximum number of retries for 500/502 errors (default: 2)
             retry_delay: Delay in seconds between retries (default: 1.0)
+            start_date: Optional first bar time; replaces the period window, so
+                an incremental fetch returns only the newest bars
+            end_date: Optional last bar time (Schwab defaults to the previous close)
 
         Returns:
             Dict containing historical price data, or empty dict if failed after retries
         """
         self.logger.info(f"Getting price history for {ticker}")
-        period_type.validate_combination(period, frequency_type, frequency)
-
+        params = self._price_history_params(
+            ticker,
+            period_type,
+            period,
+            frequency_type,
+            frequency,
+            extended_hours,
+            start_date,
+            end_date,
+        )
         url = f"{self.market_url}/pricehistory"
-        params = {
-            "symbol": ticker,
-            "periodType": period_type.value,
-            "period": period,
-            "frequencyType": frequency_type.value,
-            "frequency": frequency,
-            "needExtendedHoursData": extended_hours,
-        }
 
         last_status_code = None
         for attempt in range(max_retries + 1):
@@ -195,18 +311,208 @@ class MarketHandler(SchwabClient):
             )
         return error_response
 
-    def get_option_chains(self, ticker: str) -> dict[str, Any]:
-        """Get option chain data for a ticker.
+    def price_history_downloader(  # noqa: PLR0913
+        self,
+        sink: PriceHistorySink,
+        period_type: PeriodType = PeriodType.YEAR,
+        period: int = 1,
+        frequency_type: FrequencyType = FrequencyType.DAILY,
+        frequency: int = 1,
+        extended_hours: bool = False,
+        checkpoint: DownloadCheckpoint | None = None,
+        max_workers: int = 8,
+        requests_per_second: float = 2.0,
+        burst: int = 10,
+        max_retries: int = 3,
+        retry_delay: float = 1.0,
+        rate_budget: TokenBucket | None = None,
+    ) -> BulkPriceHistoryDownloader:
+        """Build a bulk price-history downloader that requests through this handler.
+
+        Use it instead of download_price_histories() to stop a running
+        download from another thread with stop(). The caller owns the sink and
+        checkpoint and closes them when done.
 
         Args:
-            ticker: Stock symbol to get option chain for
+            sink: Destination for each ticker's history.
+            period_type: Type of period (day, month, year, ytd)
+            period: Number of periods
+            frequency_type: Frequency of data points (minute, daily, weekly, monthly)
+            frequency: Frequency value (1, 5, 10, 15, 30 for minutes)
+            extended_hours: Whether to include extended hours data
+            checkpoint: Optional progress record for resuming.
+            max_workers: Concurrent requests in flight.
+            requests_per_second: Sustained request budget (ignored with rate_budget).
+            burst: Requests allowed back to back (ignored with rate_budget).
+            max_retries: Maximum retries per ticker for transient errors.
+            retry_delay: Base backoff in seconds between retries.
+            rate_budget: Optional TokenBucket shared with other handlers (e.g.,
+                OrderHandler.rate_budget) so their combined rate stays in budget.
 
         Returns:
-            Dict containing option chain data
+            BulkPriceHistoryDownloader ready to download().
         """
-        # TODO: Implement option chain functionality
-        self.logger.warning(f"Option chain functionality not yet implemented for {ticker}")
-        return {}
+        url = f"{self.market_url}/pricehistory"
+        base_params = self._price_history_params(
+            "", period_type, period, frequency_type, frequency, extended_hours
+        )
+
+        def fetch(ticker: str) -> tuple[dict[str, Any] | None, int | None]:
+            return self._send_request(url, {**base_params, "symbol": ticker})
+
+        return BulkPriceHistoryDownloader(
+            fetch,
+            sink,
+            rate_budget or TokenBucket(requests_per_second, burst),
+            max_workers=max_workers,
+            max_retries=max_retries,
+            retry_delay_s=retry_delay,
+            checkpoint=checkpoint,
+        )
+
+    def download_price_histories(  # noqa: PLR0913
+        self,
+        tickers: Iterable[str],
+        sink: PriceHistorySink,
+        period_type: PeriodType = PeriodType.YEAR,
+        period: int = 1,
+        frequency_type: FrequencyType = FrequencyType.DAILY,
+        frequency: int = 1,
+        extended_hours: bool = False,
+        checkpoint_path: str | None = None,
+        max_workers: int = 8,
+        requests_per_second: float = 2.0,
+        burst: int = 10,
+        max_retries: int = 3,
+        retry_delay: float = 1.0,
+        rate_budget: TokenBucket | None = None,
+    ) -> BulkDownloadResult:
+        """Download price history for many tickers concurrently.
+
+        Requests share one rate budget and the client's pooled session.
+        Transient errors are retried with exponential backoff without blocking
+        other tickers, and each completed ticker is written to the sink as it
+        arrives. The sink is left open for the caller to close; to stop a
+        download midway, use price_history_downloader() instead.
+
+        Args:
+            tickers: Stock symbols to download.
+            sink: Destination for each ticker's history.
+            period_type: Type of period (day, month, year, ytd)
+            period: Number of periods
+            frequency_type: Frequency of data points (minute, daily, weekly, monthly)
+            frequency: Frequency value (1, 5, 10, 15, 30 for minutes)
+            extended_hours: Whether to include extended hours data
+            checkpoint_path: Optional progress file; tickers recorded there are
+                skipped, so rerunning after an interruption resumes the backfill.
+            max_workers: Concurrent requests in flight.
+            requests_per_second: Sustained request budget (ignored with rate_budget).
+            burst: Requests allowed back to back (ignored with rate_budget).
+            max_retries: Maximum retries per ticker for transient errors.
+            retry_delay: Base backoff in seconds between retries.
+            rate_budget: Optional TokenBucket shared with other handlers.
+
+        Returns:
+            BulkDownloadResult summarizing completed, empty and failed tickers.
+        """
+        checkpoint = DownloadCheckpoint(checkpoint_path) if checkpoint_path else None
+        downloader = self.price_history_downloader(
+            sink,
+            period_type,
+            period,
+            frequency_type,
+            frequency,
+            extended_hours,
+            checkpoint=checkpoint,
+            max_workers=max_workers,
+            requests_per_second=requests_per_second,
+            burst=burst,
+            max_retries=max_retries,
+            retry_delay=retry_delay,
+            rate_budget=rate_budget,
+        )
+        try:
+            return downloader.download(tickers)
+        finally:
+            if checkpoint is not None:
+                checkpoint.close()
+
+    def _fetch_option_chain(self, params: dict[str, Any]) -> OptionChain | None:
+        """Request an option chain and decode the response body."""
+        url = f"{self.market_url}/chains"
+        try:
+            response = self.make_authenticated_request("GET", url, params=params)
+        except Exception as e:
+            self.logger.error(f"Error making request: {e}")
+            return None
+        if response.status_code != 200:
+            self.logger.error(
+                f"Request failed with status {response.status_code}: {response.text}"
+            )
+            return None
+        return decode_option_chain(response.content)
+
+    def get_option_chains(  # noqa: PLR0913
+        self,
+        ticker: str,
+        contract_type: str = "ALL",
+        from_date: date | None = None,
+        to_date: date | None = None,
+        strike_count: int | None = None,
+        strike_min: float | None = None,
+        strike_max: float | None = None,
+    ) -> OptionChain | None:
+        """Get an option chain for a ticker as a columnar OptionChain.
+
+        Contract type, expiry range and strike count are applied by Schwab;
+        the strike range is applied after decoding, since the API has no
+        strike range parameter. Chains are cached per server-side request for
+        option_chain_ttl_s seconds, so calls differing only in strike range
+        share one request. An unfiltered chain is returned as a read-only view
+        of the cached arrays; a strike-filtered chain is a copy.
+
+        Args:
+            ticker: Underlying symbol
+            contract_type: "CALL", "PUT" or "ALL"
+            from_date: Earliest expiry date
+            to_date: Latest expiry date
+            strike_count: Number of strikes above and below the underlying price
+            strike_min: Lowest strike to keep
+            strike_max: Highest strike to keep
+
+        Returns:
+            OptionChain, or None if the request failed
+        """
+        params: dict[str, Any] = {"symbol": ticker, "contractType": contract_type}
+        if from_date is not None:
+            params["fromDate"] = from_date.strftime("%Y-%m-%d")
+        if to_date is not None:
+            params["toDate"] = to_date.strftime("%Y-%m-%d")
+        if strike_count is not None:
+            params["strikeCount"] = strike_count
+        key = tuple(sorted(params.items()))
+
+        now = time.monotonic()
+        with self._option_chains_lock:
+            cached = self._option_chains.get(key)
+        if cached is not None and now - cached[0] < self.option_chain_ttl_s:
+            chain = cached[1]
+        else:
+            self.logger.debug(f"Getting {contract_type} option chain for: {ticker}")
+            chain = self._fetch_option_chain(params)
+            if chain is None:
+                return None
+            with self._option_chains_lock:
+                self._option_chains = {
+                    k: v
+                    for k, v in self._option_chains.items()
+                    if now - v[0] < self.option_chain_ttl_s
+                }
+                self._option_chains[key] = (now, chain)
+
+        if strike_min is None and strike_max is None:
+            return chain.read_only()
+        return chain.filter(strike_min=strike_min, strike_max=strike_max)
 
     def get_market_hours(self, date: datetime, markets: list[str] | None = None) -> dict[str, Any]:
         """Get market hours for specified date and markets.
@@ -254,3 +560,41 @@ class MarketHandler(SchwabClient):
         else:
             self.logger.warning("No equity market data in response")
             return {"date": date.strftime("%Y-%m-%d")}
+
+    def get_session_hours(self, day: date, market: str = "equity") -> list[MarketHours] | None:
+        """Get every session window of a market for one day.
+
+        Args:
+            day: Trading date.
+            market: Market type (e.g., "equity").
+
+        Returns:
+            Pre-market, regular and post-market windows in start order, an
+            empty list if the market is closed, or None if the request failed.
+        """
+        url = f"{self.market_url}/markets"
+        params = {"markets": market, "date": day.strftime("%Y-%m-%d")}
+
+        response, _ = self._send_request(url, params)
+        if response is None:
+            self.logger.error(f"Failed to get {market} session hours for {day}")
+            return None
+
+        products = response.get(market, {})
+        info = products.get("EQ") or next(iter(products.values()), {})
+        if not info.get("isOpen", False):
+            return []
+
+        now = datetime.now(timezone.utc)
+        hours = []
+        for key, status in SESSION_STATUSES.items():
+            for session in info.get("sessionHours", {}).get(key, ()):
+                hours.append(
+                    MarketHours(
+                        timestamp=now,
+                        status=status,
+                        start=datetime.fromisoformat(session["start"]),
+                        end=datetime.fromisoformat(session["end"]),
+                    )
+                )
+        return sorted(hours, key=lambda window: window.start)
@@ -0,0 +1,465 @@
+"""Schwab order execution API handler.
+
+This module provides the OrderHandler class, the Schwab implementation of
+OrderPort. Orders in a batch are independent, so they are placed
+concurrently from a small thread pool over the client's keep-alive session,
+with every request drawn from a shared TokenBucket so the batch stays within
+the account's order-request budget. Schwab order JSON is mapped to and from the
+domain order models, and broker order IDs are kept against domain UUIDs.
+"""
+
+import threading
+from concurrent.futures import ThreadPoolExecutor
+from datetime import datetime, timedelta, timezone
+from typing import Any
+from uuid import NAMESPACE_URL, UUID, uuid5
+
+import requests
+
+from infrastructure.logging.logger import get_logger
+from system.algo_trader.domain.models import (
+    LimitOrder,
+    MarketOrder,
+    OrderEvent,
+    Orders,
+    StopLimitOrder,
+    StopOrder,
+)
+from system.algo_trader.domain.ports.order_port import OrderPort
+from system.algo_trader.domain.states import (
+    OrderDuration,
+    OrderInstruction,
+    OrderStatus,
+    OrderTaxLotMethod,
+    OrderType,
+)
+from system.algo_trader.infra.redis.rate_limiter import SharedRateLimiter
+from system.algo_trader.infra.schwab.rate_limit import TokenBucket
+from system.algo_trader.infra.schwab.schwab_client import SchwabClient
+
+Order = LimitOrder | MarketOrder | StopOrder | StopLimitOrder
+
+_INSTRUCTIONS = {
+    OrderInstruction.BUY_TO_OPEN: "BUY",
+    OrderInstruction.SELL_TO_CLOSE: "SELL",
+    OrderInstruction.SELL_TO_OPEN: "SELL_SHORT",
+    OrderInstruction.BUY_TO_CLOSE: "BUY_TO_COVER",
+}
+_DURATIONS = {
+    OrderDuration.DAY: "DAY",
+    OrderDuration.GTC: "GOOD_TILL_CANCEL",
+    OrderDuration.IOC: "IMMEDIATE_OR_CANCEL",
+    OrderDuration.FOK: "FILL_OR_KILL",
+}
+_TAX_LOT_METHODS = {
+    OrderTaxLotMethod.FIFO: "FIFO",
+    OrderTaxLotMethod.LIFO: "LIFO",
+    OrderTaxLotMethod.HIFO: "HIGH_COST",
+    OrderTaxLotMethod.AVG_COST: "AVERAGE_COST",
+    OrderTaxLotMethod.SPECIFIC_LOT: "SPECIFIC_LOT",
+}
+_FROM_INSTRUCTIONS = {v: k for k, v in _INSTRUCTIONS.items()}
+_FROM_DURATIONS = {v: k for k, v in _DURATIONS.items()}
+_FROM_TAX_LOT_METHODS = {v: k for k, v in _TAX_LOT_METHODS.items()}
+
+# Schwab statuses that end an order; every other status is still working
+_TERMINAL_STATUSES = {
+    "FILLED": OrderStatus.FILLED,
+    "CANCELED": OrderStatus.CANCELLED,
+    "REPLACED": OrderStatus.CANCELLED,
+    "REJECTED": OrderStatus.REJECTED,
+    "EXPIRED": OrderStatus.EXPIRED,
+}
+
+_TIME_FORMAT = "%Y-%m-%dT%H:%M:%S.000Z"
+
+
+def _format_price(price: float) -> str:
+    """Format a price as Schwab expects (decimal string)."""
+    return f"{price:.4f}".rstrip("0").rstrip(".")
+
+
+def to_schwab_order(order: Order) -> dict[str, Any]:
+    """Build the Schwab order payload for a domain order.
+
+    Args:
+        order: Domain order to place.
+
+    Returns:
+        Schwab single-leg equity order JSON.
+
+    Raises:
+        ValueError: If the order type is not supported.
+    """
+    payload: dict[str, Any] = {
+        "session": "NORMAL",
+        "duration": _DURATIONS[order.order_duration],
+        "orderStrategyType": "SINGLE",
+        "taxLotMethod": _TAX_LOT_METHODS[order.order_tax_lot_method],
+        "orderLegCollection": [
+            {
+                "instruction": _INSTRUCTIONS[order.order_instruction],
+                "quantity": order.quantity,
+                "instrument": {"symbol": order.symbol, "assetType": "EQUITY"},
+            }
+        ],
+    }
+    if isinstance(order, MarketOrder):
+        payload["orderType"] = "MARKET"
+    elif isinstance(order, LimitOrder):
+        payload["orderType"] = "LIMIT"
+        payload["price"] = _format_price(order.price)
+    elif isinstance(order, StopOrder):
+        payload["orderType"] = "STOP"
+        payload["stopPrice"] = _format_price(order.price)
+    elif isinstance(order, StopLimitOrder):
+        payload["orderType"] = "STOP_LIMIT"
+        payload["price"] = _format_price(order.limit_price)
+        payload["stopPrice"] = _format_price(order.stop_price)
+    else:
+        raise ValueError(f"Unsupported order type: {type(order).__name__}")
+    return payload
+
+
+def _parse_time(value: str | None) -> datetime:
+    """Parse a Schwab timestamp such as 2024-01-02T15:30:00+0000."""
+    if value:
+        try:
+            return datetime.strptime(value, "%Y-%m-%dT%H:%M:%S%z")
+        except ValueError:
+            pass
+    return datetime.now(timezone.utc)
+
+
+def from_schwab_order(data: dict[str, Any], order_id: UUID) -> Order:
+    """Build a domain order from Schwab order JSON.
+
+    Args:
+        data: Single-leg Schwab order.
+        order_id: Domain UUID to assign.
+
+    Returns:
+        Domain order matching the Schwab orderType.
+
+    Raises:
+        ValueError: If the order type or instruction is not supported.
+        KeyError: If required fields are missing.
+    """
+    leg = data["orderLegCollection"][0]
+    order_type = data["orderType"]
+    instruction = _FROM_INSTRUCTIONS.get(leg["instruction"])
+    if instruction is None:
+        raise ValueError(f"Unsupported instruction: {leg['instruction']}")
+    common = {
+        "id": order_id,
+        "timestamp": _parse_time(data.get("enteredTime")),
+        "symbol": leg["instrument"]["symbol"],
+        "quantity": int(data.get("quantity", leg["quantity"])),
+        "order_instruction": instruction,
+        "order_duration": _FROM_DURATIONS.get(data.get("duration"), OrderDuration.DAY),
+        "order_tax_lot_method": _FROM_TAX_LOT_METHODS.get(
+            data.get("taxLotMethod"), OrderTaxLotMethod.FIFO
+        ),
+    }
+    if order_type == "MARKET":
+        return MarketOrder(order_type=OrderType.MARKET, **common)
+    if order_type == "LIMIT":
+        return LimitOrder(price=float(data["price"]), order_type=OrderType.LIMIT, **common)
+    if order_type == "STOP":
+        return StopOrder(price=float(data["stopPrice"]), order_type=OrderType.STOP, **common)
+    if order_type == "STOP_LIMIT":
+        return StopLimitOrder(
+            stop_price=float(data["stopPrice"]),
+            limit_price=float(data["price"]),
+            order_type=OrderType.STOP_LIMIT,
+            **common,
+        )
+    raise ValueError(f"Unsupported order type: {order_type}")
+
+
+def schwab_order_status(data: dict[str, Any]) -> OrderStatus:
+    """Map a Schwab order status onto the domain lifecycle.
+
+    Queued, pending and awaiting statuses count as WORKING once the broker
+    holds the order; working orders with fills are PARTIALLY_FILLED.
+
+    Args:
+        data: Schwab order JSON.
+
+    Returns:
+        Domain OrderStatus.
+    """
+    status = _TERMINAL_STATUSES.get(data.get("status", ""))
+    if status is not None:
+        return status
+    if data.get("filledQuantity", 0) > 0:
+        return OrderStatus.PARTIALLY_FILLED
+    return OrderStatus.WORKING
+
+
+def _last_fill_price(data: dict[str, Any]) -> float | None:
+    """Return the price of the most recent execution leg, if any."""
+    for activity in reversed(data.get("orderActivityCollection", [])):
+        legs = activity.get("executionLegs", [])
+        if legs:
+            return float(legs[-1]["price"])
+    return None
+
+
+class OrderHandler(SchwabClient, OrderPort):
+    """Schwab Order API Handler.
+
+    Places, cancels and lists orders for one account. Submissions in a batch
+    run concurrently on the client's shared session, whose connection pool is
+    sized to the worker count, so TLS connections are reused across orders
+    and batches. Every request first takes a token from the rate budget.
+
+    Args:
+        account_hash: Encrypted account number used in trader API paths.
+        max_workers: Concurrent requests per batch.
+        requests_per_second: Sustained request budget.
+        burst: Requests allowed back to back before the budget applies.
+        lookback_days: Order history window for get_all_orders.
+        base_url: Optional API root override (e.g., a local test server).
+        timeout_s: Per-request timeout.
+        rate_limiter: Optional rate limiter shared with other handlers.
+        rate_budget: Optional TokenBucket shared with other handlers (e.g., a
+            bulk price-history download); replaces requests_per_second and burst.
+    """
+
+    def __init__(  # noqa: PLR0913
+        self,
+        account_hash: str,
+        max_workers: int = 8,
+        requests_per_second: float = 2.0,
+        burst: int = 10,
+        lookback_days: int = 1,
+        base_url: str | None = None,
+        timeout_s: float = 10.0,
+        rate_limiter: SharedRateLimiter | None = None,
+        rate_budget: TokenBucket | None = None,
+    ):
+        """Initialize OrderHandler with the trader API endpoint.
+
+        Args:
+            account_hash: Encrypted account number used in trader API paths.
+            max_workers: Concurrent requests per batch.
+            requests_per_second: Sustained request budget.
+            burst: Requests allowed back to back before the budget applies.
+            lookback_days: Order history window for get_all_orders.
+            base_url: Optional API root override (e.g., a local test server).
+            timeout_s: Per-request timeout.
+            rate_limiter: Optional rate limiter shared with other handlers.
+            rate_budget: Optional TokenBucket shared with other handlers (e.g., a
+                bulk price-history download); replaces requests_per_second and burst.
+        """
+        super().__init__(pool_size=max_workers, rate_limiter=rate_limiter)
+        if base_url is not None:
+            self.base_url = base_url
+        self.orders_url = f"{self.base_url}/trader/v1/accounts/{account_hash}/orders"
+        self.logger = get_logger(self.__class__.__name__)
+        self.lookback_days = lookback_days
+        self.timeout_s = timeout_s
+        self.rate_budget = rate_budget or TokenBucket(requests_per_second, burst)
+        self._executor = ThreadPoolExecutor(
+            max_workers=max_workers, thread_name_prefix="schwab-orders"
+        )
+        self._ids_lock = threading.Lock()
+        self._broker_ids: dict[UUID, str] = {}
+        self._domain_ids: dict[str, UUID] = {}
+        self.logger.info("OrderHandler initialized successfully")
+
+    def close(self) -> None:
+        """Shut down the worker pool and close pooled connections."""
+        self._executor.shutdown(wait=True)
+        super().close()
+
+    def _request(self, method: str, url: str, **kwargs) -> requests.Response:
+        """Send an authenticated request within the rate budget."""
+        self.rate_budget.acquire()
+        return self.make_authenticated_request(method, url, timeout=self.timeout_s, **kwargs)
+
+    def _remember(self, order_id: UUID, broker_id: str) -> None:
+        """Record the broker ID assigned to a domain order."""
+        with self._ids_lock:
+            self._broker_ids[order_id] = broker_id
+            self._domain_ids[broker_id] = order_id
+
+    def _domain_id(self, broker_id: str) -> UUID:
+        """Return the domain UUID for a broker order ID.
+
+        Orders placed elsewhere get a stable UUID derived from the broker ID.
+        """
+        with self._ids_lock:
+            order_id = self._domain_ids.get(broker_id)
+        if order_id is None:
+            order_id = uuid5(NAMESPACE_URL, f"schwab-order:{broker_id}")
+            self._remember(order_id, broker_id)
+        return order_id
+
+    def broker_order_id(self, order_id: UUID) -> str | None:
+        """Return the Schwab order ID for a domain order, if known.
+
+        Args:
+            order_id: Domain order UUID.
+
+        Returns:
+            Broker order ID, or None if the order was not placed here.
+        """
+        with self._ids_lock:
+            return self._broker_ids.get(order_id)
+
+    def _place(self, order: Order) -> bool:
+        """Place one order; return True if the broker accepted it."""
+        try:
+            payload = to_schwab_order(order)
+        except (KeyError, ValueError) as e:
+            self.logger.error(f"Cannot place order {order.id}: {e}")
+            return False
+        try:
+            response = self._request("POST", self.orders_url, json=payload)
+        except requests.RequestException as e:
+            self.logger.error(f"Order {order.id} request failed: {e}")
+            return False
+
+        if response.status_code not in (200, 201):
+            self.logger.error(
+                f"Order {order.id} rejected: {response.status_code} - {response.text}"
+            )
+            return False
+        location = response.headers.get("Location", "")
+        broker_id = location.rstrip("/").rsplit("/", 1)[-1]
+        if broker_id:
+            self._remember(order.id, broker_id)
+        else:
+            self.logger.warning(f"Order {order.id} accepted without a Location header")
+        return True
+
+    def send_orders(self, orders: Orders) -> Orders:
+        """Place orders concurrently.
+
+        Args:
+            orders: Orders to place.
+
+        Returns:
+            Orders the broker accepted, in submission order.
+        """
+        if not orders.orders:
+            return Orders(timestamp=orders.timestamp, orders=[])
+        self.logger.info(f"Placing {len(orders.orders)} orders")
+        results = list(self._executor.map(self._place, orders.orders))
+        accepted = [o for o, ok in zip(orders.orders, results, strict=True) if ok]
+        return Orders(timestamp=orders.timestamp, orders=accepted)
+
+    def _fetch_orders(self) -> list[dict[str, Any]]:
+        """Fetch Schwab order JSON for the lookback window."""
+        now = datetime.now(timezone.utc)
+        params = {
+            "fromEnteredTime": (now - timedelta(days=self.lookback_days)).strftime(_TIME_FORMAT),
+            "toEnteredTime": now.strftime(_TIME_FORMAT),
+        }
+        try:
+            response = self._request("GET", self.orders_url, params=params)
+        except requests.RequestException as e:
+            self.logger.error(f"Failed to get orders: {e}")
+            return []
+        if response.status_code != 200:
+            self.logger.error(f"Failed to get orders: {response.status_code} - {response.text}")
+            return []
+        return response.json()
+
+    def _to_orders(self, raw: list[dict[str, Any]]) -> Orders:
+        """Map Schwab order JSON to domain Orders, skipping unsupported orders."""
+        orders = []
+        for data in raw:
+            try:
+                orders.append(from_schwab_order(data, self._domain_id(str(data["orderId"]))))
+            except (KeyError, IndexError, ValueError) as e:
+                self.logger.debug(f"Skipping order {data.get('orderId')}: {e}")
+        return Orders(timestamp=datetime.now(timezone.utc), orders=orders)
+
+    def get_all_orders(self) -> Orders:
+        """Retrieve all orders entered within the lookback window.
+
+        Returns:
+            Orders collection containing all supported orders.
+        """
+        return self._to_orders(self._fetch_orders())
+
+    def get_open_orders(self) -> Orders:
+        """Retrieve orders that are still working.
+
+        Returns:
+            Orders collection containing open orders.
+        """
+        raw = self._fetch_orders()
+        return self._to_orders([d for d in raw if d.get("status") not in _TERMINAL_STATUSES])
+
+    def get_order_events(self) -> list[OrderEvent]:
+        """Report the broker's view of every order as lifecycle events.
+
+        The events can be applied to an OrderBook to follow fills and
+        cancels of submitted orders.
+
+        Returns:
+            One OrderEvent per order in the lookback window.
+        """
+        now = datetime.now(timezone.utc)
+        return [
+            OrderEvent(
+                timestamp=now,
+                order_id=self._domain_id(str(data["orderId"])),
+                status=schwab_order_status(data),
+                filled_quantity=int(data.get("filledQuantity", 0)),
+                fill_price=_last_fill_price(data),
+            )
+            for data in self._fetch_orders()
+            if "orderId" in data
+        ]
+
+    def _cancel(self, broker_id: str) -> bool:
+        """Cancel one order by broker ID."""
+        try:
+            response = self._request("DELETE", f"{self.orders_url}/{broker_id}")
+        except requests.RequestException as e:
+            self.logger.error(f"Cancel of order {broker_id} failed: {e}")
+            return False
+        if response.status_code not in (200, 204):
+            self.logger.error(
+                f"Failed to cancel order {broker_id}: {response.status_code} - {response.text}"
+            )
+            return False
+        return True
+
+    def cancel_order(self, order_id: str) -> bool:
+        """Cancel a specific order.
+
+        Args:
+            order_id: Domain order UUID, or a Schwab order ID for orders
+                placed elsewhere.
+
+        Returns:
+            True if cancellation was successful, False otherwise.
+        """
+        try:
+            broker_id = self.broker_order_id(UUID(order_id))
+        except ValueError:
+            broker_id = order_id
+        if broker_id is None:
+            self.logger.error(f"Unknown order {order_id}")
+            return False
+        return self._cancel(broker_id)
+
+    def cancel_all_orders(self) -> bool:
+        """Cancel all open orders concurrently.
+
+        Returns:
+            True if every open order was cancelled, False otherwise.
+        """
+        broker_ids = [
+            str(data["orderId"])
+            for data in self._fetch_orders()
+            if "orderId" in data and data.get("status") not in _TERMINAL_STATUSES
+        ]
+        self.logger.info(f"Cancelling {len(broker_ids)} open orders")
+        return all(list(self._executor.map(self._cancel, broker_ids)))
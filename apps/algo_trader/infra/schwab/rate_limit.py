@@ -0,0 +1,99 @@
+"""Client-side rate budget for Schwab API requests.
+
+This module provides TokenBucket, a thread-safe token bucket shared by the
+worker threads of a handler so that concurrent requests stay within the
+per-account request budget Schwab enforces.
+"""
+
+import threading
+import time
+from collections.abc import Callable
+
+
+class TokenBucket:
+    """Thread-safe token bucket with reservation semantics.
+
+    Tokens refill continuously at ``rate`` per second up to ``capacity``.
+    acquire() reserves its tokens immediately, letting the balance go
+    negative, and then sleeps outside the lock until the reservation is
+    covered. Concurrent callers are therefore served in arrival order
+    without polling, and the long-run request rate never exceeds ``rate``.
+
+    Args:
+        rate: Tokens added per second.
+        capacity: Maximum burst size in tokens.
+        clock: Monotonic clock in seconds.
+        sleep: Sleep function used while waiting for tokens.
+    """
+
+    def __init__(
+        self,
+        rate: float,
+        capacity: float,
+        clock: Callable[[], float] = time.monotonic,
+        sleep: Callable[[float], None] = time.sleep,
+    ):
+        """Initialize a full bucket.
+
+        Args:
+            rate: Tokens added per second.
+            capacity: Maximum burst size in tokens.
+            clock: Monotonic clock in seconds.
+            sleep: Sleep function used while waiting for tokens.
+
+        Raises:
+            ValueError: If rate or capacity is not positive.
+        """
+        if rate <= 0 or capacity <= 0:
+            raise ValueError("rate and capacity must be positive")
+        self.rate = rate
+        self.capacity = capacity
+        self._clock = clock
+        self._sleep = sleep
+        self._lock = threading.Lock()
+        self._tokens = capacity
+        self._updated = clock()
+        self.waited_s = 0.0
+
+    def _refill(self) -> None:
+        """Add tokens for the time elapsed since the last update."""
+        now = self._clock()
+        self._tokens = min(self.capacity, self._tokens + (now - self._updated) * self.rate)
+        self._updated = now
+
+    def reserve(self, tokens: float = 1.0) -> float:
+        """Reserve tokens without waiting.
+
+        Args:
+            tokens: Number of tokens to take.
+
+        Returns:
+            Seconds the caller must wait before using the reservation.
+        """
+        with self._lock:
+            self._refill()
+            self._tokens -= tokens
+            return max(0.0, -self._tokens / self.rate)
+
+    def acquire(self, tokens: float = 1.0) -> float:
+        """Take tokens, sleeping until they are available.
+
+        Args:
+            tokens: Number of tokens to take.
+
+        Returns:
+            Seconds spent waiting.
+        """
+        wait = self.reserve(tokens)
+        if wait > 0:
+            self._sleep(wait)
+            with self._lock:
+                self.waited_s += wait
+        return wait
+
+    @property
+    def available(self) -> float:
+        """Return the current token balance (negative while reserved ahead)."""
+        with self._lock:
+            self._refill()
+            return self._tokens
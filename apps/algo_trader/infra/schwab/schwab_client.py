@@ -8,16 +8,24 @@ Token Flow:
 2. If expired, check Redis for refresh token (TTL: 90 days) → refresh access token
 3. If refresh token missing from Redis, load from env and store in Redis → refresh
 4. If refresh token expired, initiate OAuth2 flow → save to Redis, display for manual save
+
+Requests go through one pooled keep-alive requests.Session, and the access
+token is cached in process until shortly before its Redis expiry, so steady
+request loops pay neither a TCP/TLS handshake nor a Redis round trip per call.
 """
 
 import os
+import threading
+import time
 from typing import Any
 
 import requests
+from requests.adapters import HTTPAdapter
 
 from infrastructure.client import Client
 from infrastructure.logging.logger import get_logger
 from system.algo_trader.infra.redis.account import AccountBroker
+from system.algo_trader.infra.redis.rate_limiter import SharedRateLimiter, classify_request
 from system.algo_trader.infra.schwab.auth.oauth2 import OAuth2Handler
 from system.algo_trader.infra.schwab.auth.token_manager import TokenManager
 
@@ -29,10 +37,31 @@ class SchwabClient(Client):
     a base for Schwab API operations. Tokens are stored in Redis with proper
     TTL management. Refresh tokens must be persisted manually via environment
     variables as Redis is ephemeral.
+
+    Args:
+        pool_size: Keep-alive connections kept per host; size it to the number
+            of threads sharing the client.
+        token_expiry_margin_s: Seconds before the access token's expiry at
+            which the in-process copy is dropped and Redis is consulted again;
+            the token manager also starts refreshing ahead at this point.
+        rate_limiter: Optional limiter shared with other handlers and
+            processes; every request takes a token for its endpoint class.
     """
 
-    def __init__(self):
-        """Initialize Schwab client with environment configuration."""
+    def __init__(
+        self,
+        pool_size: int = 10,
+        token_expiry_margin_s: float = 300.0,
+        rate_limiter: SharedRateLimiter | None = None,
+    ):
+        """Initialize Schwab client with environment configuration.
+
+        Args:
+            pool_size: Keep-alive connections kept per host.
+            token_expiry_margin_s: Seconds before token expiry to stop using
+                the cached access token and refresh it ahead.
+            rate_limiter: Optional shared rate limiter.
+        """
         self.logger = get_logger(self.__class__.__name__)
 
         self.api_key = os.getenv("SCHWAB_API_KEY")
@@ -58,28 +87,85 @@ class SchwabClient(Client):
             self.account_broker,
             self.oauth2_handler,
             self.logger,
+            refresh_ahead_s=token_expiry_margin_s,
         )
 
+        self.session = requests.Session()
+        adapter = HTTPAdapter(pool_connections=pool_size, pool_maxsize=pool_size)
+        self.session.mount("https://", adapter)
+        self.session.mount("http://", adapter)
+
+        self.rate_limiter = rate_limiter
+        self.token_expiry_margin_s = token_expiry_margin_s
+        self._token_lock = threading.Lock()
+        self._access_token: str | None = None
+        self._token_expires_at = 0.0
+
         self.logger.info("SchwabClient initialized successfully")
 
+    def close(self) -> None:
+        """Close pooled connections."""
+        self.session.close()
+
     def get_valid_access_token(self) -> str:
         """Get a valid access token, refreshing if necessary.
 
-        This method implements the complete token lifecycle with distributed locking
-        to prevent multiple threads from refreshing simultaneously:
-        1. Check Redis for valid access token
-        2. If expired/missing, acquire lock and attempt refresh
-        3. If lock not acquired, wait for other thread to complete refresh
+        This method implements the complete token lifecycle with single-flight
+        refresh, so only one caller across threads and processes refreshes:
+        1. Check Redis for valid access token, refreshing ahead near expiry
+        2. If expired/missing, join this process's in-flight refresh or start one
+        3. If another process holds the refresh lock, wait for its pub/sub notice
         4. If refresh token missing, load from env file and store in Redis
         5. If refresh token expired, initiate OAuth2 flow
 
+        The token is then kept in process until token_expiry_margin_s before
+        its Redis TTL runs out; tokens whose expiry is unknown are not cached.
+
         Returns:
             str: Valid access token
 
         Raises:
             Exception: If unable to obtain valid token after all attempts
         """
-        return self.token_manager.get_valid_access_token()
+        with self._token_lock:
+            if self._access_token and time.monotonic() < self._token_expires_at:
+                return self._access_token
+
+        token, ttl = self.token_manager.get_valid_access_token_with_ttl()
+        with self._token_lock:
+            if ttl > self.token_expiry_margin_s:
+                self._access_token = token
+                self._token_expires_at = time.monotonic() + ttl - self.token_expiry_margin_s
+            else:
+                self._access_token = None
+        return token
+
+    def invalidate_access_token(self) -> None:
+        """Drop the in-process access token so the next request re-reads Redis."""
+        with self._token_lock:
+            self._access_token = None
+            self._token_expires_at = 0.0
+
+    def _replace_rejected_token(self, rejected: str) -> bool:
+        """Refresh an access token the API rejected with a 401.
+
+        The rejected token stays in Redis until its TTL runs out, so dropping
+        the in-process copy alone would just read it again. The refresh goes
+        through TokenManager.force_refresh, which shares the in-flight refresh
+        and the Redis refresh lock with every other caller and process.
+
+        Args:
+            rejected: Access token sent with the rejected request.
+
+        Returns:
+            True if a replacement token is available, False if the refresh failed.
+        """
+        self.invalidate_access_token()
+        try:
+            return bool(self.token_manager.force_refresh(rejected))
+        except Exception as e:
+            self.logger.error(f"Refresh after 401 failed: {e}")
+            return False
 
     def refresh_token(self) -> bool:
         """Refresh access token using stored refresh token.
@@ -120,6 +206,11 @@ class SchwabClient(Client):
     def make_authenticated_request(self, method: str, url: str, **kwargs) -> requests.Response:
         """Make an authenticated HTTP request to the Schwab API.
 
+        The request reuses a pooled connection and, with a rate limiter, waits
+        for a token of its endpoint class and reports the response status back.
+        A 401 response forces a token refresh and the request is retried once
+        with the new token; if the refresh fails the 401 response is returned.
+
         Args:
             method: HTTP method (GET, POST, etc.)
             url: Full URL for the request
@@ -128,11 +219,28 @@ class SchwabClient(Client):
         Returns:
             requests.Response object
         """
-        headers = self.get_auth_headers()
-        if "headers" in kwargs:
-            headers.update(kwargs["headers"])
-
-        kwargs["headers"] = headers
-
-        self.logger.debug(f"Making {method} request to {url}")
-        return requests.request(method, url, **kwargs)
+        extra_headers = kwargs.pop("headers", None) or {}
+
+        response = None
+        for attempt in range(2):
+            headers = self.get_auth_headers()
+            token = headers["Authorization"].removeprefix("Bearer ")
+            headers.update(extra_headers)
+            self.logger.debug(f"Making {method} request to {url}")
+            if self.rate_limiter is None:
+                response = self.session.request(method, url, headers=headers, **kwargs)
+            else:
+                endpoint = classify_request(method, url)
+                self.rate_limiter.acquire(endpoint)
+                try:
+                    response = self.session.request(method, url, headers=headers, **kwargs)
+                except requests.RequestException:
+                    self.rate_limiter.record(endpoint, None)
+                    raise
+                self.rate_limiter.record(endpoint, response.status_code)
+            if response.status_code != 401 or attempt:
+                break
+            self.logger.warning("Access token rejected, refreshing before retry")
+            if not self._replace_rejected_token(token):
+                break
+        return response
@@ -0,0 +1,328 @@
+"""Streaming quote book with event-driven, coalesced ticks.
+
+This module provides QuoteStream, which applies updates from a QuoteSource to
+an in-memory per-symbol quote book on a reader thread, and the port pair built
+on it: StreamingQuotePort answers get_quotes() from memory instead of an HTTP
+call, and StreamingEventPort turns bursts of updates into one QUOTE_EVENT tick
+per coalescing window. Controller commands can be submitted to the event port
+and always take precedence over pending ticks. When the source ends, the event
+port emits a STOP command so the engine does not trade on a frozen book.
+"""
+
+from __future__ import annotations
+
+import threading
+import time
+from collections import deque
+from collections.abc import Callable
+from datetime import datetime, timezone
+
+from infrastructure.logging.logger import get_logger
+from system.algo_trader.domain.models import QUOTE_FIELDS, Event, Quote
+from system.algo_trader.domain.ports.event_port import EventPort
+from system.algo_trader.domain.ports.quote_port import QuotePort
+from system.algo_trader.domain.states import ControllerCommand, EventType, TickReason
+from system.algo_trader.infra.streaming.sources import QuoteSource, QuoteUpdate
+
+
+class QuoteBook:
+    """Latest known quote fields per symbol.
+
+    Not thread-safe on its own; QuoteStream guards it with its condition lock.
+
+    Args:
+        symbols: Optional symbols to keep; updates for others are ignored.
+    """
+
+    def __init__(self, symbols: list[str] | None = None):
+        """Initialize an empty book.
+
+        Args:
+            symbols: Optional symbols to keep; updates for others are ignored.
+        """
+        self.symbols = frozenset(symbols) if symbols else None
+        self.quotes: dict[str, dict[str, float]] = {}
+        self.timestamp: datetime | None = None
+
+    def apply(self, updates: list[QuoteUpdate]) -> int:
+        """Merge updates into the book.
+
+        Args:
+            updates: Partial quote changes in arrival order.
+
+        Returns:
+            Number of updates applied.
+        """
+        applied = 0
+        for update in updates:
+            if self.symbols is not None and update.symbol not in self.symbols:
+                continue
+            self.quotes.setdefault(update.symbol, {}).update(update.fields)
+            if self.timestamp is None or update.timestamp > self.timestamp:
+                self.timestamp = update.timestamp
+            applied += 1
+        return applied
+
+    def snapshot(self, asset_class: str) -> Quote:
+        """Build a Quote from the current book.
+
+        Args:
+            asset_class: Asset class reported on the quote.
+
+        Returns:
+            Quote with one entry per symbol for every field seen so far.
+        """
+        maps: dict[str, dict[str, float]] = {name: {} for name in QUOTE_FIELDS}
+        for symbol, fields in self.quotes.items():
+            for name, value in fields.items():
+                maps[name][symbol] = value
+        return Quote(
+            timestamp=self.timestamp or datetime.now(timezone.utc),
+            asset_class=asset_class,
+            **maps,
+        )
+
+
+class QuoteStream:
+    """Quote book kept current by a background reader thread.
+
+    Every applied batch bumps version and, if no burst is pending, stamps
+    pending_since with the arrival time; StreamingEventPort acknowledges the
+    burst when it emits a tick. ended is set once the source is exhausted,
+    closed or fails. A stream serves one event port.
+
+    Args:
+        source: Source of quote updates.
+        symbols: Optional symbols to keep; updates for others are ignored.
+        asset_class: Asset class reported on quotes.
+    """
+
+    def __init__(
+        self,
+        source: QuoteSource,
+        symbols: list[str] | None = None,
+        asset_class: str = "EQUITY",
+    ):
+        """Initialize the stream; call start() to begin reading.
+
+        Args:
+            source: Source of quote updates.
+            symbols: Optional symbols to keep; updates for others are ignored.
+            asset_class: Asset class reported on quotes.
+        """
+        self.logger = get_logger(self.__class__.__name__)
+        self.source = source
+        self.asset_class = asset_class
+        self.book = QuoteBook(symbols)
+        self.changed = threading.Condition()
+        self.version = 0
+        self.pending_since: float | None = None
+        self.last_update: float | None = None
+        self.ended = False
+        self.messages = 0
+        self._thread: threading.Thread | None = None
+
+    def start(self) -> QuoteStream:
+        """Start the reader thread.
+
+        Returns:
+            This stream, for chaining.
+        """
+        if self._thread is None:
+            self._thread = threading.Thread(target=self._run, name="quote-stream", daemon=True)
+            self._thread.start()
+        return self
+
+    def _run(self) -> None:
+        """Reader loop: apply each batch until the source ends."""
+        try:
+            while True:
+                updates = self.source.read()
+                if updates is None:
+                    break
+                self.apply(updates)
+        except Exception as e:
+            self.logger.error(f"Quote stream failed: {e}")
+        finally:
+            with self.changed:
+                self.ended = True
+                self.changed.notify_all()
+            self.logger.info(f"Quote stream ended after {self.messages} messages")
+
+    def apply(self, updates: list[QuoteUpdate]) -> None:
+        """Apply one batch of updates and wake waiters.
+
+        Args:
+            updates: Partial quote changes in arrival order.
+        """
+        with self.changed:
+            self.messages += 1
+            applied = self.book.apply(updates)
+            if applied:
+                self.version += applied
+                self.last_update = time.monotonic()
+                if self.pending_since is None:
+                    self.pending_since = self.last_update
+                self.changed.notify_all()
+
+    def acknowledge(self) -> int:
+        """Mark the pending burst as delivered; call with changed held.
+
+        Returns:
+            The book version covered by the acknowledgement.
+        """
+        self.pending_since = None
+        return self.version
+
+    def snapshot(self) -> Quote:
+        """Return a consistent Quote of the current book."""
+        with self.changed:
+            return self.book.snapshot(self.asset_class)
+
+    def staleness_s(self) -> float:
+        """Return seconds since the last applied update, or inf if none arrived."""
+        with self.changed:
+            if self.last_update is None:
+                return float("inf")
+            return time.monotonic() - self.last_update
+
+    def close(self, timeout_s: float = 5.0) -> None:
+        """Close the source and wait for the reader thread.
+
+        Args:
+            timeout_s: Maximum time to wait for the reader thread.
+        """
+        self.source.close()
+        if self._thread is not None:
+            self._thread.join(timeout_s)
+
+
+class StreamingQuotePort(QuotePort):
+    """QuotePort answering from the live quote book.
+
+    Quotes are whatever the book last held; check ended and staleness_s()
+    before trusting them, since a dead source leaves the book frozen.
+
+    Args:
+        stream: Running quote stream.
+    """
+
+    def __init__(self, stream: QuoteStream):
+        """Initialize the port.
+
+        Args:
+            stream: Running quote stream.
+        """
+        self.stream = stream
+
+    def get_quotes(self) -> Quote:
+        """Return the latest quotes from memory.
+
+        Returns:
+            Quote built from the current book.
+        """
+        return self.stream.snapshot()
+
+    @property
+    def ended(self) -> bool:
+        """Return True once the quote source has stopped delivering updates."""
+        return self.stream.ended
+
+    def staleness_s(self) -> float:
+        """Return seconds since the book last changed, or inf if it never did."""
+        return self.stream.staleness_s()
+
+
+class StreamingEventPort(EventPort):
+    """EventPort emitting one QUOTE_EVENT tick per burst of quote updates.
+
+    A tick is emitted coalesce_window_s after the first update of a burst, so
+    any updates arriving within the window (or while the engine is busy with
+    the previous tick) share one tick. Commands passed to submit() are returned
+    ahead of pending ticks. Once the stream ends and its last burst has been
+    ticked, every wait returns a STOP command.
+
+    Args:
+        stream: Running quote stream.
+        coalesce_window_s: Delay from the first update of a burst to its tick.
+        clock: Optional callable returning event timestamps.
+    """
+
+    def __init__(
+        self,
+        stream: QuoteStream,
+        coalesce_window_s: float = 0.05,
+        clock: Callable[[], datetime] | None = None,
+    ):
+        """Initialize the port.
+
+        Args:
+            stream: Running quote stream.
+            coalesce_window_s: Delay from the first update of a burst to its tick.
+            clock: Optional callable returning event timestamps.
+        """
+        self.stream = stream
+        self.coalesce_window_s = coalesce_window_s
+        self.clock = clock or (lambda: datetime.now(timezone.utc))
+        self.logger = get_logger(self.__class__.__name__)
+        self.ticks = 0
+        self.delivered_version = 0
+        self._commands: deque[Event] = deque()
+
+    def submit(self, event: Event) -> None:
+        """Queue a command event ahead of pending ticks.
+
+        Args:
+            event: Event to return from the next wait_for_event.
+        """
+        with self.stream.changed:
+            self._commands.append(event)
+            self.stream.changed.notify_all()
+
+    @property
+    def updates_per_tick(self) -> float:
+        """Return the mean number of quote updates coalesced into each tick."""
+        return self.delivered_version / self.ticks if self.ticks else 0.0
+
+    def wait_for_event(self, timeout_s: float | None) -> Event | None:
+        """Wait for a command or the next coalesced quote tick.
+
+        Args:
+            timeout_s: Optional timeout in seconds. None means wait indefinitely.
+
+        Returns:
+            Command or TICK event, a STOP command once the stream has ended,
+            or None on timeout.
+        """
+        stream = self.stream
+        deadline = None if timeout_s is None else time.monotonic() + timeout_s
+        with stream.changed:
+            while True:
+                if self._commands:
+                    return self._commands.popleft()
+                now = time.monotonic()
+                if stream.pending_since is not None:
+                    due = stream.pending_since + self.coalesce_window_s
+                    if now >= due:
+                        self.delivered_version = stream.acknowledge()
+                        self.ticks += 1
+                        return Event(
+                            timestamp=self.clock(),
+                            type=EventType.TICK,
+                            reason=TickReason.QUOTE_EVENT,
+                        )
+                    wait_s = due - now
+                elif stream.ended:
+                    self.logger.warning("Quote stream ended; stopping the engine")
+                    return Event(
+                        timestamp=self.clock(),
+                        type=EventType.COMMAND,
+                        command=ControllerCommand.STOP,
+                    )
+                else:
+                    wait_s = None
+                if deadline is not None:
+                    if now >= deadline:
+                        return None
+                    wait_s = deadline - now if wait_s is None else min(wait_s, deadline - now)
+                stream.changed.wait(wait_s)
@@ -0,0 +1,194 @@
+"""Quote update sources for the streaming quote book.
+
+This module defines QuoteUpdate, a partial per-symbol quote change, and the
+QuoteSource interface the QuoteStream reader thread pulls from. Sources are a
+replay stand-in fed from memory (ReplayQuoteSource) and a message source that
+decodes text frames from any blocking transport, such as a websocket recv,
+with a parser for Schwab streamer LEVELONE_EQUITIES messages.
+"""
+
+from __future__ import annotations
+
+import json
+import queue
+from abc import ABC, abstractmethod
+from collections.abc import Callable, Iterable
+from dataclasses import dataclass
+from datetime import datetime, timezone
+from typing import Any
+
+from infrastructure.logging.logger import get_logger
+
+# Schwab streamer LEVELONE_EQUITIES field numbers mapped to QUOTE_FIELDS names
+LEVELONE_EQUITY_FIELDS = {
+    "1": "bid",
+    "2": "ask",
+    "3": "last",
+    "4": "bid_size",
+    "5": "ask_size",
+    "8": "volume",
+    "18": "change",
+    "42": "change_pct",
+}
+
+
+@dataclass(frozen=True)
+class QuoteUpdate:
+    """Change to one symbol's quote.
+
+    Attributes:
+        timestamp: Exchange or streamer timestamp of the change.
+        symbol: Symbol the change applies to.
+        fields: Changed values keyed by QUOTE_FIELDS name; others keep their value.
+    """
+
+    timestamp: datetime
+    symbol: str
+    fields: dict[str, float]
+
+
+class QuoteSource(ABC):
+    """Blocking source of quote updates."""
+
+    @abstractmethod
+    def read(self) -> list[QuoteUpdate] | None:
+        """Block until the next batch of updates arrives.
+
+        Returns:
+            Updates from one message (possibly empty), or None once the source
+            is exhausted or closed.
+        """
+        ...
+
+    @abstractmethod
+    def close(self) -> None:
+        """Close the source and unblock a pending read."""
+        ...
+
+
+class ReplayQuoteSource(QuoteSource):
+    """In-memory quote source for replays and tests.
+
+    Batches given up front are read in order; push() appends more while the
+    stream is running, so tests can script bursts against a live QuoteStream.
+
+    Args:
+        batches: Initial update batches.
+        end: Finish the stream after the initial batches.
+    """
+
+    def __init__(self, batches: Iterable[list[QuoteUpdate]] = (), end: bool = False):
+        """Initialize the source.
+
+        Args:
+            batches: Initial update batches.
+            end: Finish the stream after the initial batches.
+        """
+        self._queue: queue.Queue[list[QuoteUpdate] | None] = queue.Queue()
+        for batch in batches:
+            self._queue.put(list(batch))
+        if end:
+            self._queue.put(None)
+
+    def push(self, updates: list[QuoteUpdate]) -> None:
+        """Queue one batch of updates.
+
+        Args:
+            updates: Updates delivered together by one read.
+        """
+        self._queue.put(list(updates))
+
+    def read(self) -> list[QuoteUpdate] | None:
+        """Return the next queued batch, or None once ended."""
+        return self._queue.get()
+
+    def close(self) -> None:
+        """End the stream after the queued batches."""
+        self._queue.put(None)
+
+
+def parse_levelone_equities(message: str | bytes) -> list[QuoteUpdate]:
+    """Parse a Schwab streamer message into quote updates.
+
+    Only LEVELONE_EQUITIES data entries produce updates; responses, notify
+    heartbeats and other services are ignored.
+
+    Args:
+        message: One JSON text frame from the streamer.
+
+    Returns:
+        Updates carried by the frame, in message order.
+    """
+    payload = json.loads(message)
+    updates = []
+    for entry in payload.get("data", ()):
+        if entry.get("service") != "LEVELONE_EQUITIES":
+            continue
+        timestamp = datetime.fromtimestamp(entry.get("timestamp", 0) / 1000.0, tz=timezone.utc)
+        for item in entry.get("content", ()):
+            fields = {
+                name: float(item[key])
+                for key, name in LEVELONE_EQUITY_FIELDS.items()
+                if key in item
+            }
+            if fields:
+                updates.append(QuoteUpdate(timestamp=timestamp, symbol=item["key"], fields=fields))
+    return updates
+
+
+class MessageQuoteSource(QuoteSource):
+    """Quote source decoding text frames from a blocking transport.
+
+    Works with any transport exposing a blocking receive, e.g. a websocket
+    client's recv(). Frames that fail to parse are logged and skipped.
+
+    Args:
+        recv: Blocking call returning the next frame, or None/"" when closed.
+        parser: Converts one frame into quote updates.
+        on_close: Optional callable closing the transport.
+    """
+
+    def __init__(
+        self,
+        recv: Callable[[], str | bytes | None],
+        parser: Callable[[Any], list[QuoteUpdate]] = parse_levelone_equities,
+        on_close: Callable[[], None] | None = None,
+    ):
+        """Initialize the source.
+
+        Args:
+            recv: Blocking call returning the next frame, or None/"" when closed.
+            parser: Converts one frame into quote updates.
+            on_close: Optional callable closing the transport.
+        """
+        self.logger = get_logger(self.__class__.__name__)
+        self.recv = recv
+        self.parser = parser
+        self.on_close = on_close
+        self.parse_errors = 0
+        self._closed = False
+
+    def read(self) -> list[QuoteUpdate] | None:
+        """Receive and parse the next frame."""
+        if self._closed:
+            return None
+        try:
+            frame = self.recv()
+        except (ConnectionError, OSError) as e:
+            if not self._closed:
+                self.logger.warning(f"Quote transport closed: {e}")
+            return None
+        if not frame:
+            return None
+        try:
+            return self.parser(frame)
+        except (ValueError, KeyError, TypeError) as e:
+            self.parse_errors += 1
+            self.logger.warning(f"Skipping unparseable quote frame: {e}")
+            return []
+
+    def close(self) -> None:
+        """Close the transport."""
+        self._closed = True
+        if self.on_close is not None:
+            self.on_close()
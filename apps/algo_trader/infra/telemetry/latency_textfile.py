@@ -0,0 +1,124 @@
+"""Tick latency metrics for the node_exporter textfile collector.
+
+This module renders Engine per-stage latency summaries in Prometheus text
+format and provides TextfileControllerPort, a ControllerPort decorator that
+rewrites the textfile on every latency report. Point output_dir at the
+node_exporter --collector.textfile.directory used by apps/telemetry.
+
+Emits (seconds, one series per tick stage plus stage="tick"):
+- node_textfile_algo_trader_stage_latency_seconds{stage="strategy",quantile="0.99"} 0.0012
+- node_textfile_algo_trader_stage_latency_seconds_sum{stage="strategy"} 1.5
+- node_textfile_algo_trader_stage_latency_seconds_count{stage="strategy"} 1000
+- node_textfile_algo_trader_stage_latency_max_seconds{stage="strategy"} 0.004
+"""
+
+from __future__ import annotations
+
+from pathlib import Path
+
+from infrastructure.logging.logger import get_logger
+from system.algo_trader.domain.models import StageLatency
+from system.algo_trader.domain.ports.controller_port import ControllerPort
+from system.algo_trader.domain.states import ControllerCommand, EngineState
+from system.telemetry.system_info_textfile import format_sample, write_atomically
+
+_METRIC = "node_textfile_algo_trader_stage_latency_seconds"
+_MAX_METRIC = "node_textfile_algo_trader_stage_latency_max_seconds"
+
+
+def render_latency(latency: list[StageLatency]) -> str:
+    """Render latency summaries as Prometheus summary metrics.
+
+    Args:
+        latency: Latency summary per tick stage.
+
+    Returns:
+        Textfile content ending with a newline.
+    """
+    lines = [
+        f"# HELP {_METRIC} Engine tick stage latency.",
+        f"# TYPE {_METRIC} summary",
+    ]
+    for stage in latency:
+        labels = {"stage": stage.stage}
+        quantiles = (
+            ("0.5", stage.p50_ms),
+            ("0.9", stage.p90_ms),
+            ("0.99", stage.p99_ms),
+            ("0.999", stage.p999_ms),
+        )
+        for quantile, value_ms in quantiles:
+            lines.append(
+                format_sample(_METRIC, {**labels, "quantile": quantile}, f"{value_ms / 1e3:g}")
+            )
+        lines.append(format_sample(f"{_METRIC}_sum", labels, f"{stage.total_ms / 1e3:g}"))
+        lines.append(format_sample(f"{_METRIC}_count", labels, str(stage.count)))
+
+    lines.append(f"# HELP {_MAX_METRIC} Slowest engine tick stage latency.")
+    lines.append(f"# TYPE {_MAX_METRIC} gauge")
+    for stage in latency:
+        lines.append(format_sample(_MAX_METRIC, {"stage": stage.stage}, f"{stage.max_ms / 1e3:g}"))
+    return "\n".join(lines) + "\n"
+
+
+class TextfileControllerPort(ControllerPort):
+    """ControllerPort decorator that exports tick latency as a textfile.
+
+    Commands and status go to the wrapped port unchanged; latency reports are
+    forwarded and also written to output_dir/filename.
+
+    Args:
+        port: Controller port to decorate.
+        output_dir: node_exporter textfile collector directory.
+        filename: Textfile name (must end in .prom to be collected).
+    """
+
+    def __init__(
+        self,
+        port: ControllerPort,
+        output_dir: str | Path,
+        filename: str = "algo_trader_latency.prom",
+    ):
+        """Initialize the decorator.
+
+        Args:
+            port: Controller port to decorate.
+            output_dir: node_exporter textfile collector directory.
+            filename: Textfile name (must end in .prom to be collected).
+        """
+        self.logger = get_logger(self.__class__.__name__)
+        self.port = port
+        self.output_path = Path(output_dir) / filename
+
+    def wait_for_command(self, timeout_s: float | None) -> ControllerCommand | None:
+        """Wait for a control command from the wrapped port.
+
+        Args:
+            timeout_s: Optional timeout in seconds. None means wait indefinitely.
+
+        Returns:
+            ControllerCommand if received, None if timeout or no command.
+        """
+        return self.port.wait_for_command(timeout_s)
+
+    def publish_status(self, status: EngineState) -> None:
+        """Publish engine status to the wrapped port.
+
+        Args:
+            status: Current engine state to publish.
+        """
+        self.port.publish_status(status)
+
+    def publish_latency(self, latency: list[StageLatency]) -> None:
+        """Write the latency textfile and forward the report.
+
+        Write failures are logged and do not stop the forward.
+
+        Args:
+            latency: Latency summary per tick stage.
+        """
+        try:
+            write_atomically(self.output_path, render_latency(latency))
+        except OSError as e:
+            self.logger.warning(f"Failed to write {self.output_path}: {e}")
+        self.port.publish_latency(latency)
@@ -0,0 +1,98 @@
+"""Rate limiter metrics for the node_exporter textfile collector.
+
+This module renders SharedRateLimiter statistics in Prometheus text format
+and provides RateLimitTextfile, a metrics_sink for the limiter that rewrites
+the textfile on each report. Point output_dir at the node_exporter
+--collector.textfile.directory used by apps/telemetry; give each process its
+own filename.
+
+Emits (one series per endpoint class):
+- node_textfile_algo_trader_rate_limit_rate{endpoint="market_data"} 1.5
+- node_textfile_algo_trader_rate_limit_wait_seconds_sum{endpoint="market_data"} 12.4
+- node_textfile_algo_trader_rate_limit_wait_seconds_count{endpoint="market_data"} 40
+- node_textfile_algo_trader_rate_limit_wait_max_seconds{endpoint="market_data"} 0.5
+- node_textfile_algo_trader_rate_limit_requests_total{endpoint="market_data"} 300
+- node_textfile_algo_trader_rate_limit_throttled_total{endpoint="market_data"} 2
+- node_textfile_algo_trader_rate_limit_fallback_total{endpoint="market_data"} 0
+"""
+
+from __future__ import annotations
+
+from pathlib import Path
+
+from infrastructure.logging.logger import get_logger
+from system.algo_trader.infra.redis.rate_limiter import RateLimitStats
+from system.telemetry.system_info_textfile import format_sample, write_atomically
+
+_PREFIX = "node_textfile_algo_trader_rate_limit"
+
+# (metric suffix, type, help, value getter)
+_METRICS = (
+    ("rate", "gauge", "Shared request rate in requests per second.", lambda s: s.rate),
+    (
+        "wait_seconds_sum",
+        "counter",
+        "Total time requests waited for a token.",
+        lambda s: s.wait_s_total,
+    ),
+    ("wait_seconds_count", "counter", "Requests that waited for a token.", lambda s: s.waits),
+    ("wait_max_seconds", "gauge", "Longest wait for a token.", lambda s: s.wait_s_max),
+    ("requests_total", "counter", "Requests admitted by the limiter.", lambda s: s.requests),
+    ("throttled_total", "counter", "429 and 5xx responses recorded.", lambda s: s.throttled),
+    (
+        "fallback_total",
+        "counter",
+        "Requests admitted by the local fallback bucket.",
+        lambda s: s.fallbacks,
+    ),
+)
+
+
+def render_rate_limits(stats: list[RateLimitStats]) -> str:
+    """Render limiter statistics as Prometheus metrics.
+
+    Args:
+        stats: Statistics per endpoint class.
+
+    Returns:
+        Textfile content ending with a newline.
+    """
+    lines = []
+    for suffix, metric_type, help_text, value in _METRICS:
+        metric = f"{_PREFIX}_{suffix}"
+        lines.append(f"# HELP {metric} {help_text}")
+        lines.append(f"# TYPE {metric} {metric_type}")
+        for endpoint_stats in stats:
+            labels = {"endpoint": endpoint_stats.endpoint.value}
+            lines.append(format_sample(metric, labels, f"{value(endpoint_stats):g}"))
+    return "\n".join(lines) + "\n"
+
+
+class RateLimitTextfile:
+    """SharedRateLimiter metrics_sink that writes a node_exporter textfile.
+
+    Args:
+        output_dir: node_exporter textfile collector directory.
+        filename: Textfile name (must end in .prom to be collected).
+    """
+
+    def __init__(self, output_dir: str | Path, filename: str = "algo_trader_rate_limit.prom"):
+        """Initialize the sink.
+
+        Args:
+            output_dir: node_exporter textfile collector directory.
+            filename: Textfile name (must end in .prom to be collected).
+        """
+        self.logger = get_logger(self.__class__.__name__)
+        self.output_path = Path(output_dir) / filename
+
+    def __call__(self, stats: list[RateLimitStats]) -> None:
+        """Write the textfile; failures are logged.
+
+        Args:
+            stats: Statistics per endpoint class.
+        """
+        try:
+            write_atomically(self.output_path, render_rate_limits(stats))
+        except OSError as e:
+            self.logger.warning(f"Failed to write {self.output_path}: {e}")
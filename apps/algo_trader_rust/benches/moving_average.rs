@@ -0,0 +1,116 @@
+// Compares the original per-window SMA with the rolling kernels on 1M-bar
+// series, plus the batch kernels against looping the scalar ones.
+//
+//   cargo bench --bench moving_average
+use std::hint::black_box;
+
+use algo_trader_rust::data::technical_analysis::batch::{
+    exponential_moving_average_batch_into, simple_moving_average_batch_into,
+};
+use algo_trader_rust::data::technical_analysis::moving_average::{
+    exponential_moving_average, exponential_moving_average_into, output_len, simple_moving_average,
+    simple_moving_average_into,
+};
+use criterion::{criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+
+const BARS: usize = 1_000_000;
+const WINDOWS: [usize; 3] = [20, 50, 200];
+const BATCH_SERIES: usize = 8;
+
+// The implementation before the rolling sum, kept as the baseline.
+fn naive_simple_moving_average(data: &[f64], window: usize) -> Vec<f64> {
+    data.windows(window).map(|w| w.iter().sum::<f64>() / w.len() as f64).collect()
+}
+
+// Deterministic random walk around 100 (xorshift, no extra crates).
+fn random_walk(len: usize, seed: u64) -> Vec<f64> {
+    let mut state = seed.max(1);
+    let mut price = 100.0;
+    (0..len)
+        .map(|_| {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            price += (state as f64 / u64::MAX as f64 - 0.5) * 0.2;
+            price
+        })
+        .collect()
+}
+
+fn bench_sma(c: &mut Criterion) {
+    let closes = random_walk(BARS, 7);
+    let mut group = c.benchmark_group("sma_1m");
+    group.sample_size(10);
+    group.throughput(Throughput::Elements(BARS as u64));
+    for window in WINDOWS {
+        let mut out = vec![0.0; output_len(BARS, window).unwrap()];
+        group.bench_with_input(BenchmarkId::new("naive", window), &window, |b, &w| {
+            b.iter(|| naive_simple_moving_average(black_box(&closes), w))
+        });
+        group.bench_with_input(BenchmarkId::new("rolling", window), &window, |b, &w| {
+            b.iter(|| simple_moving_average(black_box(&closes), w).unwrap())
+        });
+        group.bench_with_input(BenchmarkId::new("rolling_into", window), &window, |b, &w| {
+            b.iter(|| simple_moving_average_into(black_box(&closes), w, &mut out).unwrap())
+        });
+    }
+    group.finish();
+}
+
+fn bench_ema(c: &mut Criterion) {
+    let closes = random_walk(BARS, 11);
+    let mut group = c.benchmark_group("ema_1m");
+    group.sample_size(10);
+    group.throughput(Throughput::Elements(BARS as u64));
+    for window in WINDOWS {
+        let mut out = vec![0.0; output_len(BARS, window).unwrap()];
+        group.bench_with_input(BenchmarkId::new("alloc", window), &window, |b, &w| {
+            b.iter(|| exponential_moving_average(black_box(&closes), w).unwrap())
+        });
+        group.bench_with_input(BenchmarkId::new("into", window), &window, |b, &w| {
+            b.iter(|| exponential_moving_average_into(black_box(&closes), w, &mut out).unwrap())
+        });
+    }
+    group.finish();
+}
+
+fn bench_batch(c: &mut Criterion) {
+    let window = 50;
+    let series: Vec<Vec<f64>> = (0..BATCH_SERIES as u64).map(|seed| random_walk(BARS, seed + 1)).collect();
+    let inputs: Vec<&[f64]> = series.iter().map(Vec::as_slice).collect();
+    let mut buffers = vec![vec![0.0; output_len(BARS, window).unwrap()]; BATCH_SERIES];
+
+    let mut group = c.benchmark_group("batch_8x1m");
+    group.sample_size(10);
+    group.throughput(Throughput::Elements((BARS * BATCH_SERIES) as u64));
+    group.bench_function("sma_scalar_into", |b| {
+        b.iter(|| {
+            for (values, out) in inputs.iter().zip(buffers.iter_mut()) {
+                simple_moving_average_into(black_box(values), window, out).unwrap();
+            }
+        })
+    });
+    group.bench_function("sma_batch_into", |b| {
+        b.iter(|| {
+            let mut outputs: Vec<&mut [f64]> = buffers.iter_mut().map(Vec::as_mut_slice).collect();
+            simple_moving_average_batch_into(black_box(&inputs), window, &mut outputs).unwrap();
+        })
+    });
+    group.bench_function("ema_scalar_into", |b| {
+        b.iter(|| {
+            for (values, out) in inputs.iter().zip(buffers.iter_mut()) {
+                exponential_moving_average_into(black_box(values), window, out).unwrap();
+            }
+        })
+    });
+    group.bench_function("ema_batch_into", |b| {
+        b.iter(|| {
+            let mut outputs: Vec<&mut [f64]> = buffers.iter_mut().map(Vec::as_mut_slice).collect();
+            exponential_moving_average_batch_into(black_box(&inputs), window, &mut outputs).unwrap();
+        })
+    });
+    group.finish();
+}
+
+criterion_group!(benches, bench_sma, bench_ema, bench_batch);
+criterion_main!(benches);
@@ -1,5 +1,6 @@
 use time::UtcDateTime;
 
+#[derive(Debug, Clone, Copy)]
 pub enum Minutes {
     One,
     Two,
@@ -22,6 +23,7 @@ impl Minutes {
     }
 }
 
+#[derive(Debug, Clone, Copy)]
 pub enum TimeAggregation {
     Minute(Minutes),
     Hour,
@@ -58,3 +60,104 @@ pub struct Bar {
     pub volume: u64,
 }
 
+// Bars of one ticker as one contiguous Vec per column. The ticker is stored
+// once, and the column accessors are plain slices, so e.g. close() feeds
+// simple_moving_average and the batch kernels without gathering values.
+#[derive(Debug, Clone, Default, PartialEq)]
+pub struct BarSeries {
+    ticker: String,
+    timestamps: Vec<UtcDateTime>,
+    open: Vec<f64>,
+    high: Vec<f64>,
+    low: Vec<f64>,
+    close: Vec<f64>,
+    volume: Vec<u64>,
+}
+
+impl BarSeries {
+    pub fn new(ticker: &str) -> Self {
+        Self::with_capacity(ticker, 0)
+    }
+
+    pub fn with_capacity(ticker: &str, capacity: usize) -> Self {
+        BarSeries {
+            ticker: ticker.to_string(),
+            timestamps: Vec::with_capacity(capacity),
+            open: Vec::with_capacity(capacity),
+            high: Vec::with_capacity(capacity),
+            low: Vec::with_capacity(capacity),
+            close: Vec::with_capacity(capacity),
+            volume: Vec::with_capacity(capacity),
+        }
+    }
+
+    pub fn from_bars(ticker: &str, bars: &[Bar]) -> Self {
+        let mut series = Self::with_capacity(ticker, bars.len());
+        for bar in bars {
+            series.push(bar.timestamp, bar.open, bar.high, bar.low, bar.close, bar.volume);
+        }
+        series
+    }
+
+    pub fn push(&mut self, timestamp: UtcDateTime, open: f64, high: f64, low: f64, close: f64, volume: u64) {
+        self.timestamps.push(timestamp);
+        self.open.push(open);
+        self.high.push(high);
+        self.low.push(low);
+        self.close.push(close);
+        self.volume.push(volume);
+    }
+
+    pub fn ticker(&self) -> &str {
+        &self.ticker
+    }
+
+    pub fn len(&self) -> usize {
+        self.timestamps.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.timestamps.is_empty()
+    }
+
+    pub fn timestamps(&self) -> &[UtcDateTime] {
+        &self.timestamps
+    }
+
+    pub fn open(&self) -> &[f64] {
+        &self.open
+    }
+
+    pub fn high(&self) -> &[f64] {
+        &self.high
+    }
+
+    pub fn low(&self) -> &[f64] {
+        &self.low
+    }
+
+    pub fn close(&self) -> &[f64] {
+        &self.close
+    }
+
+    pub fn volume(&self) -> &[u64] {
+        &self.volume
+    }
+
+    // Row i as an owned Bar, for code that still takes one bar at a time.
+    pub fn bar(&self, index: usize) -> Option<Bar> {
+        Some(Bar {
+            ticker: self.ticker.clone(),
+            timestamp: *self.timestamps.get(index)?,
+            open: self.open[index],
+            high: self.high[index],
+            low: self.low[index],
+            close: self.close[index],
+            volume: self.volume[index],
+        })
+    }
+
+    pub fn to_bars(&self) -> Vec<Bar> {
+        (0..self.len()).filter_map(|index| self.bar(index)).collect()
+    }
+}
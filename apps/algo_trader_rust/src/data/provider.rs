@@ -1,6 +1,10 @@
-use super::bar::{Bar, TimeAggregation};
+use futures::Stream;
+use super::bar::{Bar, BarSeries, TimeAggregation};
 use time::OffsetDateTime;
 
+// Callers await these futures in place and never spawn them, so the
+// missing Send bound that async_fn_in_trait warns about is not needed.
+#[allow(async_fn_in_trait)]
 pub trait Historical {
     type Error;
 
@@ -11,4 +15,31 @@ pub trait Historical {
         from: OffsetDateTime,
         to: OffsetDateTime,
     ) -> Result<Vec<Bar>, Self::Error>;
+
+    // Same bars as get_ohlcv in column storage. Providers should override
+    // this to fill the columns directly instead of building a Bar per row.
+    async fn get_ohlcv_series(
+        &self,
+        ticker: &str,
+        aggregation: TimeAggregation,
+        from: OffsetDateTime,
+        to: OffsetDateTime,
+    ) -> Result<BarSeries, Self::Error> {
+        let bars = self.get_ohlcv(ticker, aggregation, from, to).await?;
+        Ok(BarSeries::from_bars(ticker, &bars))
+    }
+}
+
+// Providers that fetch many tickers at once. Requests run at most
+// `max_in_flight` at a time and each series is yielded, with its ticker, as
+// soon as it arrives, so the stream is not in `tickers` order.
+pub trait BatchHistorical: Historical {
+    fn get_ohlcv_batch<'a>(
+        &'a self,
+        tickers: &'a [String],
+        aggregation: TimeAggregation,
+        from: OffsetDateTime,
+        to: OffsetDateTime,
+        max_in_flight: usize,
+    ) -> impl Stream<Item = (String, Result<BarSeries, Self::Error>)> + 'a;
 }
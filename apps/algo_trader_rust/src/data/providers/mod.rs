@@ -1 +1,2 @@
+pub mod throttle;
 pub mod yfinance;
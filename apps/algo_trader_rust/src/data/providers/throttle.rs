@@ -0,0 +1,56 @@
+use std::collections::HashMap;
+use std::sync::Mutex;
+use std::time::Duration;
+
+use tokio::time::Instant;
+
+// Spaces requests to the same host at least `interval` apart. Slots are
+// handed out under the lock and waited for outside it, so concurrent callers
+// queue in order instead of all firing when the interval elapses. Share one
+// limiter (behind an Arc) between providers that hit the same host.
+#[derive(Debug)]
+pub struct RateLimiter {
+    interval: Duration,
+    next_slot: Mutex<HashMap<String, Instant>>,
+}
+
+impl RateLimiter {
+    pub fn new(requests_per_second: f64) -> Self {
+        RateLimiter {
+            interval: Duration::from_secs_f64(1.0 / requests_per_second.max(f64::MIN_POSITIVE)),
+            next_slot: Mutex::new(HashMap::new()),
+        }
+    }
+
+    pub async fn acquire(&self, host: &str) {
+        let slot = {
+            let mut next_slot = self.next_slot.lock().unwrap_or_else(|e| e.into_inner());
+            let now = Instant::now();
+            let next = next_slot.entry(host.to_string()).or_insert(now);
+            let slot = (*next).max(now);
+            *next = slot + self.interval;
+            slot
+        };
+        tokio::time::sleep_until(slot).await;
+    }
+}
+
+// Exponential backoff: retry n (from 0) waits initial * 2^n, capped at max.
+#[derive(Debug, Clone, Copy)]
+pub struct Backoff {
+    pub max_retries: u32,
+    pub initial: Duration,
+    pub max: Duration,
+}
+
+impl Backoff {
+    pub fn delay(&self, retry: u32) -> Duration {
+        self.initial.saturating_mul(1 << retry.min(16)).min(self.max)
+    }
+}
+
+impl Default for Backoff {
+    fn default() -> Self {
+        Backoff { max_retries: 3, initial: Duration::from_millis(500), max: Duration::from_secs(8) }
+    }
+}
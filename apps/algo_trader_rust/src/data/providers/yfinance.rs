@@ -1,11 +1,19 @@
+use std::sync::Arc;
+
+use futures::stream::{self, Stream, StreamExt};
 use thiserror::Error;
 use time::error::ComponentRange;
 use yahoo_finance_api as yahoo;
 use yahoo_finance_api::YahooError;
 use time::{OffsetDateTime, UtcDateTime};
 
-use crate::data::bar::{Bar, TimeAggregation};
-use crate::data::provider::Historical;
+use crate::data::bar::{Bar, BarSeries, TimeAggregation};
+use crate::data::provider::{BatchHistorical, Historical};
+use crate::data::providers::throttle::{Backoff, RateLimiter};
+
+// Host every chart request goes to; the rate limiter is keyed on it.
+const YAHOO_HOST: &str = "query1.finance.yahoo.com";
+const DEFAULT_REQUESTS_PER_SECOND: f64 = 4.0;
 
 #[derive(Debug)]
 pub enum YfinanceError {
@@ -26,19 +34,112 @@ impl From<ComponentRange> for YfinanceError {
     }
 }
 
-pub struct Yfinance {
-    connector: yahoo::YahooConnector
+impl YfinanceError {
+    // Connection failures, timeouts, throttling (429) and server errors (5xx)
+    // can succeed on a later attempt; anything else fails the same way again.
+    pub fn is_transient(&self) -> bool {
+        match self {
+            YfinanceError::Yahoo(YahooError::ConnectionFailed(e)) => {
+                e.is_connect() || e.is_timeout() || e.is_request()
+            }
+            YfinanceError::Yahoo(YahooError::FetchFailed(status)) => is_retryable_status(status),
+            _ => false,
+        }
+    }
+}
+
+// FetchFailed carries the HTTP status line, e.g. "429 Too Many Requests".
+fn is_retryable_status(status: &str) -> bool {
+    let code = status.split_whitespace().next().and_then(|code| code.parse::<u16>().ok());
+    matches!(code, Some(429 | 500..=599))
+}
+
+// Where chart requests go: Yahoo in production, a local server in tests.
+// One call is one request; Yfinance adds rate limiting and retries.
+// Like Historical, its futures are awaited in place, so no Send bound.
+#[allow(async_fn_in_trait)]
+pub trait ChartSource {
+    async fn fetch_series(
+        &self,
+        ticker: &str,
+        aggregation: TimeAggregation,
+        from: OffsetDateTime,
+        to: OffsetDateTime,
+    ) -> Result<BarSeries, YfinanceError>;
+}
+
+impl ChartSource for yahoo::YahooConnector {
+    async fn fetch_series(
+        &self,
+        ticker: &str,
+        aggregation: TimeAggregation,
+        from: OffsetDateTime,
+        to: OffsetDateTime,
+    ) -> Result<BarSeries, YfinanceError> {
+        let response = self.get_quote_history_interval(
+            ticker,
+            from,
+            to,
+            aggregation.as_string(),
+        )
+            .await?;
+        let quotes = response.quotes()?;
+        let mut series = BarSeries::with_capacity(ticker, quotes.len());
+        for q in &quotes {
+            let timestamp = UtcDateTime::from_unix_timestamp(q.timestamp as i64)?;
+            series.push(timestamp, q.open, q.high, q.low, q.close, q.volume);
+        }
+        Ok(series)
+    }
+}
+
+pub struct Yfinance<S = yahoo::YahooConnector> {
+    source: S,
+    limiter: Arc<RateLimiter>,
+    backoff: Backoff,
 }
 
 impl Yfinance {
     pub fn new() -> Self {
+        Self::with_source(yahoo::YahooConnector::new().unwrap())
+    }
+}
+
+impl<S: ChartSource> Yfinance<S> {
+    // Takes a preconfigured connector (timeouts, proxy) or another source.
+    pub fn with_source(source: S) -> Self {
         Yfinance {
-            connector: yahoo::YahooConnector::new().unwrap()
+            source,
+            limiter: Arc::new(RateLimiter::new(DEFAULT_REQUESTS_PER_SECOND)),
+            backoff: Backoff::default(),
         }
     }
+
+    // Shares one limiter between providers so their combined request rate stays under it.
+    pub fn with_rate_limiter(mut self, limiter: Arc<RateLimiter>) -> Self {
+        self.limiter = limiter;
+        self
+    }
+
+    pub fn with_backoff(mut self, backoff: Backoff) -> Self {
+        self.backoff = backoff;
+        self
+    }
+
+    // One rate-limited request, no retries.
+    async fn fetch_series(
+        &self,
+        ticker: &str,
+        aggregation: TimeAggregation,
+        from: OffsetDateTime,
+        to: OffsetDateTime,
+    ) -> Result<BarSeries, YfinanceError> {
+        self.limiter.acquire(YAHOO_HOST).await;
+        self.source.fetch_series(ticker, aggregation, from, to).await
+    }
 }
 
-impl Historical for Yfinance {
+impl<S: ChartSource> Historical for Yfinance<S> {
     type Error = YfinanceError;
 
     async fn get_ohlcv(
@@ -48,31 +149,48 @@ impl Historical for Yfinance {
         from: OffsetDateTime,
         to: OffsetDateTime,
     ) -> Result<Vec<Bar>, Self::Error> {
+        Ok(self.get_ohlcv_series(ticker, aggregation, from, to).await?.to_bars())
+    }
+
+    async fn get_ohlcv_series(
+        &self,
+        ticker: &str,
+        aggregation: TimeAggregation,
+        from: OffsetDateTime,
+        to: OffsetDateTime,
+    ) -> Result<BarSeries, Self::Error> {
         check_interval(&aggregation, from)?;
-        let response = self.connector.get_quote_history_interval(
-            ticker,
-            from,
-            to,
-            aggregation.as_string(),
-        )
-            .await?;
-        let quotes = response.quotes()?;
-        quotes
-            .iter()
-            .map(|q| -> Result<Bar, YfinanceError> {
-                Ok(Bar {
-                    ticker: ticker.to_string(),
-                    timestamp: UtcDateTime::from_unix_timestamp(q.timestamp as i64)?,
-                    open: q.open,
-                    high: q.high,
-                    low: q.low,
-                    close: q.close,
-                    volume: q.volume,
-                })
-            })
-            .collect::<Result<Vec<Bar>, YfinanceError>>()
+        let mut retry = 0;
+        loop {
+            match self.fetch_series(ticker, aggregation, from, to).await {
+                Err(e) if e.is_transient() && retry < self.backoff.max_retries => {
+                    let delay = self.backoff.delay(retry);
+                    log::warn!("{ticker}: {e:?}, retrying in {delay:?}");
+                    tokio::time::sleep(delay).await;
+                    retry += 1;
+                }
+                fetched => return fetched,
+            }
         }
     }
+}
+
+impl<S: ChartSource> BatchHistorical for Yfinance<S> {
+    fn get_ohlcv_batch<'a>(
+        &'a self,
+        tickers: &'a [String],
+        aggregation: TimeAggregation,
+        from: OffsetDateTime,
+        to: OffsetDateTime,
+        max_in_flight: usize,
+    ) -> impl Stream<Item = (String, Result<BarSeries, Self::Error>)> + 'a {
+        stream::iter(tickers)
+            .map(move |ticker| async move {
+                (ticker.clone(), self.get_ohlcv_series(ticker, aggregation, from, to).await)
+            })
+            .buffer_unordered(max_in_flight.max(1))
+    }
+}
 
 fn check_interval(
     interval: &TimeAggregation,
@@ -96,3 +214,206 @@ fn check_interval(
         }
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use std::collections::HashMap;
+    use std::net::SocketAddr;
+    use std::sync::Mutex;
+    use std::sync::atomic::{AtomicUsize, Ordering};
+    use std::time::Duration;
+
+    use tokio::io::{AsyncReadExt, AsyncWriteExt};
+    use tokio::net::{TcpListener, TcpStream};
+    use tokio::time::Instant;
+
+    use super::*;
+
+    // Local chart server. GET /<ticker> answers after a short delay with one
+    // close per line, or with the status scripted for that ticker.
+    #[derive(Default)]
+    struct MockServer {
+        // Status per attempt; attempts past the end of the script get 200.
+        scripts: HashMap<String, Vec<u16>>,
+        attempts: Mutex<HashMap<String, usize>>,
+        arrivals: Mutex<Vec<Instant>>,
+        in_flight: AtomicUsize,
+        max_in_flight: AtomicUsize,
+    }
+
+    impl MockServer {
+        async fn start(scripts: &[(&str, &[u16])]) -> (Arc<MockServer>, SocketAddr) {
+            let server = Arc::new(MockServer {
+                scripts: scripts.iter().map(|(t, s)| (t.to_string(), s.to_vec())).collect(),
+                ..MockServer::default()
+            });
+            let listener = TcpListener::bind("127.0.0.1:0").await.unwrap();
+            let addr = listener.local_addr().unwrap();
+            let accepting = server.clone();
+            tokio::spawn(async move {
+                while let Ok((stream, _)) = listener.accept().await {
+                    tokio::spawn(accepting.clone().serve(stream));
+                }
+            });
+            (server, addr)
+        }
+
+        async fn serve(self: Arc<Self>, mut stream: TcpStream) {
+            self.arrivals.lock().unwrap().push(Instant::now());
+            let running = self.in_flight.fetch_add(1, Ordering::SeqCst) + 1;
+            self.max_in_flight.fetch_max(running, Ordering::SeqCst);
+
+            let mut request = vec![0; 1024];
+            let n = stream.read(&mut request).await.unwrap();
+            let request = String::from_utf8_lossy(&request[..n]);
+            let ticker = request.split_whitespace().nth(1).unwrap().trim_start_matches('/');
+            let attempt = {
+                let mut attempts = self.attempts.lock().unwrap();
+                let count = attempts.entry(ticker.to_string()).or_insert(0);
+                *count += 1;
+                *count - 1
+            };
+            let status = self.scripts.get(ticker).and_then(|s| s.get(attempt)).copied();
+            tokio::time::sleep(Duration::from_millis(20)).await;
+
+            let response = match status.unwrap_or(200) {
+                200 => format!("HTTP/1.1 200 OK\r\nConnection: close\r\n\r\n1.0\n2.0\n{}\n", ticker.len()),
+                code => format!("HTTP/1.1 {code} Scripted\r\nConnection: close\r\n\r\n"),
+            };
+            self.in_flight.fetch_sub(1, Ordering::SeqCst);
+            stream.write_all(response.as_bytes()).await.unwrap();
+        }
+
+        fn attempts(&self, ticker: &str) -> usize {
+            self.attempts.lock().unwrap().get(ticker).copied().unwrap_or(0)
+        }
+    }
+
+    // Minimal HTTP/1.1 client for the mock server; non-200 statuses come back
+    // as FetchFailed with the status line, as YahooConnector reports them.
+    struct HttpSource {
+        addr: SocketAddr,
+    }
+
+    impl ChartSource for HttpSource {
+        async fn fetch_series(
+            &self,
+            ticker: &str,
+            _aggregation: TimeAggregation,
+            _from: OffsetDateTime,
+            _to: OffsetDateTime,
+        ) -> Result<BarSeries, YfinanceError> {
+            let mut stream = TcpStream::connect(self.addr).await.unwrap();
+            let request = format!("GET /{ticker} HTTP/1.1\r\nHost: localhost\r\nConnection: close\r\n\r\n");
+            stream.write_all(request.as_bytes()).await.unwrap();
+            let mut response = String::new();
+            stream.read_to_string(&mut response).await.unwrap();
+
+            let (head, body) = response.split_once("\r\n\r\n").unwrap();
+            let status = head.lines().next().unwrap().split_once(' ').unwrap().1;
+            if !status.starts_with("200") {
+                return Err(YfinanceError::Yahoo(YahooError::FetchFailed(status.to_string())));
+            }
+            let mut series = BarSeries::new(ticker);
+            for (day, close) in body.lines().enumerate() {
+                let close: f64 = close.parse().unwrap();
+                let timestamp = UtcDateTime::from_unix_timestamp(day as i64 * 86_400)?;
+                series.push(timestamp, close, close, close, close, 0);
+            }
+            Ok(series)
+        }
+    }
+
+    fn provider(addr: SocketAddr, requests_per_second: f64) -> Yfinance<HttpSource> {
+        Yfinance::with_source(HttpSource { addr })
+            .with_rate_limiter(Arc::new(RateLimiter::new(requests_per_second)))
+            .with_backoff(Backoff {
+                max_retries: 2,
+                initial: Duration::from_millis(5),
+                max: Duration::from_millis(10),
+            })
+    }
+
+    fn window() -> (OffsetDateTime, OffsetDateTime) {
+        let to = OffsetDateTime::now_utc();
+        (to - time::Duration::days(30), to)
+    }
+
+    #[test]
+    fn only_connection_throttling_and_server_errors_are_transient() {
+        let failed = |status: &str| YfinanceError::Yahoo(YahooError::FetchFailed(status.to_string()));
+        assert!(failed("429 Too Many Requests").is_transient());
+        assert!(failed("503 Service Unavailable").is_transient());
+        assert!(!failed("404 Not Found").is_transient());
+        assert!(!failed("401 Unauthorized").is_transient());
+        assert!(!YfinanceError::InvalidInterval("too old".to_string()).is_transient());
+    }
+
+    #[tokio::test]
+    async fn retries_transient_statuses_only() {
+        let (server, addr) = MockServer::start(&[
+            ("FLAKY", &[429, 503]),
+            ("DOWN", &[503, 503, 503, 503]),
+            ("GONE", &[404]),
+        ])
+        .await;
+        let provider = provider(addr, 1_000.0);
+        let (from, to) = window();
+
+        let flaky = provider.get_ohlcv_series("FLAKY", TimeAggregation::Day, from, to).await;
+        let down = provider.get_ohlcv_series("DOWN", TimeAggregation::Day, from, to).await;
+        let gone = provider.get_ohlcv_series("GONE", TimeAggregation::Day, from, to).await;
+
+        assert_eq!(flaky.unwrap().close(), &[1.0, 2.0, 5.0]);
+        assert_eq!(server.attempts("FLAKY"), 3);
+        assert!(down.unwrap_err().is_transient());
+        assert_eq!(server.attempts("DOWN"), 3);
+        assert!(!gone.unwrap_err().is_transient());
+        assert_eq!(server.attempts("GONE"), 1);
+    }
+
+    #[tokio::test]
+    async fn batch_keeps_at_most_max_in_flight() {
+        let (server, addr) = MockServer::start(&[("B", &[503])]).await;
+        let provider = provider(addr, 1_000.0);
+        let (from, to) = window();
+        let tickers: Vec<String> = ["A", "B", "CC", "DDD", "E", "F", "G", "H"]
+            .iter()
+            .map(|t| t.to_string())
+            .collect();
+
+        let mut fetched: Vec<(String, usize)> = provider
+            .get_ohlcv_batch(&tickers, TimeAggregation::Day, from, to, 3)
+            .map(|(ticker, series)| (ticker, series.unwrap().len()))
+            .collect()
+            .await;
+        fetched.sort();
+
+        assert_eq!(fetched.len(), tickers.len());
+        assert!(fetched.iter().all(|(_, len)| *len == 3));
+        assert_eq!(server.attempts("B"), 2);
+        let max_in_flight = server.max_in_flight.load(Ordering::SeqCst);
+        assert!((2..=3).contains(&max_in_flight), "max in flight {max_in_flight}");
+    }
+
+    #[tokio::test]
+    async fn rate_limiter_spaces_requests() {
+        let (server, addr) = MockServer::start(&[]).await;
+        let provider = provider(addr, 20.0);
+        let (from, to) = window();
+        let tickers: Vec<String> = (0..5).map(|i| format!("T{i}")).collect();
+
+        let fetched = provider
+            .get_ohlcv_batch(&tickers, TimeAggregation::Day, from, to, tickers.len())
+            .count()
+            .await;
+
+        assert_eq!(fetched, tickers.len());
+        let mut arrivals = server.arrivals.lock().unwrap().clone();
+        arrivals.sort();
+        for pair in arrivals.windows(2) {
+            let gap = pair[1] - pair[0];
+            assert!(gap >= Duration::from_millis(40), "requests {gap:?} apart");
+        }
+    }
+}
@@ -0,0 +1,252 @@
+// Moving averages over many equal-length series at once, e.g. one close
+// series per symbol of a scan. Series are taken LANES at a time and stepped
+// in lockstep, so each bar is a straight-line update of [f64; LANES] arrays
+// that LLVM lowers to packed SIMD adds, multiplies and divides on stable
+// Rust. Loading a bar from LANES series and storing the results stays
+// scalar; the arithmetic between them is vectorized. Leftover series
+// (fewer than LANES) use the scalar kernels.
+use super::moving_average::{
+    check_output, exponential_moving_average_into, output_len, simple_moving_average_into,
+    wilder_moving_average_into, with_non_finite, MovingAverageError,
+};
+
+pub const LANES: usize = 4;
+
+// LANES Neumaier-compensated running sums, one per series, with the NaN and
+// infinity counts of CompensatedSum. Lanes select instead of branching on
+// non-finite values so the update stays straight-line.
+#[derive(Clone, Copy)]
+struct LaneSum {
+    sum: [f64; LANES],
+    compensation: [f64; LANES],
+    nan: [i32; LANES],
+    pos_inf: [i32; LANES],
+    neg_inf: [i32; LANES],
+}
+
+impl LaneSum {
+    fn new() -> Self {
+        LaneSum {
+            sum: [0.0; LANES],
+            compensation: [0.0; LANES],
+            nan: [0; LANES],
+            pos_inf: [0; LANES],
+            neg_inf: [0; LANES],
+        }
+    }
+
+    #[inline(always)]
+    fn add(&mut self, values: [f64; LANES]) {
+        self.accumulate(values, 1.0, 1);
+    }
+
+    #[inline(always)]
+    fn remove(&mut self, values: [f64; LANES]) {
+        self.accumulate(values, -1.0, -1);
+    }
+
+    #[inline(always)]
+    fn accumulate(&mut self, values: [f64; LANES], sign: f64, delta: i32) {
+        for lane in 0..LANES {
+            let raw = values[lane];
+            self.nan[lane] += delta * raw.is_nan() as i32;
+            self.pos_inf[lane] += delta * (raw == f64::INFINITY) as i32;
+            self.neg_inf[lane] += delta * (raw == f64::NEG_INFINITY) as i32;
+            let sum = self.sum[lane];
+            let value = if raw.is_finite() { sign * raw } else { 0.0 };
+            let total = sum + value;
+            let (big, small) = if sum.abs() >= value.abs() { (sum, value) } else { (value, sum) };
+            self.compensation[lane] += (big - total) + small;
+            self.sum[lane] = total;
+        }
+    }
+
+    #[inline(always)]
+    fn value(&self) -> [f64; LANES] {
+        std::array::from_fn(|lane| {
+            with_non_finite(
+                self.sum[lane] + self.compensation[lane],
+                self.nan[lane],
+                self.pos_inf[lane],
+                self.neg_inf[lane],
+            )
+        })
+    }
+}
+
+// Checks every series has the same length and every output the SMA/EMA length.
+fn check_batch(series: &[&[f64]], window: usize, out: &[&mut [f64]]) -> Result<usize, MovingAverageError> {
+    check_output(series.len(), out.len())?;
+    let Some(first) = series.first() else { return Ok(0) };
+    let len = first.len();
+    let expected = output_len(len, window)?;
+    for (values, slot) in series.iter().zip(out) {
+        if values.len() != len {
+            return Err(MovingAverageError::SeriesLength { expected: len, len: values.len() });
+        }
+        check_output(expected, slot.len())?;
+    }
+    Ok(expected)
+}
+
+#[inline(always)]
+fn gather(series: &[&[f64]; LANES], index: usize) -> [f64; LANES] {
+    std::array::from_fn(|lane| series[lane][index])
+}
+
+#[inline(always)]
+fn scatter(out: &mut [&mut [f64]; LANES], index: usize, values: [f64; LANES]) {
+    for lane in 0..LANES {
+        out[lane][index] = values[lane];
+    }
+}
+
+fn sma_lanes(series: &[&[f64]; LANES], window: usize, out: &mut [&mut [f64]; LANES], count: usize) {
+    let divisor = window as f64;
+    let mut sum = LaneSum::new();
+    for index in 0..window {
+        sum.add(gather(series, index));
+    }
+    scatter(out, 0, sum.value().map(|total| total / divisor));
+    for index in 1..count {
+        sum.add(gather(series, index + window - 1));
+        sum.remove(gather(series, index - 1));
+        scatter(out, index, sum.value().map(|total| total / divisor));
+    }
+}
+
+fn smoothed_lanes(series: &[&[f64]; LANES], window: usize, multiplier: f64, out: &mut [&mut [f64]; LANES], count: usize) {
+    let mut seed = LaneSum::new();
+    for index in 0..window {
+        seed.add(gather(series, index));
+    }
+    let mut prev = seed.value().map(|total| total / window as f64);
+    scatter(out, 0, prev);
+    for index in 1..count {
+        let values = gather(series, index + window - 1);
+        for lane in 0..LANES {
+            prev[lane] = values[lane] * multiplier + prev[lane] * (1.0 - multiplier);
+        }
+        scatter(out, index, prev);
+    }
+}
+
+type ScalarKernel = fn(&[f64], usize, &mut [f64]) -> Result<(), MovingAverageError>;
+
+fn run_batch(
+    series: &[&[f64]],
+    window: usize,
+    out: &mut [&mut [f64]],
+    lanes: impl Fn(&[&[f64]; LANES], usize, &mut [&mut [f64]; LANES], usize),
+    scalar: ScalarKernel,
+) -> Result<(), MovingAverageError> {
+    let count = check_batch(series, window, out)?;
+    let mut inputs = series.chunks_exact(LANES);
+    let mut outputs = out.chunks_exact_mut(LANES);
+    for (group, slots) in inputs.by_ref().zip(outputs.by_ref()) {
+        let group: &[&[f64]; LANES] = group.try_into().expect("chunk of LANES series");
+        let slots: &mut [&mut [f64]; LANES] = slots.try_into().expect("chunk of LANES outputs");
+        lanes(group, window, slots, count);
+    }
+    for (values, slot) in inputs.remainder().iter().zip(outputs.into_remainder()) {
+        scalar(values, window, slot)?;
+    }
+    Ok(())
+}
+
+// SMA of every series; out[i] must hold output_len(series[i].len(), window) values.
+pub fn simple_moving_average_batch_into(series: &[&[f64]], window: usize, out: &mut [&mut [f64]]) -> Result<(), MovingAverageError> {
+    run_batch(series, window, out, sma_lanes, simple_moving_average_into)
+}
+
+pub fn exponential_moving_average_batch_into(series: &[&[f64]], window: usize, out: &mut [&mut [f64]]) -> Result<(), MovingAverageError> {
+    let multiplier = 2.0 / (window + 1) as f64;
+    let lanes = |group: &[&[f64]; LANES], window, slots: &mut [&mut [f64]; LANES], count| {
+        smoothed_lanes(group, window, multiplier, slots, count)
+    };
+    run_batch(series, window, out, lanes, exponential_moving_average_into)
+}
+
+pub fn wilder_moving_average_batch_into(series: &[&[f64]], window: usize, out: &mut [&mut [f64]]) -> Result<(), MovingAverageError> {
+    let multiplier = 1.0 / window as f64;
+    let lanes = |group: &[&[f64]; LANES], window, slots: &mut [&mut [f64]; LANES], count| {
+        smoothed_lanes(group, window, multiplier, slots, count)
+    };
+    run_batch(series, window, out, lanes, wilder_moving_average_into)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::data::technical_analysis::moving_average::wilder_moving_average_into;
+
+    // Two full lane groups plus a remainder, with non-finite values in some lanes.
+    fn series() -> Vec<Vec<f64>> {
+        (0..2 * LANES + 1)
+            .map(|s| {
+                let mut values: Vec<f64> = (0..500)
+                    .map(|i| 100.0 + ((i * 7919 + s * 104_729) % 1000) as f64 / 997.0 + s as f64 * 1e12)
+                    .collect();
+                match s {
+                    1 => values[100] = f64::NAN,
+                    2 => values[200] = f64::INFINITY,
+                    5 => {
+                        values[50] = f64::INFINITY;
+                        values[52] = f64::NEG_INFINITY;
+                    }
+                    _ => {}
+                }
+                values
+            })
+            .collect()
+    }
+
+    fn same(a: f64, b: f64) -> bool {
+        a.to_bits() == b.to_bits() || (a.is_nan() && b.is_nan())
+    }
+
+    fn check_lanes_match_scalar(
+        batch: fn(&[&[f64]], usize, &mut [&mut [f64]]) -> Result<(), MovingAverageError>,
+        scalar: ScalarKernel,
+    ) {
+        let data = series();
+        let inputs: Vec<&[f64]> = data.iter().map(Vec::as_slice).collect();
+        for window in [1, 3, 20, 200] {
+            let count = output_len(data[0].len(), window).unwrap();
+            let mut outputs = vec![vec![0.0; count]; data.len()];
+            let mut slots: Vec<&mut [f64]> = outputs.iter_mut().map(Vec::as_mut_slice).collect();
+            batch(&inputs, window, &mut slots).unwrap();
+
+            for (values, got) in data.iter().zip(&outputs) {
+                let mut want = vec![0.0; count];
+                scalar(values, window, &mut want).unwrap();
+                assert!(got.iter().zip(&want).all(|(&a, &b)| same(a, b)), "window {window}");
+            }
+        }
+    }
+
+    #[test]
+    fn sma_lanes_match_scalar_kernel() {
+        check_lanes_match_scalar(simple_moving_average_batch_into, simple_moving_average_into);
+    }
+
+    #[test]
+    fn smoothed_lanes_match_scalar_kernels() {
+        check_lanes_match_scalar(exponential_moving_average_batch_into, exponential_moving_average_into);
+        check_lanes_match_scalar(wilder_moving_average_batch_into, wilder_moving_average_into);
+    }
+
+    #[test]
+    fn lane_sum_isolates_non_finite_lanes() {
+        let mut sum = LaneSum::new();
+        sum.add([1e16, f64::NAN, f64::INFINITY, 2.0]);
+        sum.add([1.0, 1.0, f64::NEG_INFINITY, 3.0]);
+        let both = sum.value();
+        sum.remove([1e16, f64::NAN, f64::INFINITY, 2.0]);
+
+        assert_eq!(both[0], 1e16 + 1.0);
+        assert!(both[1].is_nan() && both[2].is_nan());
+        assert_eq!(both[3], 5.0);
+        assert_eq!(sum.value(), [1.0, 1.0, f64::NEG_INFINITY, 3.0]);
+    }
+}
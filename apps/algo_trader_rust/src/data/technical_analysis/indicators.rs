@@ -0,0 +1,161 @@
+// Stateful indicators updated one value at a time, for live bars. Each push
+// is O(1) and returns the indicator once enough values have been seen, so a
+// scanner does constant work per new bar instead of recomputing the history.
+// Fed the same series, they produce exactly the values of the slice
+// functions in moving_average. The state derives Serialize/Deserialize so
+// it can be checkpointed and restored across restarts.
+use std::collections::VecDeque;
+
+use serde::{Deserialize, Serialize};
+
+use super::moving_average::{CompensatedSum, MovingAverageError};
+
+pub trait Indicator {
+    // Adds the next value and returns the updated indicator, or None while warming up.
+    fn push(&mut self, value: f64) -> Option<f64>;
+
+    // The value returned by the last push.
+    fn current(&self) -> Option<f64>;
+}
+
+#[derive(Debug, Clone, Serialize, Deserialize)]
+pub struct Sma {
+    window: usize,
+    values: VecDeque<f64>,
+    sum: CompensatedSum,
+}
+
+impl Sma {
+    pub fn new(window: usize) -> Result<Self, MovingAverageError> {
+        if window == 0 {
+            return Err(MovingAverageError::WindowZero);
+        }
+        Ok(Sma { window, values: VecDeque::with_capacity(window + 1), sum: CompensatedSum::default() })
+    }
+
+    pub fn window(&self) -> usize {
+        self.window
+    }
+}
+
+impl Indicator for Sma {
+    fn push(&mut self, value: f64) -> Option<f64> {
+        self.values.push_back(value);
+        self.sum.add(value);
+        if self.values.len() > self.window {
+            let leaving = self.values.pop_front().expect("window is not empty");
+            self.sum.remove(leaving);
+        }
+        self.current()
+    }
+
+    fn current(&self) -> Option<f64> {
+        (self.values.len() == self.window).then(|| self.sum.value() / self.window as f64)
+    }
+}
+
+// EMA seeded with the SMA of the first window, as exponential_moving_average.
+#[derive(Debug, Clone, Serialize, Deserialize)]
+pub struct Ema {
+    window: usize,
+    multiplier: f64,
+    seen: usize,
+    seed: CompensatedSum,
+    value: Option<f64>,
+}
+
+impl Ema {
+    pub fn new(window: usize) -> Result<Self, MovingAverageError> {
+        Self::with_multiplier(window, 2.0 / (window + 1) as f64)
+    }
+
+    // Wilder's smoothing (RMA), as wilder_moving_average.
+    pub fn wilder(window: usize) -> Result<Self, MovingAverageError> {
+        Self::with_multiplier(window, 1.0 / window as f64)
+    }
+
+    fn with_multiplier(window: usize, multiplier: f64) -> Result<Self, MovingAverageError> {
+        if window == 0 {
+            return Err(MovingAverageError::WindowZero);
+        }
+        Ok(Ema { window, multiplier, seen: 0, seed: CompensatedSum::default(), value: None })
+    }
+
+    pub fn window(&self) -> usize {
+        self.window
+    }
+}
+
+impl Indicator for Ema {
+    fn push(&mut self, value: f64) -> Option<f64> {
+        self.value = match self.value {
+            Some(prev) => Some(value * self.multiplier + prev * (1.0 - self.multiplier)),
+            None => {
+                self.seen += 1;
+                self.seed.add(value);
+                (self.seen == self.window).then(|| self.seed.value() / self.window as f64)
+            }
+        };
+        self.value
+    }
+
+    fn current(&self) -> Option<f64> {
+        self.value
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::data::technical_analysis::moving_average::{
+        exponential_moving_average, simple_moving_average, wilder_moving_average,
+    };
+
+    // Deterministic random walk around 100 (xorshift, no extra crates).
+    fn random_walk(len: usize, seed: u64) -> Vec<f64> {
+        let mut state = seed.max(1);
+        let mut price = 100.0;
+        (0..len)
+            .map(|_| {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                price += (state as f64 / u64::MAX as f64 - 0.5) * 0.2;
+                price
+            })
+            .collect()
+    }
+
+    // Pushes every value and checks warm-up, then each output against the
+    // slice function bit for bit.
+    fn assert_matches_batch(mut indicator: impl Indicator, window: usize, data: &[f64], batch: &[f64]) {
+        for (index, &value) in data.iter().enumerate() {
+            let pushed = indicator.push(value);
+            assert_eq!(pushed.map(f64::to_bits), indicator.current().map(f64::to_bits));
+            match index.checked_sub(window - 1) {
+                None => assert_eq!(pushed, None, "bar {index} during warm-up"),
+                Some(out) => assert_eq!(pushed.map(f64::to_bits), Some(batch[out].to_bits()), "bar {index}"),
+            }
+        }
+    }
+
+    #[test]
+    fn incremental_indicators_match_batch_bit_for_bit() {
+        let mut data = random_walk(5_000, 11);
+        data[3_000] = f64::NAN;
+        for window in [1, 2, 20, 200] {
+            let sma = simple_moving_average(&data, window).unwrap();
+            let ema = exponential_moving_average(&data, window).unwrap();
+            let wilder = wilder_moving_average(&data, window).unwrap();
+            assert_matches_batch(Sma::new(window).unwrap(), window, &data, &sma);
+            assert_matches_batch(Ema::new(window).unwrap(), window, &data, &ema);
+            assert_matches_batch(Ema::wilder(window).unwrap(), window, &data, &wilder);
+        }
+    }
+
+    #[test]
+    fn zero_window_is_rejected() {
+        assert_eq!(Sma::new(0).unwrap_err(), MovingAverageError::WindowZero);
+        assert_eq!(Ema::new(0).unwrap_err(), MovingAverageError::WindowZero);
+    }
+}
@@ -1 +1,3 @@
+pub mod batch;
+pub mod indicators;
 pub mod moving_average;
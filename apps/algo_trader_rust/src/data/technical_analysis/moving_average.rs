@@ -1,40 +1,260 @@
+use serde::{Deserialize, Serialize};
+
+#[derive(Debug, Clone, PartialEq)]
 pub enum MovingAverageError {
     WindowZero,
     WindowExceedsData { window: usize, len: usize },
+    OutputLength { expected: usize, len: usize },
+    SeriesLength { expected: usize, len: usize },
 }
 
-pub fn simple_moving_average(data: &[f64], window: usize) -> Result<Vec<f64>, MovingAverageError> {
+// Number of averages a series of len values yields, one per full window.
+pub fn output_len(len: usize, window: usize) -> Result<usize, MovingAverageError> {
     if window == 0 {
         return Err(MovingAverageError::WindowZero);
     }
-    if window > data.len() {
-        return Err(MovingAverageError::WindowExceedsData { window, len: data.len() });
+    if window > len {
+        return Err(MovingAverageError::WindowExceedsData { window, len });
     }
-    let result = data
-        .windows(window)
-        .map(|w| w.iter().sum::<f64>() / w.len() as f64)
-        .collect();
-    Ok(result)
+    Ok(len - window + 1)
 }
 
-pub fn exponential_moving_average(data: &[f64], window: usize) -> Result<Vec<f64>, MovingAverageError> {
-    if window == 0 {
-        return Err(MovingAverageError::WindowZero);
+pub(crate) fn check_output(expected: usize, len: usize) -> Result<(), MovingAverageError> {
+    if len != expected {
+        return Err(MovingAverageError::OutputLength { expected, len });
+    }
+    Ok(())
+}
+
+// Neumaier-compensated running sum. The rounding error of every addition is
+// carried in `compensation`, so adding and removing values over millions of
+// bars stays as accurate as summing each window from scratch. NaN and
+// infinite values are counted instead of added: while one is in the sum the
+// value is NaN or infinite, as a sum from scratch would be, and once it is
+// removed the sum is finite and exact again.
+#[derive(Debug, Clone, Copy, Default, Serialize, Deserialize)]
+pub struct CompensatedSum {
+    sum: f64,
+    compensation: f64,
+    #[serde(default)]
+    nan: i32,
+    #[serde(default)]
+    pos_inf: i32,
+    #[serde(default)]
+    neg_inf: i32,
+}
+
+impl CompensatedSum {
+    #[inline]
+    pub fn add(&mut self, value: f64) {
+        if value.is_finite() {
+            self.add_finite(value);
+        } else {
+            self.count_non_finite(value, 1);
+        }
+    }
+
+    // Takes out a value added earlier.
+    #[inline]
+    pub fn remove(&mut self, value: f64) {
+        if value.is_finite() {
+            self.add_finite(-value);
+        } else {
+            self.count_non_finite(value, -1);
+        }
+    }
+
+    #[inline]
+    fn add_finite(&mut self, value: f64) {
+        let total = self.sum + value;
+        if self.sum.abs() >= value.abs() {
+            self.compensation += (self.sum - total) + value;
+        } else {
+            self.compensation += (value - total) + self.sum;
+        }
+        self.sum = total;
     }
-    if window > data.len() {
-        return Err(MovingAverageError::WindowExceedsData { window, len: data.len() });
+
+    fn count_non_finite(&mut self, value: f64, delta: i32) {
+        let count = if value.is_nan() {
+            &mut self.nan
+        } else if value > 0.0 {
+            &mut self.pos_inf
+        } else {
+            &mut self.neg_inf
+        };
+        *count += delta;
     }
 
-    let seed = data[..window].iter().sum::<f64>() / window as f64;
-    let multiplier = 2.0 / (window + 1) as f64;
+    #[inline]
+    pub fn value(&self) -> f64 {
+        with_non_finite(self.sum + self.compensation, self.nan, self.pos_inf, self.neg_inf)
+    }
+}
 
-    let mut result = vec![seed];
-    let mut prev_ema = seed;
-    for &value in &data[window..] {
-        let ema = value * multiplier + prev_ema * (1.0 - multiplier);
-        result.push(ema);
-        prev_ema = ema;
+// A finite sum combined with counts of NaN, +inf and -inf values left out of it.
+#[inline(always)]
+pub(crate) fn with_non_finite(total: f64, nan: i32, pos_inf: i32, neg_inf: i32) -> f64 {
+    match (nan > 0, pos_inf > 0, neg_inf > 0) {
+        (false, false, false) => total,
+        (false, true, false) => f64::INFINITY,
+        (false, false, true) => f64::NEG_INFINITY,
+        _ => f64::NAN,
     }
+}
+
+pub fn simple_moving_average(data: &[f64], window: usize) -> Result<Vec<f64>, MovingAverageError> {
+    let mut result = vec![0.0; output_len(data.len(), window)?];
+    simple_moving_average_into(data, window, &mut result)?;
+    Ok(result)
+}
+
+// O(n) rolling SMA written into `out`, which must hold output_len(data.len(), window) values.
+pub fn simple_moving_average_into(data: &[f64], window: usize, out: &mut [f64]) -> Result<(), MovingAverageError> {
+    check_output(output_len(data.len(), window)?, out.len())?;
+
+    let divisor = window as f64;
+    let mut sum = CompensatedSum::default();
+    for &value in &data[..window] {
+        sum.add(value);
+    }
+    out[0] = sum.value() / divisor;
+    for ((slot, &entering), &leaving) in out[1..].iter_mut().zip(&data[window..]).zip(data) {
+        sum.add(entering);
+        sum.remove(leaving);
+        *slot = sum.value() / divisor;
+    }
+    Ok(())
+}
+
+pub fn exponential_moving_average(data: &[f64], window: usize) -> Result<Vec<f64>, MovingAverageError> {
+    let mut result = vec![0.0; output_len(data.len(), window)?];
+    exponential_moving_average_into(data, window, &mut result)?;
     Ok(result)
 }
 
+// EMA seeded with the SMA of the first window, smoothing 2 / (window + 1).
+pub fn exponential_moving_average_into(data: &[f64], window: usize, out: &mut [f64]) -> Result<(), MovingAverageError> {
+    smoothed_average_into(data, window, 2.0 / (window + 1) as f64, out)
+}
+
+pub fn wilder_moving_average(data: &[f64], window: usize) -> Result<Vec<f64>, MovingAverageError> {
+    let mut result = vec![0.0; output_len(data.len(), window)?];
+    wilder_moving_average_into(data, window, &mut result)?;
+    Ok(result)
+}
+
+// Wilder's smoothing (RMA), the EMA variant used by RSI and ATR: smoothing 1 / window.
+pub fn wilder_moving_average_into(data: &[f64], window: usize, out: &mut [f64]) -> Result<(), MovingAverageError> {
+    smoothed_average_into(data, window, 1.0 / window as f64, out)
+}
+
+fn smoothed_average_into(data: &[f64], window: usize, multiplier: f64, out: &mut [f64]) -> Result<(), MovingAverageError> {
+    check_output(output_len(data.len(), window)?, out.len())?;
+
+    let mut seed = CompensatedSum::default();
+    for &value in &data[..window] {
+        seed.add(value);
+    }
+    let mut prev = seed.value() / window as f64;
+    out[0] = prev;
+    for (slot, &value) in out[1..].iter_mut().zip(&data[window..]) {
+        prev = value * multiplier + prev * (1.0 - multiplier);
+        *slot = prev;
+    }
+    Ok(())
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    // Deterministic values in [-0.5, 0.5) (xorshift, no extra crates).
+    fn noise(len: usize, seed: u64) -> Vec<f64> {
+        let mut state = seed.max(1);
+        (0..len)
+            .map(|_| {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                state as f64 / u64::MAX as f64 - 0.5
+            })
+            .collect()
+    }
+
+    fn naive_sums(data: &[f64], window: usize) -> Vec<f64> {
+        data.windows(window).map(|w| w.iter().sum()).collect()
+    }
+
+    #[test]
+    fn rolling_sum_stays_exact_over_long_series() {
+        // Every window sum is exact in f64 but adding 1.0 to 1e16 is not, so
+        // an uncompensated rolling sum drifts and never recovers.
+        let data: Vec<f64> = [1e16, 1.0, -1e16, 1.0].repeat(250_000);
+        let window = 3;
+
+        let sma = simple_moving_average(&data, window).unwrap();
+
+        let exact = data.windows(window).map(|w| {
+            let total: i128 = w.iter().map(|&value| value as i128).sum();
+            total as f64 / window as f64
+        });
+        for (index, (got, want)) in sma.iter().zip(exact).enumerate() {
+            assert_eq!(got.to_bits(), want.to_bits(), "window {index}");
+        }
+    }
+
+    #[test]
+    fn rolling_sma_matches_naive_sum() {
+        let data: Vec<f64> = noise(10_000, 7).iter().map(|step| 100.0 + step).collect();
+        for window in [1, 2, 20, 200, data.len()] {
+            let sma = simple_moving_average(&data, window).unwrap();
+            let naive = naive_sums(&data, window);
+            assert_eq!(sma.len(), naive.len());
+            for (got, sum) in sma.iter().zip(naive) {
+                let want = sum / window as f64;
+                assert!((got - want).abs() <= want.abs() * 1e-12, "window {window}: {got} != {want}");
+            }
+        }
+    }
+
+    #[test]
+    fn non_finite_values_only_affect_their_windows() {
+        let mut data: Vec<f64> = noise(60, 3).iter().map(|step| 100.0 + step).collect();
+        data[10] = f64::NAN;
+        data[25] = f64::INFINITY;
+        data[40] = f64::INFINITY;
+        data[42] = f64::NEG_INFINITY;
+        let window = 5;
+
+        let sma = simple_moving_average(&data, window).unwrap();
+
+        for (index, (got, sum)) in sma.iter().zip(naive_sums(&data, window)).enumerate() {
+            let want = sum / window as f64;
+            if want.is_finite() {
+                assert!((got - want).abs() <= want.abs() * 1e-12, "window {index}: {got} != {want}");
+            } else {
+                assert_eq!(got.is_nan(), want.is_nan(), "window {index}");
+                assert!(got.is_nan() || *got == want, "window {index}: {got} != {want}");
+            }
+        }
+        assert!(sma[10].is_nan() && sma[6].is_nan());
+        assert_eq!(sma[25], f64::INFINITY);
+        assert!(sma[40].is_nan());
+        assert!(sma[11].is_finite() && sma[43].is_finite());
+    }
+
+    #[test]
+    fn removing_every_value_restores_an_empty_sum() {
+        let mut sum = CompensatedSum::default();
+        let values = [1e16, f64::NAN, 1.0, f64::NEG_INFINITY, -3.5];
+        for value in values {
+            sum.add(value);
+        }
+        assert!(sum.value().is_nan());
+        for value in values {
+            sum.remove(value);
+        }
+        assert_eq!(sum.value(), 0.0);
+    }
+}
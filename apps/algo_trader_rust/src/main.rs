@@ -1,13 +1,27 @@
-mod data;
-mod scanner;
-
+use algo_trader_rust::data::bar::TimeAggregation;
+use algo_trader_rust::data::provider::Historical;
+use algo_trader_rust::data::providers::yfinance;
+use algo_trader_rust::scanner;
 use time::macros::datetime;
-use data::providers::yfinance;
-use data::bar::TimeAggregation;
-use data::provider::Historical;
 
 #[tokio::main]
 async fn main() {
+    let args: Vec<String> = std::env::args().skip(1).collect();
+    if args.first().is_some_and(|command| command == "sweep") {
+        if let Err(e) = scanner::sweep::run_cli(&args[1..]) {
+            eprintln!("{e}");
+            std::process::exit(1);
+        }
+        return;
+    }
+    if args.first().is_some_and(|command| command == "scan") {
+        if let Err(e) = scanner::engine::run_cli(&args[1..]).await {
+            eprintln!("{e}");
+            std::process::exit(1);
+        }
+        return;
+    }
+
     let provider = yfinance::Yfinance::new();
     let start = datetime!(2020-1-1 0:00:00.00 UTC);
     let end = datetime!(2020-1-31 23:59:59.99 UTC);
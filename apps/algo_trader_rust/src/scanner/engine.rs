@@ -0,0 +1,327 @@
+use std::fmt::{Debug, Display};
+use std::str::FromStr;
+use std::sync::Arc;
+
+use futures::stream::{self, StreamExt};
+use rayon::prelude::*;
+use serde::Serialize;
+use time::{Duration, OffsetDateTime};
+use tokio::sync::mpsc;
+
+use crate::data::bar::{BarSeries, TimeAggregation};
+use crate::data::provider::Historical;
+use crate::data::providers::yfinance::Yfinance;
+use crate::scanner::scanners::SmaCrossover;
+
+// A condition checked on one symbol's bars (oldest first). Returns a score
+// when the symbol is a hit; higher scores rank first.
+pub trait ScanPredicate: Send + Sync {
+    fn name(&self) -> &str;
+    fn evaluate(&self, bars: &BarSeries) -> Option<f64>;
+}
+
+// Hit when the last bar is an sma_crossover; scored by the SMA spread.
+pub struct SmaCrossoverScan {
+    name: String,
+    short_window: usize,
+    long_window: usize,
+}
+
+impl SmaCrossoverScan {
+    pub fn new(short_window: usize, long_window: usize) -> Self {
+        SmaCrossoverScan { name: format!("sma_crossover_{short_window}_{long_window}"), short_window, long_window }
+    }
+}
+
+impl ScanPredicate for SmaCrossoverScan {
+    fn name(&self) -> &str {
+        &self.name
+    }
+
+    fn evaluate(&self, bars: &BarSeries) -> Option<f64> {
+        let mut crossover = SmaCrossover::new(self.short_window, self.long_window).ok()?;
+        let crossed = bars.close().iter().fold(false, |_, &close| crossover.push(close));
+        if crossed { crossover.spread() } else { None }
+    }
+}
+
+// Hit when the close-to-close return over `lookback` bars is at least `min_return`.
+pub struct MomentumScan {
+    name: String,
+    lookback: usize,
+    min_return: f64,
+}
+
+impl MomentumScan {
+    pub fn new(lookback: usize, min_return: f64) -> Self {
+        MomentumScan { name: format!("momentum_{lookback}"), lookback, min_return }
+    }
+}
+
+impl ScanPredicate for MomentumScan {
+    fn name(&self) -> &str {
+        &self.name
+    }
+
+    fn evaluate(&self, bars: &BarSeries) -> Option<f64> {
+        let closes = bars.close();
+        let last = closes.last()?;
+        let base = closes.len().checked_sub(self.lookback + 1).map(|i| closes[i])?;
+        let change = last / base - 1.0;
+        (change >= self.min_return).then_some(change)
+    }
+}
+
+// One (symbol, predicate) hit, before ranking.
+struct Hit {
+    symbol: String,
+    predicate: usize,
+    score: f64,
+    close: f64,
+}
+
+// Hits as parallel columns, ranked by score (highest first); row i is
+// symbols[i] matching predicates[predicate[i]].
+#[derive(Debug, Clone, Default, PartialEq)]
+pub struct HitList {
+    pub predicates: Vec<String>,
+    pub symbols: Vec<String>,
+    pub predicate: Vec<usize>,
+    pub score: Vec<f64>,
+    pub close: Vec<f64>,
+    pub scanned: usize,
+    pub failed: Vec<String>,
+}
+
+impl HitList {
+    fn ranked(predicates: Vec<String>, mut hits: Vec<Hit>, scanned: usize, failed: Vec<String>) -> Self {
+        hits.sort_by(|a, b| {
+            b.score
+                .total_cmp(&a.score)
+                .then_with(|| a.symbol.cmp(&b.symbol))
+                .then_with(|| a.predicate.cmp(&b.predicate))
+        });
+        let mut list = HitList {
+            predicates,
+            symbols: Vec::with_capacity(hits.len()),
+            predicate: Vec::with_capacity(hits.len()),
+            score: Vec::with_capacity(hits.len()),
+            close: Vec::with_capacity(hits.len()),
+            scanned,
+            failed,
+        };
+        for hit in hits {
+            list.symbols.push(hit.symbol);
+            list.predicate.push(hit.predicate);
+            list.score.push(hit.score);
+            list.close.push(hit.close);
+        }
+        list
+    }
+
+    pub fn len(&self) -> usize {
+        self.symbols.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.symbols.is_empty()
+    }
+
+    // One JSON object per row. serde_json escapes the symbol and predicate
+    // names and writes a NaN or infinite score or close as null.
+    pub fn row_json(&self, row: usize) -> String {
+        let row = HitRow {
+            rank: row + 1,
+            symbol: &self.symbols[row],
+            predicate: &self.predicates[self.predicate[row]],
+            score: self.score[row],
+            close: self.close[row],
+        };
+        serde_json::to_string(&row).expect("hit rows serialize")
+    }
+}
+
+#[derive(Serialize)]
+struct HitRow<'a> {
+    rank: usize,
+    symbol: &'a str,
+    predicate: &'a str,
+    score: f64,
+    close: f64,
+}
+
+fn evaluate_symbol(predicates: &[Box<dyn ScanPredicate>], bars: &BarSeries) -> Vec<Hit> {
+    let Some(&close) = bars.close().last() else { return Vec::new() };
+    predicates
+        .iter()
+        .enumerate()
+        .filter_map(|(predicate, scan)| {
+            let score = scan.evaluate(bars)?;
+            Some(Hit { symbol: bars.ticker().to_string(), predicate, score, close })
+        })
+        .collect()
+}
+
+pub struct Scanner {
+    predicates: Arc<Vec<Box<dyn ScanPredicate>>>,
+    max_in_flight: usize,
+}
+
+impl Scanner {
+    pub fn new(predicates: Vec<Box<dyn ScanPredicate>>) -> Self {
+        Scanner { predicates: Arc::new(predicates), max_in_flight: 8 }
+    }
+
+    // Number of history requests kept in flight by scan_provider.
+    pub fn with_max_in_flight(mut self, max_in_flight: usize) -> Self {
+        self.max_in_flight = max_in_flight.max(1);
+        self
+    }
+
+    fn predicate_names(&self) -> Vec<String> {
+        self.predicates.iter().map(|scan| scan.name().to_string()).collect()
+    }
+
+    // Scans bars already in memory, one symbol per rayon task.
+    pub fn scan(&self, universe: &[BarSeries]) -> HitList {
+        let hits = universe
+            .par_iter()
+            .flat_map_iter(|bars| evaluate_symbol(&self.predicates, bars))
+            .collect();
+        HitList::ranked(self.predicate_names(), hits, universe.len(), Vec::new())
+    }
+
+    // Fetches each symbol's history on the tokio runtime (max_in_flight at a
+    // time) and hands every completed fetch to the rayon pool, so predicates
+    // run on the bars already received while later requests are in flight.
+    // Symbols whose fetch fails are logged and listed in `failed`.
+    pub async fn scan_provider<P>(
+        &self,
+        provider: &P,
+        symbols: &[String],
+        aggregation: TimeAggregation,
+        from: OffsetDateTime,
+        to: OffsetDateTime,
+    ) -> HitList
+    where
+        P: Historical,
+        P::Error: Debug,
+    {
+        let (sender, mut receiver) = mpsc::unbounded_channel();
+        let mut failed = Vec::new();
+        let mut fetches = stream::iter(symbols)
+            .map(|symbol| async move { (symbol, provider.get_ohlcv_series(symbol, aggregation, from, to).await) })
+            .buffer_unordered(self.max_in_flight);
+
+        while let Some((symbol, fetched)) = fetches.next().await {
+            match fetched {
+                Ok(bars) => {
+                    let predicates = Arc::clone(&self.predicates);
+                    let sender = sender.clone();
+                    rayon::spawn(move || {
+                        let _ = sender.send(evaluate_symbol(&predicates, &bars));
+                    });
+                }
+                Err(e) => {
+                    log::warn!("{symbol}: history fetch failed: {e:?}");
+                    failed.push(symbol.clone());
+                }
+            }
+        }
+        drop(sender);
+
+        let mut hits = Vec::new();
+        while let Some(symbol_hits) = receiver.recv().await {
+            hits.extend(symbol_hits);
+        }
+        HitList::ranked(self.predicate_names(), hits, symbols.len() - failed.len(), failed)
+    }
+}
+
+// Scans daily Yahoo bars for the given symbols and prints one JSON line per hit, best first.
+pub async fn run_cli(args: &[String]) -> Result<(), String> {
+    let usage = "usage: scan <symbol>... [--sma short:long] [--momentum lookback:min_return] [--days n] [--in-flight n]";
+    let mut symbols = Vec::new();
+    let mut predicates: Vec<Box<dyn ScanPredicate>> = Vec::new();
+    let mut days = 365;
+    let mut in_flight = 8;
+
+    let mut options = args.iter();
+    while let Some(arg) = options.next() {
+        if !arg.starts_with("--") {
+            symbols.push(arg.clone());
+            continue;
+        }
+        let value = options.next().ok_or(usage)?;
+        match arg.as_str() {
+            "--sma" => {
+                let (short, long) = parse_pair::<usize, usize>(value)?;
+                predicates.push(Box::new(SmaCrossoverScan::new(short, long)));
+            }
+            "--momentum" => {
+                let (lookback, min_return) = parse_pair::<usize, f64>(value)?;
+                predicates.push(Box::new(MomentumScan::new(lookback, min_return)));
+            }
+            "--days" => days = value.parse().map_err(|e| format!("invalid --days: {e}"))?,
+            "--in-flight" => in_flight = value.parse().map_err(|e| format!("invalid --in-flight: {e}"))?,
+            _ => return Err(usage.to_string()),
+        }
+    }
+    if symbols.is_empty() {
+        return Err(usage.to_string());
+    }
+    if predicates.is_empty() {
+        predicates.push(Box::new(SmaCrossoverScan::new(20, 50)));
+    }
+
+    let to = OffsetDateTime::now_utc();
+    let from = to - Duration::days(days);
+    let scanner = Scanner::new(predicates).with_max_in_flight(in_flight);
+    let hits = scanner.scan_provider(&Yfinance::new(), &symbols, TimeAggregation::Day, from, to).await;
+    for row in 0..hits.len() {
+        println!("{}", hits.row_json(row));
+    }
+    if !hits.failed.is_empty() {
+        eprintln!("failed: {}", hits.failed.join(","));
+    }
+    Ok(())
+}
+
+fn parse_pair<A: FromStr, B: FromStr>(spec: &str) -> Result<(A, B), String>
+where
+    A::Err: Display,
+    B::Err: Display,
+{
+    let invalid = |e: &dyn Display| format!("invalid pair '{spec}': {e}");
+    let (first, second) = spec.split_once(':').ok_or_else(|| invalid(&"expected a:b"))?;
+    let first = first.trim().parse::<A>().map_err(|e| invalid(&e))?;
+    let second = second.trim().parse::<B>().map_err(|e| invalid(&e))?;
+    Ok((first, second))
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn row_json_escapes_names_and_nulls_non_finite_numbers() {
+        let hits = HitList {
+            predicates: vec!["momentum \"5d\"".to_string()],
+            symbols: vec!["BRK\\B\n".to_string(), "AAPL".to_string()],
+            predicate: vec![0, 0],
+            score: vec![f64::NAN, 0.25],
+            close: vec![f64::INFINITY, 190.5],
+            ..HitList::default()
+        };
+
+        assert_eq!(
+            hits.row_json(0),
+            r#"{"rank":1,"symbol":"BRK\\B\n","predicate":"momentum \"5d\"","score":null,"close":null}"#
+        );
+        assert_eq!(
+            hits.row_json(1),
+            r#"{"rank":2,"symbol":"AAPL","predicate":"momentum \"5d\"","score":0.25,"close":190.5}"#
+        );
+    }
+}
+
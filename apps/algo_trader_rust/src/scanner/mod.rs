@@ -1 +1,3 @@
+pub mod engine;
 pub mod scanners;
+pub mod sweep;
@@ -1,18 +1,100 @@
-use crate::data::technical_analysis::moving_average::simple_moving_average;
+use serde::{Deserialize, Serialize};
 
-pub fn sma_crossover(data: &[f64], short_window: usize, long_window: usize) -> bool {
-    let Ok(short_ma) = simple_moving_average(data, short_window) else { return false };
-    let Ok(long_ma) = simple_moving_average(data, long_window) else { return false };
+use crate::data::bar::Bar;
+use crate::data::technical_analysis::indicators::{Indicator, Sma};
+use crate::data::technical_analysis::moving_average::MovingAverageError;
+
+// Live form of the sma_crossover rule: push one close per bar and get whether
+// the short SMA crossed above the long SMA on that bar, in O(1) per bar.
+// Serializable so a scanner can checkpoint it with its symbol.
+#[derive(Debug, Clone, Serialize, Deserialize)]
+pub struct SmaCrossover {
+    short: Sma,
+    long: Sma,
+    prev: Option<(f64, f64)>,
+}
+
+impl SmaCrossover {
+    pub fn new(short_window: usize, long_window: usize) -> Result<Self, MovingAverageError> {
+        Ok(SmaCrossover { short: Sma::new(short_window)?, long: Sma::new(long_window)?, prev: None })
+    }
 
-    if short_ma.len() < 2 || long_ma.len() < 2 {
-        return false;
+    pub fn push(&mut self, close: f64) -> bool {
+        let last = match (self.short.push(close), self.long.push(close)) {
+            (Some(short), Some(long)) => Some((short, long)),
+            _ => None,
+        };
+        let crossed = match (self.prev, last) {
+            (Some((short_prev, long_prev)), Some((short_last, long_last))) => {
+                short_prev <= long_prev && short_last > long_last
+            }
+            _ => false,
+        };
+        self.prev = last;
+        crossed
     }
 
-    let short_prev = short_ma[short_ma.len() - 2];
-    let short_last = short_ma[short_ma.len() - 1];
-    let long_prev = long_ma[long_ma.len() - 2];
-    let long_last = long_ma[long_ma.len() - 1];
+    pub fn push_bar(&mut self, bar: &Bar) -> bool {
+        self.push(bar.close)
+    }
+
+    // Relative gap (short - long) / long between the SMAs after the last push.
+    pub fn spread(&self) -> Option<f64> {
+        self.prev.map(|(short, long)| (short - long) / long)
+    }
+}
 
-    short_prev <= long_prev && short_last > long_last
+// Whether the last bar of `data` is a crossover; replays the series through SmaCrossover.
+pub fn sma_crossover(data: &[f64], short_window: usize, long_window: usize) -> bool {
+    let Ok(mut crossover) = SmaCrossover::new(short_window, long_window) else { return false };
+    data.iter().fold(false, |_, &close| crossover.push(close))
 }
 
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::data::technical_analysis::moving_average::simple_moving_average;
+
+    // Oscillating closes so the short SMA crosses the long one many times.
+    fn closes(len: usize) -> Vec<f64> {
+        (0..len).map(|i| 100.0 + (i as f64 * 0.07).sin() * 5.0 + (i % 7) as f64 * 0.01).collect()
+    }
+
+    #[test]
+    fn incremental_crossover_matches_batch_smas() {
+        let data = closes(2_000);
+        let (short_window, long_window) = (5, 20);
+        let short = simple_moving_average(&data, short_window).unwrap();
+        let long = simple_moving_average(&data, long_window).unwrap();
+        let mut crossover = SmaCrossover::new(short_window, long_window).unwrap();
+        let mut crossings = 0;
+
+        for (index, &close) in data.iter().enumerate() {
+            let crossed = crossover.push(close);
+            let Some(out) = index.checked_sub(long_window - 1) else {
+                assert!(!crossed && crossover.spread().is_none(), "bar {index} during warm-up");
+                continue;
+            };
+            let (short_last, long_last) = (short[out + long_window - short_window], long[out]);
+            let want = out > 0 && {
+                let (short_prev, long_prev) = (short[out + long_window - short_window - 1], long[out - 1]);
+                short_prev <= long_prev && short_last > long_last
+            };
+            assert_eq!(crossed, want, "bar {index}");
+            let spread = (short_last - long_last) / long_last;
+            assert_eq!(crossover.spread().map(f64::to_bits), Some(spread.to_bits()), "bar {index}");
+            crossings += crossed as usize;
+        }
+        assert!(crossings > 5, "only {crossings} crossings");
+    }
+
+    #[test]
+    fn sma_crossover_reports_the_last_bar() {
+        let data = closes(2_000);
+        let mut crossover = SmaCrossover::new(5, 20).unwrap();
+        for end in 1..=data.len() {
+            assert_eq!(sma_crossover(&data[..end], 5, 20), crossover.push(data[end - 1]), "bar {end}");
+        }
+        assert!(!sma_crossover(&data, 0, 20));
+    }
+}
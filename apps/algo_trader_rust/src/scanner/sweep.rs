@@ -0,0 +1,212 @@
+use std::fs;
+use std::sync::mpsc::{self, Sender};
+use std::thread;
+
+use serde::Serialize;
+
+use crate::data::technical_analysis::moving_average::simple_moving_average;
+
+#[derive(Debug, Clone, PartialEq)]
+pub struct SweepResult {
+    pub short_window: usize,
+    pub long_window: usize,
+    pub total_return: f64,
+    pub max_drawdown: f64,
+    pub trades: usize,
+}
+
+impl SweepResult {
+    // One JSON object per result; a NaN or infinite return or drawdown (e.g.
+    // from a zero close) is written as null, which json.loads accepts.
+    pub fn to_json(&self) -> String {
+        let row = SweepRow {
+            params: SweepParams { short_window: self.short_window, long_window: self.long_window },
+            total_return: self.total_return,
+            max_drawdown: self.max_drawdown,
+            trades: self.trades,
+        };
+        serde_json::to_string(&row).expect("sweep rows serialize")
+    }
+}
+
+#[derive(Serialize)]
+struct SweepParams {
+    short_window: usize,
+    long_window: usize,
+}
+
+#[derive(Serialize)]
+struct SweepRow {
+    params: SweepParams,
+    total_return: f64,
+    max_drawdown: f64,
+    trades: usize,
+}
+
+// Long-only backtest of the sma_crossover rule. At bar i the rule sees what
+// sma_crossover(&closes[..=i], ..) would, but each SMA is computed once for the
+// whole series. Enters at the close of a crossover bar, exits on the mirrored
+// cross, and compounds close-to-close returns while held.
+pub fn crossover_backtest(closes: &[f64], short_window: usize, long_window: usize) -> SweepResult {
+    let mut result = SweepResult {
+        short_window,
+        long_window,
+        total_return: 0.0,
+        max_drawdown: 0.0,
+        trades: 0,
+    };
+    let Ok(short_ma) = simple_moving_average(closes, short_window) else { return result };
+    let Ok(long_ma) = simple_moving_average(closes, long_window) else { return result };
+
+    let mut equity = 1.0;
+    let mut peak = 1.0;
+    let mut in_position = false;
+
+    // short_ma[k] covers closes[k..k + short_window], so the SMA ending at bar i
+    // is short_ma[i + 1 - short_window]
+    for i in short_window.max(long_window)..closes.len() {
+        if in_position {
+            equity *= closes[i] / closes[i - 1];
+            peak = f64::max(peak, equity);
+            result.max_drawdown = f64::max(result.max_drawdown, 1.0 - equity / peak);
+        }
+
+        let short_prev = short_ma[i - short_window];
+        let short_last = short_ma[i + 1 - short_window];
+        let long_prev = long_ma[i - long_window];
+        let long_last = long_ma[i + 1 - long_window];
+
+        if !in_position && short_prev <= long_prev && short_last > long_last {
+            in_position = true;
+            result.trades += 1;
+        } else if in_position && short_prev >= long_prev && short_last < long_last {
+            in_position = false;
+        }
+    }
+
+    result.total_return = equity - 1.0;
+    result
+}
+
+// Sends each result as soon as it is computed, so callers can stream them.
+pub fn parallel_sweep(closes: &[f64], grid: &[(usize, usize)], threads: usize, results: Sender<SweepResult>) {
+    if grid.is_empty() {
+        return;
+    }
+    let chunk_size = grid.len().div_ceil(threads.max(1));
+    thread::scope(|scope| {
+        for chunk in grid.chunks(chunk_size) {
+            let results = results.clone();
+            scope.spawn(move || {
+                for &(short_window, long_window) in chunk {
+                    if results.send(crossover_backtest(closes, short_window, long_window)).is_err() {
+                        return;
+                    }
+                }
+            });
+        }
+    });
+}
+
+// Parses an inclusive start:end[:step] range or a single value.
+pub fn parse_range(spec: &str) -> Result<Vec<usize>, String> {
+    let parts = spec
+        .split(':')
+        .map(|part| part.trim().parse::<usize>().map_err(|e| format!("invalid range '{spec}': {e}")))
+        .collect::<Result<Vec<_>, _>>()?;
+    match parts[..] {
+        [value] => Ok(vec![value]),
+        [start, end] => Ok((start..=end).collect()),
+        [start, end, step] if step > 0 => Ok((start..=end).step_by(step).collect()),
+        _ => Err(format!("invalid range '{spec}': expected start:end[:step]")),
+    }
+}
+
+pub fn read_closes(path: &str) -> Result<Vec<f64>, String> {
+    let text = fs::read_to_string(path).map_err(|e| format!("cannot read {path}: {e}"))?;
+    let mut lines = text.lines();
+    let header = lines.next().ok_or_else(|| format!("{path} is empty"))?;
+    let column = header
+        .split(',')
+        .position(|name| name.trim().eq_ignore_ascii_case("close"))
+        .ok_or_else(|| format!("{path} has no close column"))?;
+
+    lines
+        .filter(|line| !line.trim().is_empty())
+        .map(|line| {
+            line.split(',')
+                .nth(column)
+                .and_then(|value| value.trim().parse::<f64>().ok())
+                .ok_or_else(|| format!("invalid close in line '{line}'"))
+        })
+        .collect()
+}
+
+// Prints one JSON line per (short, long) pair in completion order.
+pub fn run_cli(args: &[String]) -> Result<(), String> {
+    let usage = "usage: sweep <csv> --short start:end[:step] --long start:end[:step] [--threads n]";
+    let path = args.first().ok_or(usage)?;
+    let mut short = None;
+    let mut long = None;
+    let mut threads = thread::available_parallelism().map_or(1, |n| n.get());
+
+    let mut options = args[1..].iter();
+    while let Some(flag) = options.next() {
+        let value = options.next().ok_or(usage)?;
+        match flag.as_str() {
+            "--short" => short = Some(parse_range(value)?),
+            "--long" => long = Some(parse_range(value)?),
+            "--threads" => threads = value.parse().map_err(|e| format!("invalid --threads: {e}"))?,
+            _ => return Err(usage.to_string()),
+        }
+    }
+    let (Some(short), Some(long)) = (short, long) else { return Err(usage.to_string()) };
+
+    let closes = read_closes(path)?;
+    let grid: Vec<(usize, usize)> = short
+        .iter()
+        .flat_map(|&s| long.iter().filter(move |&&l| s < l).map(move |&l| (s, l)))
+        .collect();
+
+    let (sender, receiver) = mpsc::channel();
+    let worker = thread::spawn(move || parallel_sweep(&closes, &grid, threads, sender));
+    for result in receiver {
+        println!("{}", result.to_json());
+    }
+    worker.join().map_err(|_| "sweep worker panicked".to_string())
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn to_json_nests_params_and_nulls_non_finite_numbers() {
+        let mut result = SweepResult {
+            short_window: 5,
+            long_window: 20,
+            total_return: 0.25,
+            max_drawdown: 0.1,
+            trades: 3,
+        };
+        assert_eq!(
+            result.to_json(),
+            r#"{"params":{"short_window":5,"long_window":20},"total_return":0.25,"max_drawdown":0.1,"trades":3}"#
+        );
+
+        result.total_return = f64::INFINITY;
+        result.max_drawdown = f64::NAN;
+        assert_eq!(
+            result.to_json(),
+            r#"{"params":{"short_window":5,"long_window":20},"total_return":null,"max_drawdown":null,"trades":3}"#
+        );
+    }
+
+    #[test]
+    fn zero_close_result_is_valid_json() {
+        let closes = [1.0, 1.0, 2.0, 3.0, 0.0, 1.0, 2.0];
+        let result = crossover_backtest(&closes, 1, 2);
+        let parsed: serde_json::Value = serde_json::from_str(&result.to_json()).unwrap();
+        assert_eq!(parsed["params"]["short_window"], 1);
+    }
+}
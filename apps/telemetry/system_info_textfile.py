@@ -41,7 +41,8 @@ def _escape_label_value(value: str) -> str:
     )
 
 
-def _format_sample(metric: str, labels: dict[str, str], value: str) -> str:
+def format_sample(metric: str, labels: dict[str, str], value: str) -> str:
+    """Render one Prometheus sample line with escaped label values."""
     label_items = [f'{k}="{_escape_label_value(v)}"' for k, v in labels.items()]
     return f"{metric}{{{','.join(label_items)}}} {value}"
 
@@ -219,18 +220,18 @@ def render(snapshot: Snapshot) -> str:
     lines.append("# TYPE node_textfile_system_cpu_model gauge")
     if snapshot.cpu_model:
         lines.append(
-            _format_sample("node_textfile_system_cpu_model", {"model": snapshot.cpu_model}, "1")
+            format_sample("node_textfile_system_cpu_model", {"model": snapshot.cpu_model}, "1")
         )
 
     lines.append("# HELP node_textfile_system_user Display user for dashboard.")
     lines.append("# TYPE node_textfile_system_user gauge")
-    lines.append(_format_sample("node_textfile_system_user", {"user": snapshot.user}, "1"))
+    lines.append(format_sample("node_textfile_system_user", {"user": snapshot.user}, "1"))
 
     lines.append("# HELP node_textfile_primary_ipv4 Primary IPv4 for default route interface.")
     lines.append("# TYPE node_textfile_primary_ipv4 gauge")
     if snapshot.iface and snapshot.ip:
         lines.append(
-            _format_sample(
+            format_sample(
                 "node_textfile_primary_ipv4",
                 {"device": snapshot.iface, "address": snapshot.ip},
                 "1",
@@ -243,7 +244,7 @@ def render(snapshot: Snapshot) -> str:
     lines.append("# TYPE node_textfile_primary_network_receive_bps gauge")
     if snapshot.iface and snapshot.rx_bps is not None:
         lines.append(
-            _format_sample(
+            format_sample(
                 "node_textfile_primary_network_receive_bps",
                 {"device": snapshot.iface},
                 f"{snapshot.rx_bps:g}",
@@ -256,7 +257,7 @@ def render(snapshot: Snapshot) -> str:
     lines.append("# TYPE node_textfile_primary_network_transmit_bps gauge")
     if snapshot.iface and snapshot.tx_bps is not None:
         lines.append(
-            _format_sample(
+            format_sample(
                 "node_textfile_primary_network_transmit_bps",
                 {"device": snapshot.iface},
                 f"{snapshot.tx_bps:g}",
@@ -270,7 +271,7 @@ def render(snapshot: Snapshot) -> str:
     lines.append("# TYPE node_textfile_primary_network_receive_bytes_total counter")
     if snapshot.iface and snapshot.rx_total is not None:
         lines.append(
-            _format_sample(
+            format_sample(
                 "node_textfile_primary_network_receive_bytes_total",
                 {"device": snapshot.iface},
                 f"{snapshot.rx_total:d}",
@@ -284,7 +285,7 @@ def render(snapshot: Snapshot) -> str:
     lines.append("# TYPE node_textfile_primary_network_transmit_bytes_total counter")
     if snapshot.iface and snapshot.tx_total is not None:
         lines.append(
-            _format_sample(
+            format_sample(
                 "node_textfile_primary_network_transmit_bytes_total",
                 {"device": snapshot.iface},
                 f"{snapshot.tx_total:d}",
@@ -7,7 +7,8 @@ tracking process status, and providing graceful shutdown capabilities.
 from __future__ import annotations
 
 import multiprocessing
-from collections.abc import Callable
+import multiprocessing.pool
+from collections.abc import Callable, Iterator
 from dataclasses import dataclass, field
 from datetime import datetime, timezone
 from typing import Any
@@ -441,6 +442,18 @@ class ProcessManager(Client):
             "total": len(self.processes),
         }
 
+    def _get_pool(self) -> multiprocessing.pool.Pool:
+        """Return the process pool, creating it on first use.
+
+        Returns:
+            Process pool sized to max_processes.
+        """
+        if self.pool is None:
+            max_processes = self.config.max_processes or max(1, multiprocessing.cpu_count() - 2)
+            ctx = multiprocessing.get_context(self.config.start_method)
+            self.pool = ctx.Pool(processes=max_processes)
+        return self.pool
+
     def map(self, func: Callable, iterable, chunksize: int | None = None) -> list:
         """Execute function across iterable using process pool.
 
@@ -452,18 +465,36 @@ class ProcessManager(Client):
         Returns:
             List of results from function execution.
         """
-        max_processes = self.config.max_processes or max(1, multiprocessing.cpu_count() - 2)
-
-        if self.pool is None:
-            ctx = multiprocessing.get_context(self.config.start_method)
-            self.pool = ctx.Pool(processes=max_processes)
+        pool = self._get_pool()
 
         try:
-            return self.pool.map(func, iterable, chunksize=chunksize)
+            return pool.map(func, iterable, chunksize=chunksize)
         except Exception as e:
             self.logger.error(f"Error in process pool map: {e}")
             raise
 
+    def imap_unordered(self, func: Callable, iterable, chunksize: int = 1) -> Iterator[Any]:
+        """Execute function across iterable, yielding results as workers finish.
+
+        Unlike map(), results stream back in completion order, so callers can
+        consume early results while later tasks are still running.
+
+        Args:
+            func: Function to execute.
+            iterable: Iterable of arguments for function.
+            chunksize: Number of items sent to a worker per task.
+
+        Yields:
+            Results from function execution in completion order.
+        """
+        pool = self._get_pool()
+
+        try:
+            yield from pool.imap_unordered(func, iterable, chunksize=chunksize)
+        except Exception as e:
+            self.logger.error(f"Error in process pool imap_unordered: {e}")
+            raise
+
     def close_pool(self):
         """Close the process pool and wait for completion."""
         if self.pool is not None:
@@ -697,6 +697,48 @@ class BaseRedisClient(Client):
             self.logger.error(f"Error releasing lock '{lock_name}': {e}")
             return False
 
+    def publish(self, channel: str, message: str) -> int:
+        """Publish a message on a pub/sub channel.
+
+        Arguments:
+            channel: Channel name (will be namespaced automatically)
+            message: Message to publish
+
+        Returns:
+            Number of subscribers that received the message, 0 on error
+        """
+        try:
+            namespaced_channel = self._build_key(channel)
+            result = self.client.publish(namespaced_channel, message)
+            self.logger.debug(f"PUBLISH {namespaced_channel} -> {result} subscribers")
+            return result
+        except Exception as e:
+            self.logger.error(f"Error publishing to channel '{channel}': {e}")
+            return 0
+
+    def subscribe(self, *channels: str) -> redis.client.PubSub | None:
+        """Open a pub/sub connection subscribed to channels.
+
+        The returned PubSub holds its own connection; read it with
+        get_message(timeout=...) and close it when done. Subscribe
+        confirmations are filtered out.
+
+        Arguments:
+            channels: Channel names (will be namespaced automatically)
+
+        Returns:
+            Subscribed PubSub instance, or None on error
+        """
+        try:
+            namespaced_channels = [self._build_key(channel) for channel in channels]
+            pubsub = self.client.pubsub(ignore_subscribe_messages=True)
+            pubsub.subscribe(*namespaced_channels)
+            self.logger.debug(f"SUBSCRIBE {' '.join(namespaced_channels)}")
+            return pubsub
+        except Exception as e:
+            self.logger.error(f"Error subscribing to channels {channels}: {e}")
+            return None
+
     def pipeline_execute(self, operations: list) -> bool:
         """Execute multiple operations in a pipeline.
 
@@ -421,6 +421,29 @@ class TestProcessManager:
 
         manager.close_pool()
 
+    @pytest.mark.timeout(10)
+    def test_imap_unordered_streams_results(
+        self, process_config, mock_logger, mock_multiprocessing_context, mock_process_pool
+    ):
+        """Test imap_unordered yields results in completion order and reuses the pool."""
+        manager = ProcessManager(config=process_config)
+
+        mock_process_pool.imap_unordered.return_value = iter([9, 1, 4])
+        mock_multiprocessing_context["context"].Pool.return_value = mock_process_pool
+
+        def square(x):
+            return x * x
+
+        results = manager.imap_unordered(square, [1, 2, 3], chunksize=2)
+        assert next(results) == 9
+        assert list(results) == [1, 4]
+        mock_process_pool.imap_unordered.assert_called_once_with(square, [1, 2, 3], chunksize=2)
+
+        manager.map(square, [1])
+        mock_multiprocessing_context["context"].Pool.assert_called_once()
+
+        manager.close_pool()
+
     @pytest.mark.timeout(10)
     def test_close_pool(
         self, process_config, mock_logger, mock_multiprocessing_context, mock_process_pool
@@ -1015,6 +1015,74 @@ class TestRedisClientLockOperations:
         mock_logger.error.assert_called()
 
 
+class TestRedisClientPubSubOperations:
+    """Test pub/sub operations (publish, subscribe)."""
+
+    @pytest.fixture
+    def mock_redis(self):
+        """Fixture to mock Redis connection."""
+        with patch("infrastructure.redis.redis.redis") as mock_redis_module:
+            mock_pool = MagicMock()
+            mock_client = MagicMock()
+
+            mock_redis_module.ConnectionPool.return_value = mock_pool
+            mock_redis_module.Redis.return_value = mock_client
+
+            yield {"module": mock_redis_module, "pool": mock_pool, "client": mock_client}
+
+    @pytest.fixture
+    def mock_logger(self):
+        """Fixture to mock logger."""
+        with patch("infrastructure.redis.redis.get_logger") as mock_get_logger:
+            mock_logger_instance = MagicMock()
+            mock_get_logger.return_value = mock_logger_instance
+            yield mock_logger_instance
+
+    def test_publish_success(self, mock_redis, mock_logger):
+        """Test publishing to a namespaced channel."""
+        mock_redis["client"].publish.return_value = 2
+
+        client = ConcreteRedisClient()
+        result = client.publish("events", "refreshed")
+
+        assert result == 2
+        mock_redis["client"].publish.assert_called_once_with("test_namespace:events", "refreshed")
+
+    def test_publish_exception(self, mock_redis, mock_logger):
+        """Test publish handles exceptions."""
+        mock_redis["client"].publish.side_effect = Exception("Redis error")
+
+        client = ConcreteRedisClient()
+        result = client.publish("events", "refreshed")
+
+        assert result == 0
+        mock_logger.error.assert_called()
+
+    def test_subscribe_success(self, mock_redis, mock_logger):
+        """Test subscribing to namespaced channels."""
+        mock_pubsub = MagicMock()
+        mock_redis["client"].pubsub.return_value = mock_pubsub
+
+        client = ConcreteRedisClient()
+        result = client.subscribe("events", "other")
+
+        assert result is mock_pubsub
+        mock_redis["client"].pubsub.assert_called_once_with(ignore_subscribe_messages=True)
+        mock_pubsub.subscribe.assert_called_once_with(
+            "test_namespace:events", "test_namespace:other"
+        )
+
+    def test_subscribe_exception(self, mock_redis, mock_logger):
+        """Test subscribe handles exceptions."""
+        mock_redis["client"].pubsub.side_effect = Exception("Redis error")
+
+        client = ConcreteRedisClient()
+        result = client.subscribe("events")
+
+        assert result is None
+        mock_logger.error.assert_called()
+
+
 class TestRedisClientIntegration:
     """Test integration scenarios with multiple operations."""
 
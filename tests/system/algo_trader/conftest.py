@@ -10,6 +10,7 @@ from uuid import uuid4
 import pandas as pd
 import pytest
 
+from system.algo_trader.domain.async_engine import AsyncEngine
 from system.algo_trader.domain.engine import Engine
 from system.algo_trader.domain.models import (
     Account,
@@ -19,11 +20,13 @@ from system.algo_trader.domain.models import (
     JournalInput,
     JournalOutput,
     MarketOrder,
+    OrderEvent,
     Orders,
     PortfolioManager,
     Position,
     Positions,
     Quote,
+    StageLatency,
 )
 from system.algo_trader.domain.ports.account_port import AccountPort
 from system.algo_trader.domain.ports.controller_port import ControllerPort
@@ -125,6 +128,7 @@ class FakeOrderPort(OrderPort):
         """Initialize fake order port with empty order lists."""
         self.sent_orders: list[Orders] = []
         self.open_orders = Orders(timestamp=datetime.now(timezone.utc), orders=[])
+        self.order_events: list[OrderEvent] = []
 
     def send_orders(self, orders: Orders) -> Orders:
         """Record and return orders."""
@@ -147,6 +151,11 @@ class FakeOrderPort(OrderPort):
         """Return empty orders collection."""
         return Orders(timestamp=datetime.now(timezone.utc), orders=[])
 
+    def get_order_events(self) -> list[OrderEvent]:
+        """Return and clear queued order events."""
+        events, self.order_events = self.order_events, []
+        return events
+
 
 class FakeStrategyPort(StrategyPort):
     """Simple fake strategy port."""
@@ -228,8 +237,9 @@ class FakeControllerPort(ControllerPort):
     """Simple fake controller port."""
 
     def __init__(self):
-        """Initialize fake controller port with empty status list."""
+        """Initialize fake controller port with empty status and latency lists."""
         self.published_statuses: list[EngineState] = []
+        self.published_latency: list[list[StageLatency]] = []
 
     def wait_for_command(self, timeout_s: float | None) -> ControllerCommand | None:
         """Return None (no commands for testing)."""
@@ -239,6 +249,10 @@ class FakeControllerPort(ControllerPort):
         """Record published status."""
         self.published_statuses.append(status)
 
+    def publish_latency(self, latency: list[StageLatency]) -> None:
+        """Record published latency summary."""
+        self.published_latency.append(latency)
+
 
 class FakeEventPort(EventPort):
     """Simple fake event port that returns scripted events."""
@@ -338,6 +352,32 @@ def engine_with_fakes(
     )
 
 
+@pytest.fixture
+def async_engine_with_fakes(
+    fake_historical_port,
+    fake_quote_port,
+    fake_account_port,
+    fake_order_port,
+    fake_strategy_port,
+    fake_portfolio_manager_port,
+    fake_journal_port,
+    fake_controller_port,
+    fake_event_port,
+):
+    """Provide an AsyncEngine instance wrapping all fake ports via adapters."""
+    return AsyncEngine.from_sync_ports(
+        historical_port=fake_historical_port,
+        quote_port=fake_quote_port,
+        account_port=fake_account_port,
+        order_port=fake_order_port,
+        strategy_port=fake_strategy_port,
+        portfolio_manager_port=fake_portfolio_manager_port,
+        journal_port=fake_journal_port,
+        controller_port=fake_controller_port,
+        event_port=fake_event_port,
+    )
+
+
 # Test data factories
 @pytest.fixture
 def sample_market_order():
@@ -0,0 +1,263 @@
+"""Tests for AsyncEngine - Asyncio tick workflow and command handling.
+
+Tests cover the asyncio tick workflow over the synchronous fakes (through the
+thread adapters) and verify that commands are handled while a tick is blocked
+on a slow port.
+"""
+
+import asyncio
+import threading
+import time
+from datetime import datetime, timezone
+
+import pytest
+
+from system.algo_trader.domain.async_engine import AsyncEngine
+from system.algo_trader.domain.models import Event, Orders
+from system.algo_trader.domain.ports.async_adapters import AsyncOrderPortAdapter
+from system.algo_trader.domain.states import (
+    ControllerCommand,
+    EngineState,
+    EventType,
+    OrderInstruction,
+    TickReason,
+    TradingState,
+)
+
+
+def _command(command: ControllerCommand) -> Event:
+    return Event(timestamp=datetime.now(timezone.utc), type=EventType.COMMAND, command=command)
+
+
+def _tick() -> Event:
+    return Event(
+        timestamp=datetime.now(timezone.utc), type=EventType.TICK, reason=TickReason.SCHEDULED
+    )
+
+
+class TestAsyncEngineTick:
+    """Test the asyncio tick workflow through sync port adapters."""
+
+    @pytest.mark.integration
+    def test_tick_normal_workflow(
+        self,
+        async_engine_with_fakes,
+        fake_strategy_port,
+        fake_order_port,
+        fake_journal_port,
+        sample_market_order,
+    ):
+        """Test normal tick workflow: data fetch -> signals -> orders."""
+        fake_strategy_port.signals = Orders(
+            timestamp=sample_market_order().timestamp,
+            orders=[sample_market_order(instruction=OrderInstruction.BUY_TO_OPEN)],
+        )
+
+        asyncio.run(async_engine_with_fakes._tick())
+
+        assert len(fake_journal_port.inputs) == 1
+        assert len(fake_journal_port.inputs[0].port_latency_ms) == 6
+        assert len(fake_order_port.sent_orders) == 1
+        assert len(fake_journal_port.outputs) == 1
+        assert len(fake_journal_port.outputs[0].orders.orders) == 1
+
+    @pytest.mark.integration
+    def test_tick_flatten_workflow(
+        self,
+        async_engine_with_fakes,
+        fake_account_port,
+        fake_portfolio_manager_port,
+        fake_order_port,
+        fake_journal_port,
+        sample_position,
+    ):
+        """Test flatten workflow sends close orders and skips the strategy."""
+        fake_account_port.positions.positions = [sample_position(symbol="AAPL", quantity=10)]
+        fake_portfolio_manager_port.state.trading_state = TradingState.FLATTEN
+
+        asyncio.run(async_engine_with_fakes._tick())
+
+        assert len(fake_order_port.sent_orders) == 1
+        sent = fake_order_port.sent_orders[0].orders
+        assert sent[0].order_instruction == OrderInstruction.SELL_TO_CLOSE
+        assert len(fake_journal_port.inputs) == 0
+
+
+class TestAsyncEngineRun:
+    """Test AsyncEngine.run() event handling."""
+
+    @pytest.mark.e2e
+    @pytest.mark.timeout(10)
+    def test_start_tick_stop_workflow(
+        self,
+        async_engine_with_fakes,
+        fake_event_port,
+        fake_controller_port,
+        fake_journal_port,
+    ):
+        """Test START -> TICK -> STOP runs the tick to completion before stopping."""
+        fake_event_port.events = [
+            _command(ControllerCommand.START),
+            _tick(),
+            _command(ControllerCommand.STOP),
+        ]
+
+        asyncio.run(async_engine_with_fakes.run())
+
+        assert fake_controller_port.published_statuses == [
+            EngineState.SETUP,
+            EngineState.RUNNING,
+            EngineState.STOPPED,
+        ]
+        assert len(fake_journal_port.inputs) == 1
+        assert len(fake_journal_port.outputs) == 1
+
+    @pytest.mark.e2e
+    @pytest.mark.timeout(10)
+    def test_emergency_stop_cancels_blocked_tick(
+        self,
+        async_engine_with_fakes,
+        fake_event_port,
+        fake_quote_port,
+        fake_controller_port,
+        fake_order_port,
+    ):
+        """Test EMERGENCY_STOP is handled while a tick is stuck on a slow port."""
+        release = threading.Event()
+        original_get_quotes = fake_quote_port.get_quotes
+
+        def blocked_get_quotes():
+            release.wait(timeout=5)
+            return original_get_quotes()
+
+        fake_quote_port.get_quotes = blocked_get_quotes
+        fake_event_port.events = [
+            _command(ControllerCommand.START),
+            _tick(),
+            _command(ControllerCommand.EMERGENCY_STOP),
+        ]
+
+        async def run_and_time() -> float:
+            start = time.perf_counter()
+            await async_engine_with_fakes.run()
+            elapsed = time.perf_counter() - start
+            release.set()
+            return elapsed
+
+        elapsed = asyncio.run(run_and_time())
+
+        assert elapsed < 1.0
+        assert fake_controller_port.published_statuses[-1] == EngineState.STOPPED
+        assert len(fake_order_port.sent_orders) == 0
+
+    @pytest.mark.e2e
+    @pytest.mark.timeout(10)
+    def test_tick_error_sets_error_state(
+        self,
+        async_engine_with_fakes,
+        fake_event_port,
+        fake_strategy_port,
+        fake_controller_port,
+        fake_journal_port,
+    ):
+        """Test a failing tick moves the engine to ERROR and journals the error."""
+
+        def failing_get_signals(*args):
+            raise RuntimeError("Test error")
+
+        fake_strategy_port.get_signals = failing_get_signals
+        fake_event_port.events = [_command(ControllerCommand.START), _tick()]
+
+        asyncio.run(asyncio.wait_for(async_engine_with_fakes.run(), timeout=5))
+
+        assert fake_controller_port.published_statuses[-1] == EngineState.ERROR
+        assert len(fake_journal_port.errors) == 1
+        assert str(fake_journal_port.errors[0].error) == "Test error"
+
+    @pytest.mark.e2e
+    @pytest.mark.timeout(10)
+    def test_tick_error_returns_with_blocking_event_port(
+        self,
+        fake_historical_port,
+        fake_quote_port,
+        fake_account_port,
+        fake_order_port,
+        fake_strategy_port,
+        fake_portfolio_manager_port,
+        fake_journal_port,
+        fake_controller_port,
+    ):
+        """Test run() returns on ERROR while a worker thread waits on the event port."""
+
+        class BlockingEventPort:
+            """Event port that blocks for the full timeout once scripted events run out."""
+
+            def __init__(self, events: list[Event]):
+                self.events = events
+
+            def wait_for_event(self, timeout_s: float | None) -> Event | None:
+                if self.events:
+                    return self.events.pop(0)
+                threading.Event().wait(timeout_s)
+                return None
+
+        def failing_get_signals(*args):
+            raise RuntimeError("Test error")
+
+        fake_strategy_port.get_signals = failing_get_signals
+        engine = AsyncEngine.from_sync_ports(
+            historical_port=fake_historical_port,
+            quote_port=fake_quote_port,
+            account_port=fake_account_port,
+            order_port=fake_order_port,
+            strategy_port=fake_strategy_port,
+            portfolio_manager_port=fake_portfolio_manager_port,
+            journal_port=fake_journal_port,
+            controller_port=fake_controller_port,
+            event_port=BlockingEventPort([_command(ControllerCommand.START), _tick()]),
+            event_poll_s=0.05,
+        )
+
+        start = time.perf_counter()
+        asyncio.run(engine.run())
+
+        assert time.perf_counter() - start < 2.0
+        assert fake_controller_port.published_statuses[-1] == EngineState.ERROR
+
+
+class TestAsyncEngineHalt:
+    """Test that no orders are dispatched once EMERGENCY_STOP is received."""
+
+    @pytest.mark.unit
+    def test_halted_engine_drops_orders_before_dispatch(
+        self,
+        async_engine_with_fakes,
+        fake_strategy_port,
+        fake_order_port,
+        sample_market_order,
+    ):
+        """Test a tick reaching the send stage after the halt flag is set sends nothing."""
+        fake_strategy_port.signals = Orders(
+            timestamp=datetime.now(timezone.utc),
+            orders=[sample_market_order(instruction=OrderInstruction.BUY_TO_OPEN)],
+        )
+        async_engine_with_fakes._halt.set()
+
+        with pytest.raises(asyncio.CancelledError):
+            asyncio.run(async_engine_with_fakes._tick())
+
+        assert fake_order_port.sent_orders == []
+
+    @pytest.mark.unit
+    def test_adapter_skips_queued_send_after_halt(self, fake_order_port, sample_market_order):
+        """Test the thread adapter re-checks the halt flag inside the worker thread."""
+        halt = threading.Event()
+        adapter = AsyncOrderPortAdapter(fake_order_port, halt=halt)
+        orders = Orders(timestamp=datetime.now(timezone.utc), orders=[sample_market_order()])
+
+        assert asyncio.run(adapter.send_orders(orders)).orders == orders.orders
+        halt.set()
+        accepted = asyncio.run(adapter.send_orders(orders))
+
+        assert accepted.orders == []
+        assert len(fake_order_port.sent_orders) == 1
@@ -4,6 +4,8 @@ Tests cover complete _tick() workflow with fake adapters,
 verifying port interactions and journaling.
 """
 
+import time
+
 import pytest
 
 from system.algo_trader.domain.models import Orders, Positions
@@ -140,3 +142,90 @@ class TestEngineTickWorkflow:
         )
         assert len(filtered_signals.orders) == 1
         assert filtered_signals.orders[0].order_instruction == OrderInstruction.BUY_TO_OPEN
+
+
+class TestEngineConcurrentFetch:
+    """Test concurrent data fan-out and per-port latency journaling."""
+
+    @pytest.fixture
+    def concurrent_engine(self, engine_with_fakes):
+        """Provide the fake-backed engine with concurrent fetch enabled."""
+        engine_with_fakes.concurrent_fetch = True
+        yield engine_with_fakes
+        engine_with_fakes._shutdown_fetch_executor()
+
+    @pytest.mark.integration
+    def test_tick_records_port_latency_sequential(self, engine_with_fakes):
+        """Test sequential tick journals a latency for every port read."""
+        engine_with_fakes._tick()
+
+        latencies = engine_with_fakes.journal_port.inputs[0].port_latency_ms
+        assert set(latencies) == {
+            "historical",
+            "quotes",
+            "account",
+            "open_orders",
+            "portfolio_manager",
+            "positions",
+        }
+        assert all(latency >= 0.0 for latency in latencies.values())
+
+    @pytest.mark.integration
+    def test_concurrent_tick_matches_sequential_inputs(self, concurrent_engine):
+        """Test concurrent fetch journals the same data the ports return."""
+        concurrent_engine._tick()
+
+        journal_input = concurrent_engine.journal_port.inputs[0]
+        assert journal_input.historical_data is concurrent_engine.historical_port.data
+        assert journal_input.quote_data is concurrent_engine.quote_port.quote
+        assert journal_input.account_data is concurrent_engine.account_port.account
+        assert journal_input.open_orders is concurrent_engine.order_port.open_orders
+        assert len(journal_input.port_latency_ms) == 6
+        assert len(concurrent_engine.journal_port.outputs) == 1
+
+    @pytest.mark.integration
+    def test_concurrent_fetch_overlaps_slow_ports(self, concurrent_engine):
+        """Test slow port reads run in parallel rather than back to back."""
+        delay_s = 0.1
+        quote_port = concurrent_engine.quote_port
+        account_port = concurrent_engine.account_port
+        original_quotes = quote_port.get_quotes
+        original_account = account_port.get_account
+
+        def slow_quotes():
+            time.sleep(delay_s)
+            return original_quotes()
+
+        def slow_account():
+            time.sleep(delay_s)
+            return original_account()
+
+        quote_port.get_quotes = slow_quotes
+        account_port.get_account = slow_account
+
+        start = time.perf_counter()
+        concurrent_engine._tick()
+        elapsed = time.perf_counter() - start
+
+        assert elapsed < 2 * delay_s
+        latencies = concurrent_engine.journal_port.inputs[0].port_latency_ms
+        assert latencies["quotes"] >= delay_s * 1000.0 * 0.9
+        assert latencies["account"] >= delay_s * 1000.0 * 0.9
+
+    @pytest.mark.integration
+    def test_concurrent_fetch_port_timeout(self, concurrent_engine):
+        """Test a port exceeding its timeout aborts the tick before strategy evaluation."""
+        concurrent_engine.fetch_timeout_s = {"quotes": 0.05}
+        original_quotes = concurrent_engine.quote_port.get_quotes
+
+        def slow_quotes():
+            time.sleep(0.5)
+            return original_quotes()
+
+        concurrent_engine.quote_port.get_quotes = slow_quotes
+
+        with pytest.raises(TimeoutError, match="quotes"):
+            concurrent_engine._tick()
+
+        assert len(concurrent_engine.journal_port.inputs) == 0
+        assert len(concurrent_engine.order_port.sent_orders) == 0
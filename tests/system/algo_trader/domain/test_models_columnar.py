@@ -0,0 +1,233 @@
+"""Unit tests for columnar market-data models - QuoteBatch, OHLCVPanel and OptionChain.
+
+Tests cover conversion to and from the dict-per-field Quote and per-symbol
+HistoricalOHLCV models, zero-copy per-symbol views, option chain filtering,
+and shape validation.
+"""
+
+from datetime import date, datetime, timezone
+
+import numpy as np
+import pandas as pd
+import pytest
+
+from system.algo_trader.domain.models import (
+    OPTION_FIELDS,
+    QUOTE_FIELDS,
+    HistoricalOHLCV,
+    OHLCVPanel,
+    OptionChain,
+    Quote,
+    QuoteBatch,
+)
+
+
+@pytest.fixture
+def sample_quote():
+    """Provide a two-symbol quote with one missing field."""
+    return Quote(
+        timestamp=datetime.now(timezone.utc),
+        asset_class="EQUITY",
+        bid={"AAPL": 100.0, "MSFT": 300.0},
+        ask={"AAPL": 100.5, "MSFT": 300.5},
+        bid_size={"AAPL": 100.0, "MSFT": 200.0},
+        ask_size={"AAPL": 100.0, "MSFT": 200.0},
+        last={"AAPL": 100.25, "MSFT": 300.25},
+        volume={"AAPL": 1000000.0, "MSFT": 500000.0},
+        change={"AAPL": 0.5},
+        change_pct={"AAPL": 0.5},
+    )
+
+
+@pytest.fixture
+def sample_historical():
+    """Provide historical data with different lengths per symbol."""
+    index_a = pd.date_range("2024-01-01", periods=3, freq="D")
+    index_b = pd.date_range("2024-01-01", periods=2, freq="D")
+    return HistoricalOHLCV(
+        period="1Y",
+        frequency="1D",
+        start=datetime(2024, 1, 1, tzinfo=timezone.utc),
+        end=datetime(2024, 1, 3, tzinfo=timezone.utc),
+        data={
+            "AAPL": pd.DataFrame(
+                {
+                    "open": [1.0, 2.0, 3.0],
+                    "high": [1.5, 2.5, 3.5],
+                    "low": [0.5, 1.5, 2.5],
+                    "close": [1.2, 2.2, 3.2],
+                    "volume": [10.0, 20.0, 30.0],
+                },
+                index=index_a,
+            ),
+            "MSFT": pd.DataFrame({"close": [5.0, 6.0]}, index=index_b),
+        },
+    )
+
+
+class TestQuoteBatch:
+    """Test QuoteBatch layout and conversion."""
+
+    @pytest.mark.unit
+    def test_from_quote_builds_field_major_matrix(self, sample_quote):
+        """Test values are laid out one contiguous row per field."""
+        batch = QuoteBatch.from_quote(sample_quote)
+
+        assert batch.symbols == ("AAPL", "MSFT")
+        assert batch.values.shape == (len(QUOTE_FIELDS), 2)
+        assert batch.bid.flags["C_CONTIGUOUS"]
+        np.testing.assert_array_equal(batch.last, [100.25, 300.25])
+        assert np.isnan(batch.change[batch.index_of("MSFT")])
+
+    @pytest.mark.unit
+    def test_views_share_memory(self, sample_quote):
+        """Test field and symbol accessors return views, not copies."""
+        batch = QuoteBatch.from_quote(sample_quote)
+
+        assert np.shares_memory(batch.field_view("ask"), batch.values)
+        view = batch.symbol_view("MSFT")
+        assert np.shares_memory(view, batch.values)
+        assert view[QUOTE_FIELDS.index("bid")] == 300.0
+
+    @pytest.mark.unit
+    def test_round_trip_omits_missing(self, sample_quote):
+        """Test QuoteBatch -> Quote reproduces the original maps."""
+        quote = QuoteBatch.from_quote(sample_quote).to_quote()
+
+        assert quote.bid == sample_quote.bid
+        assert quote.change == {"AAPL": 0.5}
+        assert quote.asset_class == "EQUITY"
+
+    @pytest.mark.unit
+    def test_rejects_mismatched_shape(self):
+        """Test construction fails when values do not match the symbol index."""
+        with pytest.raises(ValueError):
+            QuoteBatch(
+                timestamp=datetime.now(timezone.utc),
+                asset_class="EQUITY",
+                symbols=("AAPL",),
+                values=np.zeros((len(QUOTE_FIELDS), 2)),
+            )
+
+
+class TestOHLCVPanel:
+    """Test OHLCVPanel layout and conversion."""
+
+    @pytest.mark.unit
+    def test_from_historical_concatenates_symbols(self, sample_historical):
+        """Test bars are concatenated with per-symbol offsets."""
+        panel = OHLCVPanel.from_historical(sample_historical)
+
+        assert panel.symbols == ("AAPL", "MSFT")
+        np.testing.assert_array_equal(panel.offsets, [0, 3, 5])
+        assert list(panel.columns) == ["open", "high", "low", "close", "volume"]
+        np.testing.assert_array_equal(panel.columns["close"], [1.2, 2.2, 3.2, 5.0, 6.0])
+        assert np.isnan(panel.column("MSFT", "open")).all()
+
+    @pytest.mark.unit
+    def test_symbol_views_are_zero_copy(self, sample_historical):
+        """Test per-symbol column access slices the shared arrays."""
+        panel = OHLCVPanel.from_historical(sample_historical)
+
+        close = panel.column("AAPL", "close")
+        assert np.shares_memory(close, panel.columns["close"])
+        assert close.flags["C_CONTIGUOUS"]
+        view = panel.symbol_view("MSFT")
+        np.testing.assert_array_equal(view["close"], [5.0, 6.0])
+        assert len(panel.symbol_index("MSFT")) == 2
+
+    @pytest.mark.unit
+    def test_round_trip(self, sample_historical):
+        """Test OHLCVPanel -> HistoricalOHLCV reproduces the original bars."""
+        historical = OHLCVPanel.from_historical(sample_historical).to_historical()
+
+        original = sample_historical.data["AAPL"]
+        restored = historical.data["AAPL"]
+        pd.testing.assert_frame_equal(restored, original, check_freq=False)
+        np.testing.assert_array_equal(historical.data["MSFT"]["close"].to_numpy(), [5.0, 6.0])
+        assert historical.period == "1Y"
+
+    @pytest.mark.unit
+    def test_empty_historical(self):
+        """Test an empty historical window converts to an empty panel."""
+        now = datetime.now(timezone.utc)
+        panel = OHLCVPanel.from_historical(
+            HistoricalOHLCV(period="1Y", frequency="1D", start=now, end=now, data={})
+        )
+
+        assert len(panel) == 0
+        np.testing.assert_array_equal(panel.offsets, [0])
+
+
+@pytest.fixture
+def sample_chain():
+    """Provide a four-contract chain over two expiries and two strikes."""
+    values = np.zeros((len(OPTION_FIELDS), 4))
+    values[OPTION_FIELDS.index("strike")] = [100.0, 110.0, 100.0, 110.0]
+    values[OPTION_FIELDS.index("open_interest")] = [10.0, 20.0, 30.0, 40.0]
+    return OptionChain(
+        underlying="AAPL",
+        timestamp=datetime.now(timezone.utc),
+        underlying_price=105.0,
+        symbols=["C100A", "C110A", "P100B", "P110B"],
+        expiries=["2024-01-19", "2024-01-19", "2024-02-16", "2024-02-16"],
+        is_call=[True, True, False, False],
+        values=values,
+    )
+
+
+class TestOptionChain:
+    """Test OptionChain."""
+
+    @pytest.mark.unit
+    def test_arrays_are_normalized(self, sample_chain):
+        """Test columns are typed arrays and fields are rows of the value matrix."""
+        assert sample_chain.expiries.dtype == np.dtype("datetime64[D]")
+        assert sample_chain.is_call.dtype == np.bool_
+        assert np.shares_memory(sample_chain.strike, sample_chain.values)
+        assert sample_chain.open_interest.tolist() == [10.0, 20.0, 30.0, 40.0]
+        assert sample_chain.expirations().tolist() == [date(2024, 1, 19), date(2024, 2, 16)]
+        assert sample_chain.nbytes >= sample_chain.values.nbytes
+
+    @pytest.mark.unit
+    def test_filter_by_expiry_strike_and_side(self, sample_chain):
+        """Test filters combine and bounds are inclusive."""
+        by_expiry = sample_chain.filter(expiry_from=date(2024, 2, 1))
+        by_strike = sample_chain.filter(strike_min=105.0, strike_max=110.0)
+        calls = sample_chain.filter(expiry_to=date(2024, 1, 19), contract_type="CALL")
+
+        assert by_expiry.symbols.tolist() == ["P100B", "P110B"]
+        assert by_strike.symbols.tolist() == ["C110A", "P110B"]
+        assert by_strike.open_interest.tolist() == [20.0, 40.0]
+        assert calls.symbols.tolist() == ["C100A", "C110A"]
+        assert len(sample_chain.filter(contract_type="PUT", strike_max=100.0)) == 1
+        assert len(sample_chain.filter()) == 4
+
+    @pytest.mark.unit
+    def test_read_only_shares_arrays_without_write_access(self, sample_chain):
+        """Test read_only() views the same memory and rejects assignment."""
+        view = sample_chain.read_only()
+
+        assert view is not sample_chain
+        assert np.shares_memory(view.values, sample_chain.values)
+        assert not view.values.flags.writeable
+        with pytest.raises(ValueError):
+            view.strike[0] = 0.0
+        with pytest.raises(ValueError):
+            view.is_call[0] = False
+        assert sample_chain.values.flags.writeable
+        assert view.filter(strike_min=105.0).values.flags.writeable
+
+    @pytest.mark.unit
+    def test_rejects_mismatched_lengths(self):
+        """Test construction fails when the columns do not align."""
+        with pytest.raises(ValueError):
+            OptionChain(
+                underlying="AAPL",
+                timestamp=datetime.now(timezone.utc),
+                underlying_price=105.0,
+                symbols=["C100A"],
+                expiries=["2024-01-19", "2024-01-19"],
+                is_call=[True],
+                values=np.zeros((len(OPTION_FIELDS), 1)),
+            )
@@ -0,0 +1,174 @@
+"""Unit tests for the tick latency profiler.
+
+Tests cover LatencyHistogram accuracy, percentiles, merging and clamping,
+StageProfiler laps, and Engine/AsyncEngine stage recording and latency
+publishing through the controller port.
+"""
+
+import asyncio
+import math
+import random
+
+import pytest
+
+from system.algo_trader.domain.models import Positions
+from system.algo_trader.domain.profiler import (
+    TICK,
+    TICK_STAGES,
+    LatencyHistogram,
+    StageProfiler,
+)
+from system.algo_trader.domain.states import TradingState
+
+
+class TestLatencyHistogram:
+    """Test HDR-style histogram recording and queries."""
+
+    @pytest.mark.unit
+    def test_percentiles_within_relative_error(self):
+        """Test percentiles stay within the sub-bucket precision of exact values."""
+        rng = random.Random(7)
+        values = sorted(rng.randint(1_000, 5_000_000_000) for _ in range(5_000))
+        histogram = LatencyHistogram(sub_bucket_bits=7)
+
+        for value in values:
+            histogram.record(value)
+
+        for percentile in (50.0, 90.0, 99.0, 99.9):
+            exact = values[math.ceil(len(values) * percentile / 100) - 1]
+            assert abs(histogram.percentile(percentile) - exact) <= exact * 2**-6
+
+    @pytest.mark.unit
+    def test_small_values_are_exact(self):
+        """Test values below the sub-bucket count are recorded exactly."""
+        histogram = LatencyHistogram(sub_bucket_bits=7)
+
+        for value in range(1, 101):
+            histogram.record(value)
+
+        assert histogram.percentile(50.0) == 50
+        assert histogram.percentile(100.0) == 100
+        assert histogram.min_ns == 1
+        assert histogram.total_ns == 5050
+
+    @pytest.mark.unit
+    def test_clamps_out_of_range_values(self):
+        """Test negative values count as zero and large values clamp to max_ns."""
+        histogram = LatencyHistogram(max_ns=1_000_000)
+
+        histogram.record(-5)
+        histogram.record(10**12)
+
+        assert histogram.count == 2
+        assert histogram.min_ns == 0
+        assert histogram.max_recorded_ns == 1_000_000
+        assert histogram.percentile(100.0) == 1_000_000
+
+    @pytest.mark.unit
+    def test_merge_and_reset(self):
+        """Test merge adds counts and reset empties the histogram."""
+        first, second = LatencyHistogram(), LatencyHistogram()
+        first.record(1_000)
+        second.record(3_000_000)
+
+        first.merge(second)
+
+        assert first.count == 2
+        assert first.max_recorded_ns == 3_000_000
+        with pytest.raises(ValueError, match="different layouts"):
+            first.merge(LatencyHistogram(sub_bucket_bits=5))
+        first.reset()
+        assert (first.count, first.percentile(99.0)) == (0, 0)
+
+    @pytest.mark.unit
+    def test_summary_in_milliseconds(self):
+        """Test summary reports milliseconds and mean."""
+        histogram = LatencyHistogram()
+        histogram.record(2_000_000)
+        histogram.record(4_000_000)
+
+        summary = histogram.summary("strategy")
+
+        assert summary.stage == "strategy"
+        assert summary.count == 2
+        assert summary.mean_ms == pytest.approx(3.0)
+        assert summary.max_ms == pytest.approx(4.0)
+        assert summary.p50_ms == pytest.approx(2.0, rel=2**-6)
+
+    @pytest.mark.unit
+    def test_rejects_bad_layout(self):
+        """Test precision below 2 bits is rejected."""
+        with pytest.raises(ValueError, match="sub_bucket_bits"):
+            LatencyHistogram(sub_bucket_bits=1)
+
+
+class TestStageProfiler:
+    """Test lap recording."""
+
+    @pytest.mark.unit
+    def test_lap_records_marked_stages_and_tick(self):
+        """Test each mark records one stage and finish records the tick."""
+        profiler = StageProfiler(stages=("a", "b"))
+
+        lap = profiler.start()
+        lap.mark("a")
+        lap.mark("b")
+        lap.finish()
+
+        snapshot = profiler.snapshot()
+        assert [s.stage for s in snapshot] == ["a", "b", TICK]
+        assert [s.count for s in snapshot] == [1, 1, 1]
+        assert profiler.ticks == 1
+        profiler.reset()
+        assert profiler.ticks == 0
+
+
+class TestEngineProfiling:
+    """Test Engine stage instrumentation."""
+
+    @pytest.mark.unit
+    def test_tick_records_every_stage(self, engine_with_fakes):
+        """Test a normal tick records every stage once."""
+        engine_with_fakes._tick()
+
+        counts = {s.stage: s.count for s in engine_with_fakes.profiler.snapshot()}
+        assert counts == dict.fromkeys((*TICK_STAGES, TICK), 1)
+
+    @pytest.mark.unit
+    def test_flatten_tick_records_send_and_journal_output(self, engine_with_fakes, sample_position):
+        """Test the flatten path records its stages and skips the strategy."""
+        engine_with_fakes.account_port.positions = Positions(
+            timestamp=sample_position().timestamp, positions=[sample_position()]
+        )
+        engine_with_fakes.portfolio_manager_port.state.trading_state = TradingState.FLATTEN
+
+        engine_with_fakes._tick()
+
+        counts = {s.stage: s.count for s in engine_with_fakes.profiler.snapshot()}
+        assert counts["send_orders"] == counts["journal_output"] == counts[TICK] == 1
+        assert counts["strategy"] == 0
+
+    @pytest.mark.unit
+    def test_publishes_latency_every_n_ticks(self, engine_with_fakes, fake_controller_port):
+        """Test latency is published to the controller every latency_publish_every ticks."""
+        engine_with_fakes.latency_publish_every = 2
+
+        for _ in range(5):
+            engine_with_fakes._tick()
+
+        assert len(fake_controller_port.published_latency) == 2
+        tick = fake_controller_port.published_latency[-1][-1]
+        assert (tick.stage, tick.count) == (TICK, 4)
+
+    @pytest.mark.unit
+    def test_async_engine_records_and_publishes(
+        self, async_engine_with_fakes, fake_controller_port
+    ):
+        """Test AsyncEngine records the same stages and awaits publishing."""
+        async_engine_with_fakes.latency_publish_every = 1
+
+        asyncio.run(async_engine_with_fakes._tick())
+
+        counts = {s.stage: s.count for s in async_engine_with_fakes.profiler.snapshot()}
+        assert counts == dict.fromkeys((*TICK_STAGES, TICK), 1)
+        assert len(fake_controller_port.published_latency) == 1
@@ -0,0 +1,327 @@
+"""Unit tests for RiskEngine - Pre-trade risk checks.
+
+Tests cover position and portfolio exposure limits, reservations within a
+batch, risk-reducing orders, fills and cancels, reason codes, agreement of the
+incremental totals with a full resync, check cost with thousands of open
+orders, and the Engine risk stage including release on order events.
+"""
+
+import random
+import time
+from datetime import datetime, timezone
+from unittest.mock import MagicMock
+from uuid import uuid4
+
+import pytest
+
+from system.algo_trader.domain.models import (
+    Account,
+    LimitOrder,
+    MarketOrder,
+    OrderEvent,
+    Orders,
+    PortfolioManager,
+    Position,
+    Positions,
+    Quote,
+)
+from system.algo_trader.domain.risk import RiskEngine
+from system.algo_trader.domain.states import (
+    OrderDuration,
+    OrderInstruction,
+    OrderStatus,
+    OrderTaxLotMethod,
+    OrderType,
+    RiskRejectReason,
+    TradingState,
+)
+
+NOW = datetime(2024, 1, 2, 15, 30, tzinfo=timezone.utc)
+SYMBOLS = [f"S{i}" for i in range(8)]
+
+# 10% per position and 50% portfolio exposure of 100k equity
+LIMITS = PortfolioManager(NOW, TradingState.NEUTRAL, max_exposure_pct=50.0, max_position_pct=10.0)
+
+
+def _order(
+    symbol: str = "AAPL",
+    quantity: int = 10,
+    instruction: OrderInstruction = OrderInstruction.BUY_TO_OPEN,
+) -> MarketOrder:
+    return MarketOrder(
+        id=uuid4(),
+        timestamp=NOW,
+        symbol=symbol,
+        quantity=quantity,
+        order_type=OrderType.MARKET,
+        order_instruction=instruction,
+        order_duration=OrderDuration.DAY,
+        order_tax_lot_method=OrderTaxLotMethod.FIFO,
+    )
+
+
+def _quote(prices: dict[str, float]) -> Quote:
+    return Quote(NOW, "EQUITY", prices, prices, {}, {}, prices, {}, {}, {})
+
+
+def _risk(prices: dict[str, float] | None = None, **kwargs) -> RiskEngine:
+    risk = RiskEngine(**kwargs)
+    risk.sync(Positions(NOW, []), Orders(NOW, []))
+    risk.update_account(Account(NOW, 100_000.0, 100_000.0, 0.0, 100_000.0, 0.0))
+    risk.mark_prices(_quote(prices or {"AAPL": 100.0}))
+    return risk
+
+
+def _check(risk: RiskEngine, *orders: MarketOrder, limits: PortfolioManager = LIMITS):
+    return risk.check(Orders(NOW, list(orders)), limits)
+
+
+class TestRiskLimits:
+    """Test exposure limits and reason codes."""
+
+    @pytest.mark.unit
+    def test_accepts_within_limits_and_reserves_exposure(self):
+        """Test an accepted order counts against exposure immediately."""
+        risk = _risk()
+
+        accepted, rejections = _check(risk, _order(quantity=50))
+
+        assert len(accepted.orders) == 1
+        assert rejections == []
+        assert risk.exposure("AAPL") == risk.exposure() == 5_000.0
+        assert risk.open_orders == 1
+
+    @pytest.mark.unit
+    def test_position_limit_applies_across_a_batch(self):
+        """Test reservations from earlier orders in a batch count for later ones."""
+        risk = _risk()
+
+        accepted, rejections = _check(risk, _order(quantity=60), _order(quantity=60))
+
+        assert len(accepted.orders) == 1
+        (rejection,) = rejections
+        assert rejection.reason == RiskRejectReason.MAX_POSITION
+        assert "AAPL" in rejection.detail
+        assert risk.rejected[RiskRejectReason.MAX_POSITION] == 1
+
+    @pytest.mark.unit
+    def test_portfolio_exposure_limit(self):
+        """Test the portfolio total caps exposure across symbols."""
+        risk = _risk(dict.fromkeys(SYMBOLS, 100.0))
+
+        _, rejections = _check(risk, *(_order(symbol, 90) for symbol in SYMBOLS[:6]))
+
+        assert [r.reason for r in rejections] == [RiskRejectReason.MAX_EXPOSURE]
+        assert rejections[0].order.symbol == "S5"
+        assert risk.exposure() == 45_000.0
+
+    @pytest.mark.unit
+    def test_risk_reducing_orders_pass_over_limit(self):
+        """Test closing orders pass even when the position already exceeds its limit."""
+        risk = _risk()
+        position = Position(NOW, "AAPL", 200, 90.0, 100.0, 0.0, 0.0)
+        risk.sync(Positions(NOW, [position]), Orders(NOW, []))
+
+        accepted, rejections = _check(
+            risk,
+            _order(quantity=50, instruction=OrderInstruction.SELL_TO_CLOSE),
+            _order(quantity=1),
+        )
+
+        assert [o.order_instruction for o in accepted.orders] == [OrderInstruction.SELL_TO_CLOSE]
+        assert [r.reason for r in rejections] == [RiskRejectReason.MAX_POSITION]
+        assert risk.exposure("AAPL") == 20_000.0
+
+    @pytest.mark.unit
+    def test_order_level_reason_codes(self):
+        """Test quantity, duplicate, price, notional and open-order checks."""
+        risk = _risk(max_open_orders=2, max_order_notional=2_000.0)
+        first = _order(quantity=5)
+        _check(risk, first)
+        limit = LimitOrder(
+            id=uuid4(),
+            timestamp=NOW,
+            symbol="MSFT",
+            price=200.0,
+            quantity=5,
+            order_type=OrderType.LIMIT,
+            order_instruction=OrderInstruction.BUY_TO_OPEN,
+            order_duration=OrderDuration.DAY,
+            order_tax_lot_method=OrderTaxLotMethod.FIFO,
+        )
+
+        _, rejections = _check(
+            risk,
+            _order(quantity=0),
+            first,
+            _order(symbol="TSLA"),
+            _order(quantity=30),
+            limit,
+            _order(quantity=1),
+        )
+
+        assert [r.reason for r in rejections] == [
+            RiskRejectReason.INVALID_QUANTITY,
+            RiskRejectReason.DUPLICATE_ORDER,
+            RiskRejectReason.NO_PRICE,
+            RiskRejectReason.MAX_ORDER_NOTIONAL,
+            RiskRejectReason.MAX_OPEN_ORDERS,
+        ]
+        assert risk.exposure("MSFT") == 1_000.0
+
+    @pytest.mark.unit
+    def test_zero_equity_rejects_new_risk(self):
+        """Test limits are zero until account equity is known."""
+        risk = RiskEngine()
+        risk.mark_prices(_quote({"AAPL": 100.0}))
+
+        _, rejections = _check(risk, _order(quantity=1))
+
+        assert [r.reason for r in rejections] == [RiskRejectReason.MAX_POSITION]
+
+
+class TestRiskEvents:
+    """Test incremental updates from order events."""
+
+    @pytest.mark.unit
+    def test_fill_and_cancel_update_totals(self):
+        """Test fills move quantity to the position and cancels release the rest."""
+        risk = _risk()
+        accepted, _ = _check(risk, _order(quantity=50))
+        order_id = accepted.orders[0].id
+
+        risk.on_fill(order_id, 20, price=100.0)
+        after_fill = risk.exposure("AAPL")
+        risk.on_order_done(order_id)
+
+        assert after_fill == 5_000.0
+        assert risk.exposure("AAPL") == 2_000.0
+        assert risk.open_orders == 0
+
+    @pytest.mark.unit
+    def test_mark_prices_reprices_exposure(self):
+        """Test a new mark price rescales the symbol and portfolio totals."""
+        risk = _risk()
+        _check(risk, _order(quantity=50))
+
+        risk.mark_prices(_quote({"AAPL": 120.0}))
+
+        assert risk.exposure() == 6_000.0
+
+    @pytest.mark.unit
+    def test_incremental_totals_match_resync(self):
+        """Test random checks, fills and cancels agree with a full rebuild."""
+        rng = random.Random(11)
+        risk = _risk(dict.fromkeys(SYMBOLS, 50.0))
+        working = {}
+        positions = dict.fromkeys(SYMBOLS, 0)
+        for _ in range(500):
+            if working and rng.random() < 0.5:
+                order = working[rng.choice(list(working))]
+                if rng.random() < 0.5:
+                    fill = rng.randint(1, order.quantity)
+                    risk.on_fill(order.id, fill)
+                    sign = 1 if order.order_instruction == OrderInstruction.BUY_TO_OPEN else -1
+                    positions[order.symbol] += sign * fill
+                    order.quantity -= fill
+                    if order.quantity == 0:
+                        del working[order.id]
+                else:
+                    risk.on_order_done(order.id)
+                    del working[order.id]
+            else:
+                instruction = rng.choice(
+                    [OrderInstruction.BUY_TO_OPEN, OrderInstruction.SELL_TO_OPEN]
+                )
+                order = _order(rng.choice(SYMBOLS), rng.randint(1, 40), instruction)
+                accepted, _ = _check(risk, order)
+                if accepted.orders:
+                    working[order.id] = order
+
+        rebuilt = _risk(dict.fromkeys(SYMBOLS, 50.0))
+        rebuilt.sync(
+            Positions(NOW, [Position(NOW, s, q, 0.0, 0.0, 0.0, 0.0) for s, q in positions.items()]),
+            Orders(NOW, list(working.values())),
+        )
+        assert risk.exposure() == pytest.approx(rebuilt.exposure())
+        for symbol in SYMBOLS:
+            assert risk.exposure(symbol) == pytest.approx(rebuilt.exposure(symbol))
+        assert risk.open_orders == rebuilt.open_orders
+
+    @pytest.mark.unit
+    def test_check_cost_independent_of_open_orders(self):
+        """Test checks stay in the microsecond range with thousands of open orders."""
+        symbols = [f"T{i}" for i in range(500)]
+        risk = _risk(dict.fromkeys(symbols, 10.0))
+        open_orders = [_order(symbols[i % 500], 1) for i in range(5_000)]
+        risk.sync(Positions(NOW, []), Orders(NOW, open_orders))
+        orders = [_order(symbols[i % 500], 1) for i in range(2_000)]
+        loose = PortfolioManager(NOW, TradingState.NEUTRAL, 1e6, 1e6)
+
+        start = time.perf_counter()
+        accepted, _ = _check(risk, *orders, limits=loose)
+        per_order_us = (time.perf_counter() - start) / len(orders) * 1e6
+
+        assert len(accepted.orders) == 2_000
+        assert per_order_us < 100.0
+
+
+class TestEngineRiskStage:
+    """Test the risk stage inside Engine._tick."""
+
+    @pytest.mark.integration
+    def test_tick_sends_accepted_and_journals_rejections(
+        self, engine_with_fakes, sample_market_order
+    ):
+        """Test oversized orders are withheld from the order port and journaled."""
+        engine_with_fakes.risk_engine = RiskEngine()
+        small = sample_market_order(quantity=10)
+        large = sample_market_order(quantity=200)
+        engine_with_fakes.strategy_port.signals = Orders(timestamp=NOW, orders=[small, large])
+
+        engine_with_fakes._tick()
+
+        (sent,) = engine_with_fakes.order_port.sent_orders
+        assert [o.id for o in sent.orders] == [small.id]
+        (output,) = engine_with_fakes.journal_port.outputs
+        assert [r.order.id for r in output.rejections] == [large.id]
+        assert output.rejections[0].reason == RiskRejectReason.MAX_POSITION
+        assert engine_with_fakes.risk_engine.exposure("AAPL") == pytest.approx(1_002.5)
+
+    @pytest.mark.integration
+    def test_fill_and_cancel_events_release_reservations(
+        self, engine_with_fakes, sample_market_order
+    ):
+        """Test order events reported after a send release the risk reservations."""
+        engine_with_fakes.risk_engine = RiskEngine()
+        filled = sample_market_order(quantity=10)
+        cancelled = sample_market_order(quantity=5)
+        engine_with_fakes.strategy_port.signals = Orders(NOW, [filled, cancelled])
+        engine_with_fakes._tick()
+        reserved = engine_with_fakes.risk_engine.open_orders
+
+        engine_with_fakes.strategy_port.signals = Orders(NOW, [])
+        engine_with_fakes.order_port.order_events = [
+            OrderEvent(NOW, filled.id, OrderStatus.FILLED, filled_quantity=10),
+            OrderEvent(NOW, cancelled.id, OrderStatus.CANCELLED),
+        ]
+        engine_with_fakes._tick()
+
+        assert reserved == 2
+        assert engine_with_fakes.risk_engine.open_orders == 0
+        assert engine_with_fakes.risk_engine.exposure("AAPL") == pytest.approx(1_002.5)
+
+    @pytest.mark.integration
+    def test_resync_cadence_survives_profiler_reset(self, engine_with_fakes):
+        """Test risk resyncs follow engine ticks, not the resettable profiler count."""
+        risk = RiskEngine()
+        risk.sync = MagicMock(wraps=risk.sync)
+        engine_with_fakes.risk_engine = risk
+        engine_with_fakes.risk_sync_every = 3
+
+        for _ in range(4):
+            engine_with_fakes._tick()
+            engine_with_fakes.profiler.reset()
+
+        # Ticks 0 and 3; a profiler-keyed check would resync every tick
+        assert risk.sync.call_count == 2
@@ -0,0 +1,227 @@
+"""Integration tests for Backtester - Engine replay over stored bars.
+
+Tests cover the fast and event-driven replay paths, simulated timestamps and
+order IDs, columnar inputs, replay windows sliced from prebuilt frames,
+loading bars from SQLite, and the replay benchmark.
+"""
+
+from uuid import UUID
+
+import numpy as np
+import pandas as pd
+import pytest
+
+from infrastructure.sqlite.sqlite import BaseSQLiteClient
+from system.algo_trader.domain.models import (
+    HistoricalOHLCV,
+    MarketOrder,
+    OHLCVPanel,
+    Orders,
+    Positions,
+    Quote,
+    QuoteBatch,
+)
+from system.algo_trader.domain.ports.strategy_port import StrategyPort
+from system.algo_trader.domain.states import (
+    OrderDuration,
+    OrderInstruction,
+    OrderTaxLotMethod,
+    OrderType,
+)
+from system.algo_trader.infra.backtest.backtester import Backtester
+from system.algo_trader.infra.backtest.bar_store import BarStore
+from system.algo_trader.infra.backtest.ports import BacktestHistoricalPort, SimulationClock
+from system.algo_trader.infra.backtest.replay_bench import run as run_bench
+from system.algo_trader.infra.backtest.replay_bench import synthetic_store
+
+
+class BuyOnceStrategy(StrategyPort):
+    """Buys ten shares of each symbol on the first tick it sees them flat."""
+
+    def __init__(self):
+        """Initialize with no observed inputs."""
+        self.inputs: list[tuple] = []
+        self._bought = False
+
+    def get_signals(
+        self,
+        historical_data: HistoricalOHLCV | OHLCVPanel,
+        quote_data: Quote | QuoteBatch,
+        position_data: Positions,
+    ) -> Orders:
+        """Emit one market buy on the first tick."""
+        self.inputs.append((historical_data, quote_data))
+        if self._bought:
+            return Orders(timestamp=quote_data.timestamp, orders=[])
+        self._bought = True
+        return Orders(
+            timestamp=quote_data.timestamp,
+            orders=[
+                MarketOrder(
+                    id=UUID(int=0),
+                    timestamp=quote_data.timestamp,
+                    symbol="AAPL",
+                    quantity=10,
+                    order_type=OrderType.MARKET,
+                    order_instruction=OrderInstruction.BUY_TO_OPEN,
+                    order_duration=OrderDuration.GTC,
+                    order_tax_lot_method=OrderTaxLotMethod.FIFO,
+                )
+            ],
+        )
+
+
+@pytest.fixture
+def store():
+    """Provide five daily AAPL bars with open = close - 1."""
+    index = pd.date_range("2024-01-01", periods=5, freq="D", tz="UTC")
+    closes = [100.0, 101.0, 102.0, 103.0, 104.0]
+    frame = pd.DataFrame(
+        {
+            "open": [c - 1.0 for c in closes],
+            "high": [c + 1.0 for c in closes],
+            "low": [c - 2.0 for c in closes],
+            "close": closes,
+            "volume": [1000.0] * 5,
+        },
+        index=index,
+    )
+    return BarStore.from_frames({"AAPL": frame})
+
+
+class TestBacktester:
+    """Test replaying bars through the Engine."""
+
+    @pytest.mark.integration
+    @pytest.mark.parametrize("fast", [True, False])
+    def test_replay_fills_next_bar_and_marks_equity(
+        self, store, fake_portfolio_manager_port, fast
+    ):
+        """Test both paths tick once per bar and fill at the next bar's open."""
+        strategy = BuyOnceStrategy()
+        backtester = Backtester(
+            store, strategy, fake_portfolio_manager_port, initial_cash=10_000.0, lookback=3
+        )
+
+        result = backtester.run(fast=fast)
+
+        assert result.ticks == 5
+        assert len(strategy.inputs) == 5
+        assert [(f.symbol, f.quantity, f.price) for f in result.fills] == [("AAPL", 10, 100.0)]
+        assert result.fills[0].timestamp == store.datetimes[1]
+        assert result.equity[0] == 10_000.0
+        assert result.equity[-1] == pytest.approx(10_000.0 - 1000.0 + 1040.0)
+        assert result.account.position_value == pytest.approx(1040.0)
+
+        historical, quote = strategy.inputs[-1]
+        assert len(historical.data["AAPL"]) == 3
+        assert quote.last["AAPL"] == 104.0
+        assert quote.timestamp == store.datetimes[4]
+
+    @pytest.mark.integration
+    def test_engine_uses_simulated_clock_and_ids(
+        self, store, fake_strategy_port, fake_portfolio_manager_port
+    ):
+        """Test the engine reads bar timestamps and sequential order IDs."""
+        engine, clock, broker = Backtester(
+            store, fake_strategy_port, fake_portfolio_manager_port
+        ).build()
+        clock.advance()
+        broker.process_bar(0)
+
+        assert engine._now() == store.datetimes[0]
+        assert engine._new_id() == UUID(int=1)
+        assert engine._new_id() == UUID(int=2)
+
+    @pytest.mark.integration
+    def test_columnar_inputs(self, store, fake_portfolio_manager_port):
+        """Test columnar mode feeds OHLCVPanel windows and QuoteBatch quotes."""
+        strategy = BuyOnceStrategy()
+        Backtester(store, strategy, fake_portfolio_manager_port, lookback=2, columnar=True).run()
+
+        historical, quote = strategy.inputs[-1]
+        assert isinstance(historical, OHLCVPanel)
+        assert isinstance(quote, QuoteBatch)
+        np.testing.assert_array_equal(historical.column("AAPL", "close"), [103.0, 104.0])
+        assert quote.change[quote.index_of("AAPL")] == 1.0
+
+    @pytest.mark.integration
+    @pytest.mark.parametrize("columnar", [False, True])
+    def test_windows_match_store_slices_every_tick(self, columnar):
+        """Test windows sliced from prebuilt frames equal the store at each bar."""
+        store = synthetic_store(bars=6, symbols=3)
+        clock = SimulationClock(store)
+        port = BacktestHistoricalPort(store, clock, lookback=4, columnar=columnar)
+
+        for _ in range(len(store)):
+            hi = clock.advance() + 1
+            lo = max(hi - 4, 0)
+            window = port.get_data()
+            for j, symbol in enumerate(store.symbols):
+                expected = store.close[lo:hi, j]
+                if columnar:
+                    np.testing.assert_array_equal(window.column(symbol, "close"), expected)
+                else:
+                    frame = window.data[symbol]
+                    np.testing.assert_array_equal(frame["close"].to_numpy(), expected)
+                    assert frame.index.equals(store.index[lo:hi])
+
+    @pytest.mark.integration
+    def test_columnar_windows_are_read_only(self):
+        """Test a strategy cannot write through a window into later ticks."""
+        store = synthetic_store(bars=3, symbols=1)
+        clock = SimulationClock(store)
+        port = BacktestHistoricalPort(store, clock, lookback=2, columnar=True)
+        clock.advance()
+
+        with pytest.raises(ValueError):
+            port.get_data().column(store.symbols[0], "close")[0] = 0.0
+
+    @pytest.mark.integration
+    def test_replay_bench_reports_every_case(self):
+        """Test the benchmark times both data paths for each strategy."""
+        results = run_bench(synthetic_store(bars=60, symbols=2), 20, 1, ["null", "sma"])
+
+        assert [(r["data"], r["strategy"]) for r in results] == [
+            ("dataframe", "null"),
+            ("dataframe", "sma"),
+            ("columnar", "null"),
+            ("columnar", "sma"),
+        ]
+        assert all(r["ticks_per_s"] > 0 for r in results)
+        for r in results:
+            assert r["symbol_bars_per_min"] == pytest.approx(r["ticks_per_min"] * 2, abs=1)
+
+    @pytest.mark.integration
+    def test_replay_bench_meets_target_follows_measurement(self):
+        """Test meets_target compares the measured rate against the given goal."""
+        store = synthetic_store(bars=60, symbols=1)
+
+        assert all(r["meets_target"] for r in run_bench(store, 20, 1, ["null"], target=0))
+        assert not any(r["meets_target"] for r in run_bench(store, 20, 1, ["null"], float("inf")))
+
+    @pytest.mark.integration
+    def test_bar_store_from_sqlite(self):
+        """Test bars stored as epoch-millisecond rows load onto one timeline."""
+        client = BaseSQLiteClient()
+        client.execute(
+            "CREATE TABLE bars (symbol TEXT, timestamp INTEGER, open REAL, high REAL, "
+            "low REAL, close REAL, volume REAL)"
+        )
+        client.execute_many(
+            "INSERT INTO bars VALUES (?, ?, ?, ?, ?, ?, ?)",
+            [
+                ("AAPL", 1704067200000, 1.0, 2.0, 0.5, 1.5, 10.0),
+                ("AAPL", 1704153600000, 1.5, 2.5, 1.0, 2.0, 10.0),
+                ("MSFT", 1704153600000, 3.0, 4.0, 2.5, 3.5, 20.0),
+            ],
+        )
+
+        store = BarStore.from_sqlite(client, symbols=["AAPL", "MSFT"])
+        client.close()
+
+        assert store.symbols == ("AAPL", "MSFT")
+        assert len(store) == 2
+        assert store.index[0] == pd.Timestamp("2024-01-01", tz="UTC")
+        assert np.isnan(store.close[0, 1])
+        assert store.close[1].tolist() == [2.0, 3.5]
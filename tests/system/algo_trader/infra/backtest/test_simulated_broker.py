@@ -0,0 +1,202 @@
+"""Unit tests for SimulatedBroker - Bar-based fill simulation.
+
+Tests cover fill prices for each order type, next-bar eligibility, duration
+expiry, and cash/position accounting. Bars are built in memory.
+"""
+
+from datetime import datetime, timezone
+from uuid import uuid4
+
+import pandas as pd
+import pytest
+
+from system.algo_trader.domain.models import (
+    LimitOrder,
+    MarketOrder,
+    Orders,
+    StopLimitOrder,
+    StopOrder,
+)
+from system.algo_trader.domain.states import (
+    OrderDuration,
+    OrderInstruction,
+    OrderStatus,
+    OrderTaxLotMethod,
+    OrderType,
+)
+from system.algo_trader.infra.backtest.bar_store import BarStore
+from system.algo_trader.infra.backtest.simulated_broker import SimulatedBroker
+
+NOW = datetime(2024, 1, 1, tzinfo=timezone.utc)
+
+
+@pytest.fixture
+def store():
+    """Provide three daily AAPL bars: 100-105 range, then a gap up to 110."""
+    index = pd.date_range("2024-01-01", periods=3, freq="D", tz="UTC")
+    frame = pd.DataFrame(
+        {
+            "open": [100.0, 101.0, 110.0],
+            "high": [102.0, 105.0, 112.0],
+            "low": [99.0, 98.0, 108.0],
+            "close": [101.0, 104.0, 111.0],
+            "volume": [1000.0, 1000.0, 1000.0],
+        },
+        index=index,
+    )
+    return BarStore.from_frames({"AAPL": frame})
+
+
+@pytest.fixture
+def broker(store):
+    """Provide a broker that has processed the first bar."""
+    broker = SimulatedBroker(store, initial_cash=10_000.0)
+    broker.process_bar(0)
+    return broker
+
+
+def _order(kind, instruction=OrderInstruction.BUY_TO_OPEN, duration=OrderDuration.GTC, **prices):
+    common = {
+        "id": uuid4(),
+        "timestamp": NOW,
+        "symbol": "AAPL",
+        "quantity": 10,
+        "order_instruction": instruction,
+        "order_duration": duration,
+        "order_tax_lot_method": OrderTaxLotMethod.FIFO,
+    }
+    if kind is MarketOrder:
+        return MarketOrder(order_type=OrderType.MARKET, **common)
+    if kind is LimitOrder:
+        return LimitOrder(order_type=OrderType.LIMIT, **common, **prices)
+    if kind is StopOrder:
+        return StopOrder(order_type=OrderType.STOP, **common, **prices)
+    return StopLimitOrder(order_type=OrderType.STOP_LIMIT, **common, **prices)
+
+
+def _submit(broker, order):
+    broker.submit(Orders(timestamp=NOW, orders=[order]))
+    return order
+
+
+class TestFillPrices:
+    """Test fill prices against the next bar (open 101, high 105, low 98)."""
+
+    @pytest.mark.unit
+    @pytest.mark.parametrize(
+        "kind,instruction,prices,expected",
+        [
+            (MarketOrder, OrderInstruction.BUY_TO_OPEN, {}, 101.0),
+            (LimitOrder, OrderInstruction.BUY_TO_OPEN, {"price": 99.0}, 99.0),
+            (LimitOrder, OrderInstruction.BUY_TO_OPEN, {"price": 102.0}, 101.0),
+            (LimitOrder, OrderInstruction.SELL_TO_OPEN, {"price": 104.0}, 104.0),
+            (StopOrder, OrderInstruction.BUY_TO_OPEN, {"price": 103.0}, 103.0),
+            (StopOrder, OrderInstruction.SELL_TO_OPEN, {"price": 99.0}, 99.0),
+            (
+                StopLimitOrder,
+                OrderInstruction.BUY_TO_OPEN,
+                {"stop_price": 103.0, "limit_price": 104.0},
+                103.0,
+            ),
+        ],
+    )
+    def test_fill_price(self, broker, kind, instruction, prices, expected):
+        """Test each order type fills at the documented price on the next bar."""
+        order = _submit(broker, _order(kind, instruction, **prices))
+
+        broker.process_bar(1)
+
+        assert broker.status[order.id] == OrderStatus.FILLED
+        assert broker.fills[0].price == pytest.approx(expected)
+
+    @pytest.mark.unit
+    def test_order_not_eligible_on_submission_bar(self, store):
+        """Test an order placed after bar i is first matched on bar i + 1."""
+        broker = SimulatedBroker(store)
+        broker.process_bar(0)
+        order = _submit(broker, _order(MarketOrder))
+
+        assert broker.status[order.id] == OrderStatus.WORKING
+        assert broker.fills == []
+
+    @pytest.mark.unit
+    def test_unreached_limit_keeps_working_until_gtc_fill(self, broker):
+        """Test a GTC sell limit rests until a later bar trades through it."""
+        order = _submit(broker, _order(LimitOrder, OrderInstruction.SELL_TO_OPEN, price=109.0))
+
+        broker.process_bar(1)
+        assert broker.status[order.id] == OrderStatus.WORKING
+
+        broker.process_bar(2)
+        assert broker.status[order.id] == OrderStatus.FILLED
+        # Gapped open above the limit fills at the open
+        assert broker.fills[0].price == 110.0
+
+
+class TestDurationsAndAccounting:
+    """Test order expiry and account bookkeeping."""
+
+    @pytest.mark.unit
+    def test_day_order_expires_after_first_session(self, broker):
+        """Test an unfilled DAY order expires when the next session starts."""
+        order = _submit(broker, _order(LimitOrder, duration=OrderDuration.DAY, price=90.0))
+
+        broker.process_bar(1)
+        assert broker.status[order.id] == OrderStatus.WORKING
+
+        broker.process_bar(2)
+        assert broker.status[order.id] == OrderStatus.EXPIRED
+        assert broker.open_orders().orders == []
+
+    @pytest.mark.unit
+    def test_ioc_order_gets_one_bar(self, broker):
+        """Test an unfilled IOC order expires after its first eligible bar."""
+        order = _submit(broker, _order(LimitOrder, duration=OrderDuration.IOC, price=90.0))
+
+        broker.process_bar(1)
+
+        assert broker.status[order.id] == OrderStatus.EXPIRED
+
+    @pytest.mark.unit
+    def test_round_trip_updates_cash_positions_and_equity(self, store):
+        """Test buying then selling moves cash, cost basis and equity consistently."""
+        broker = SimulatedBroker(store, initial_cash=10_000.0, commission_per_share=0.01)
+        broker.process_bar(0)
+        _submit(broker, _order(MarketOrder))
+        broker.process_bar(1)
+
+        position = broker.positions().positions[0]
+        assert position.quantity == 10
+        assert position.cost_basis == 101.0
+        assert position.current_price == 104.0
+        assert broker.cash == pytest.approx(10_000.0 - 1010.0 - 0.1)
+        assert broker.equity_curve[1] == pytest.approx(broker.cash + 1040.0)
+
+        _submit(broker, _order(MarketOrder, OrderInstruction.SELL_TO_CLOSE))
+        broker.process_bar(2)
+
+        assert broker.positions().positions == []
+        assert broker.cash == pytest.approx(10_000.0 + 90.0 - 0.2)
+        assert broker.account().commission_and_fees == pytest.approx(0.2)
+
+    @pytest.mark.unit
+    def test_unknown_symbol_rejected(self, broker):
+        """Test orders for symbols outside the store are rejected."""
+        order = _order(MarketOrder)
+        order.symbol = "MSFT"
+
+        accepted = broker.submit(Orders(timestamp=NOW, orders=[order]))
+
+        assert accepted.orders == []
+        assert broker.status[order.id] == OrderStatus.REJECTED
+
+    @pytest.mark.unit
+    def test_cancel_by_string_id(self, broker):
+        """Test cancel looks orders up by ID and ignores unknown or malformed IDs."""
+        order = _submit(broker, _order(MarketOrder))
+
+        assert not broker.cancel("not-a-uuid")
+        assert not broker.cancel(str(uuid4()))
+        assert broker.cancel(str(order.id))
+        assert broker.status[order.id] == OrderStatus.CANCELLED
+        assert broker.open_orders().orders == []
@@ -0,0 +1,238 @@
+"""Unit tests for ParameterSweep - Parallel strategy parameter sweeps.
+
+Tests cover grid and random parameter generation, chunking, the shared-memory
+bar store round trip, SMA crossover signals, streaming sweep results, and
+pool ownership. The process pool is replaced by an in-process stand-in so no
+workers are spawned.
+"""
+
+from datetime import datetime, timezone
+from unittest.mock import patch
+
+import numpy as np
+import pandas as pd
+import pytest
+
+from system.algo_trader.domain.models import HistoricalOHLCV, Position, Positions, Quote
+from system.algo_trader.domain.states import OrderInstruction
+from system.algo_trader.infra.backtest.bar_store import BarStore
+from system.algo_trader.infra.backtest import shared_store
+from system.algo_trader.infra.backtest.shared_store import SharedBarStore, attach
+from system.algo_trader.infra.backtest.sma_crossover import SmaCrossoverStrategy
+from system.algo_trader.infra.backtest.sweep import (
+    ParameterSweep,
+    chunked,
+    grid,
+    random_search,
+)
+from system.algo_trader.infra.backtest.sweep_cli import parse_range
+
+NOW = datetime(2024, 1, 1, tzinfo=timezone.utc)
+SWEEP = "system.algo_trader.infra.backtest.sweep"
+
+
+def _history(closes: list[float]) -> HistoricalOHLCV:
+    return HistoricalOHLCV(
+        period="1Y",
+        frequency="1D",
+        start=NOW,
+        end=NOW,
+        data={"AAPL": pd.DataFrame({"close": closes})},
+    )
+
+
+class InlineProcessManager:
+    """ProcessManager stand-in that runs tasks in the calling process."""
+
+    def __init__(self):
+        """Initialize with no pool activity."""
+        self.closed = False
+        self.terminated = False
+
+    def imap_unordered(self, func, iterable, chunksize=1):
+        """Yield results in reverse submission order to mimic out-of-order completion."""
+        yield from (func(item) for item in reversed(list(iterable)))
+
+    def close_pool(self):
+        """Record a graceful pool close."""
+        self.closed = True
+
+    def terminate_pool(self):
+        """Record a pool termination."""
+        self.terminated = True
+
+
+@pytest.fixture
+def store():
+    """Provide 120 daily bars for two symbols following a slow sine wave."""
+    index = pd.date_range("2024-01-01", periods=120, freq="D", tz="UTC")
+    frames = {}
+    for symbol, phase in (("AAPL", 0.0), ("MSFT", 1.5)):
+        closes = 100.0 + 10.0 * np.sin(np.arange(120) / 8.0 + phase)
+        frames[symbol] = pd.DataFrame(
+            {
+                "open": closes,
+                "high": closes + 1.0,
+                "low": closes - 1.0,
+                "close": closes,
+                "volume": 1000.0,
+            },
+            index=index,
+        )
+    return BarStore.from_frames(frames)
+
+
+class TestParameterGeneration:
+    """Test grid, random search and chunking."""
+
+    @pytest.mark.unit
+    def test_grid_is_cartesian_product(self):
+        """Test grid expands every combination in order."""
+        assert grid({"a": [1, 2], "b": ["x", "y"]}) == [
+            {"a": 1, "b": "x"},
+            {"a": 1, "b": "y"},
+            {"a": 2, "b": "x"},
+            {"a": 2, "b": "y"},
+        ]
+
+    @pytest.mark.unit
+    def test_random_search_is_seeded_and_bounded(self):
+        """Test random search respects bounds and is reproducible."""
+        space = {"short_window": (2, 5), "threshold": (0.1, 0.2), "mode": ["a", "b"]}
+
+        first = random_search(space, 50, seed=7)
+
+        assert first == random_search(space, 50, seed=7)
+        assert all(2 <= p["short_window"] <= 5 for p in first)
+        assert all(0.1 <= p["threshold"] <= 0.2 for p in first)
+        assert {p["mode"] for p in first} <= {"a", "b"}
+
+    @pytest.mark.unit
+    def test_chunked_splits_in_order(self):
+        """Test chunks preserve order and cap size."""
+        assert chunked([{"i": i} for i in range(5)], 2) == [
+            [{"i": 0}, {"i": 1}],
+            [{"i": 2}, {"i": 3}],
+            [{"i": 4}],
+        ]
+
+    @pytest.mark.unit
+    def test_cli_parse_range(self):
+        """Test inclusive range specs used by the CLI."""
+        assert parse_range("5:20:5") == [5, 10, 15, 20]
+        assert parse_range("3") == [3]
+
+
+class TestSharedBarStore:
+    """Test publishing a BarStore through shared memory."""
+
+    @pytest.mark.unit
+    def test_attach_round_trip(self, store):
+        """Test an attached store sees the same bars without copying per call."""
+        with SharedBarStore(store) as shared:
+            attached = attach(shared.handle)
+
+            assert attached.symbols == store.symbols
+            assert attached.index.equals(store.index)
+            np.testing.assert_array_equal(attached.close, store.close)
+            assert attach(shared.handle) is attached
+            del attached
+
+    @pytest.mark.unit
+    def test_attaching_another_store_releases_the_previous_one(self, store):
+        """Test a long-lived worker keeps only the latest sweep's blocks attached."""
+        with SharedBarStore(store) as first, SharedBarStore(store) as second:
+            attach(first.handle)
+            attach(second.handle)
+
+            assert list(shared_store._ATTACHED) == [second.handle.fields_name]
+
+
+class TestSmaCrossoverStrategy:
+    """Test crossover signal generation."""
+
+    @pytest.mark.unit
+    def test_buys_on_upward_cross_and_sells_on_downward_cross(self):
+        """Test entry when flat and exit when long."""
+        strategy = SmaCrossoverStrategy(short_window=2, long_window=3, quantity=5)
+        quote = Quote(NOW, "EQUITY", {}, {}, {}, {}, {}, {}, {}, {})
+        flat = Positions(timestamp=NOW, positions=[])
+        held = Positions(
+            timestamp=NOW,
+            positions=[Position(NOW, "AAPL", 5, 10.0, 6.0, 0.0, 30.0)],
+        )
+
+        entry = strategy.get_signals(_history([10.0, 9.0, 8.0, 12.0]), quote, flat)
+        exit_ = strategy.get_signals(_history([8.0, 9.0, 10.0, 6.0]), quote, held)
+
+        assert [(o.order_instruction, o.quantity) for o in entry.orders] == [
+            (OrderInstruction.BUY_TO_OPEN, 5)
+        ]
+        assert [(o.order_instruction, o.quantity) for o in exit_.orders] == [
+            (OrderInstruction.SELL_TO_CLOSE, 5)
+        ]
+        assert strategy.get_signals(_history([8.0, 9.0, 10.0, 6.0]), quote, flat).orders == []
+
+    @pytest.mark.unit
+    def test_rejects_inverted_windows(self):
+        """Test the short window must be shorter than the long window."""
+        with pytest.raises(ValueError, match="0 < short < long"):
+            SmaCrossoverStrategy(short_window=20, long_window=10)
+
+
+class TestParameterSweep:
+    """Test streaming sweep execution."""
+
+    @pytest.mark.integration
+    def test_streams_one_result_per_parameter_set(self, store):
+        """Test every set is backtested, failures are captured, and the pool is closed."""
+        manager = InlineProcessManager()
+        sweep = ParameterSweep(
+            store,
+            SmaCrossoverStrategy,
+            backtest_kwargs={"initial_cash": 50_000.0, "columnar": True},
+        )
+        param_sets = grid({"short_window": [3, 5], "long_window": [10, 20]})
+        param_sets.append({"short_window": 10, "long_window": 5})
+
+        with patch(f"{SWEEP}.ProcessManager", return_value=manager):
+            results = list(sweep.run(param_sets, chunk_size=2))
+
+        assert len(results) == 5
+        assert manager.closed and not manager.terminated
+        # Completion order follows the pool, not submission order
+        assert results[0].params == {"short_window": 10, "long_window": 5}
+        assert results[0].error.startswith("ValueError")
+        succeeded = [r for r in results if r.error is None]
+        assert len(succeeded) == 4
+        assert all(r.ticks == 120 and r.fills > 0 for r in succeeded)
+        assert all(0.0 <= r.max_drawdown < 1.0 for r in succeeded)
+        for result in succeeded:
+            assert result.total_return == pytest.approx(result.final_equity / 50_000.0 - 1)
+
+    @pytest.mark.integration
+    def test_early_exit_terminates_pool(self, store):
+        """Test abandoning the iterator terminates pending work."""
+        manager = InlineProcessManager()
+        sweep = ParameterSweep(store, SmaCrossoverStrategy)
+
+        with patch(f"{SWEEP}.ProcessManager", return_value=manager):
+            results = sweep.run(grid({"short_window": [3, 5], "long_window": [10]}), chunk_size=1)
+            next(results)
+            results.close()
+
+        assert manager.terminated
+
+    @pytest.mark.integration
+    def test_supplied_pool_is_left_running(self, store):
+        """Test a caller's pool is neither closed nor terminated by the sweep."""
+        manager = InlineProcessManager()
+        sweep = ParameterSweep(store, SmaCrossoverStrategy, process_manager=manager)
+        param_sets = grid({"short_window": [3, 5], "long_window": [10]})
+
+        assert len(list(sweep.run(param_sets))) == 2
+        results = sweep.run(param_sets, chunk_size=1)
+        next(results)
+        results.close()
+
+        assert not manager.closed and not manager.terminated
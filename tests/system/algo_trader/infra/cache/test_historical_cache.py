@@ -0,0 +1,170 @@
+"""Unit tests for CachingHistoricalPort - Incremental historical data cache.
+
+Tests cover cold-miss full-window loads, incremental appends on later ticks,
+refreshing a still-forming last bar, ring buffer eviction, and hit/miss
+accounting. The bar source is an in-memory
+fake so no network calls are made.
+"""
+
+from datetime import datetime
+
+import pandas as pd
+import pytest
+
+from system.algo_trader.domain.ports.historical_port import IncrementalHistoricalPort
+from system.algo_trader.infra.cache.historical_cache import BarRingBuffer, CachingHistoricalPort
+
+
+class FakeBarSource(IncrementalHistoricalPort):
+    """In-memory bar source that records every request."""
+
+    def __init__(self, bars: dict[str, pd.DataFrame]):
+        """Initialize with the full bar history per symbol."""
+        self.bars = bars
+        self.calls: list[tuple[str, str, datetime | None]] = []
+
+    def get_bars(self, symbol: str, frequency: str, since: datetime | None) -> pd.DataFrame:
+        """Return bars at or after since, or the full history."""
+        self.calls.append((symbol, frequency, since))
+        frame = self.bars[symbol]
+        if since is None:
+            return frame
+        return frame[frame.index >= pd.Timestamp(since)]
+
+
+def _bars(start: str, periods: int, first_close: float = 100.0) -> pd.DataFrame:
+    index = pd.date_range(start, periods=periods, freq="D", tz="UTC")
+    closes = [first_close + i for i in range(periods)]
+    return pd.DataFrame(
+        {
+            "open": closes,
+            "high": closes,
+            "low": closes,
+            "close": closes,
+            "volume": [1000.0] * periods,
+        },
+        index=index,
+    )
+
+
+@pytest.fixture
+def source():
+    """Provide a fake source with five daily bars for AAPL and MSFT."""
+    return FakeBarSource(
+        {"AAPL": _bars("2024-01-01", 5), "MSFT": _bars("2024-01-01", 5, first_close=300.0)}
+    )
+
+
+@pytest.fixture
+def cache(source):
+    """Provide a cache over the fake source."""
+    return CachingHistoricalPort(
+        source, symbols=["AAPL", "MSFT"], period="1Y", frequency="1D", window_bars=5
+    )
+
+
+class TestCachingHistoricalPort:
+    """Test incremental fetch and cache accounting."""
+
+    @pytest.mark.unit
+    def test_first_call_loads_full_window(self, cache, source):
+        """Test a cold cache fetches the full window once per symbol."""
+        data = cache.get_data()
+
+        assert [call[2] for call in source.calls] == [None, None]
+        assert len(data.data["AAPL"]) == 5
+        assert data.data["AAPL"]["close"].iloc[-1] == 104.0
+        assert cache.get_stats() == {"hits": 0, "misses": 2, "bars_fetched": 10}
+
+    @pytest.mark.unit
+    def test_second_call_fetches_only_new_bars(self, cache, source):
+        """Test later ticks request bars from the last cached timestamp on."""
+        cache.get_data()
+        source.bars["AAPL"] = _bars("2024-01-01", 6)
+
+        data = cache.get_data()
+
+        since = source.calls[2][2]
+        assert pd.Timestamp(since) == pd.Timestamp("2024-01-05", tz="UTC")
+        assert cache.get_stats() == {"hits": 2, "misses": 2, "bars_fetched": 13}
+        # Window stays at five bars and rolls forward
+        aapl = data.data["AAPL"]
+        assert len(aapl) == 5
+        assert aapl.index[0] == pd.Timestamp("2024-01-02", tz="UTC")
+        assert aapl["close"].iloc[-1] == 105.0
+        assert str(aapl.index.tz) == "UTC"
+
+    @pytest.mark.unit
+    def test_forming_last_bar_is_refreshed(self, cache, source):
+        """Test a change to the newest bar between calls replaces the cached bar."""
+        cache.get_data()
+        forming = source.bars["AAPL"].copy()
+        forming.iloc[-1, forming.columns.get_loc("high")] = 110.0
+        forming.iloc[-1, forming.columns.get_loc("close")] = 109.5
+        forming.iloc[-1, forming.columns.get_loc("volume")] = 2500.0
+        source.bars["AAPL"] = forming
+
+        aapl = cache.get_data().data["AAPL"]
+
+        assert len(aapl) == 5
+        assert aapl.index[-1] == pd.Timestamp("2024-01-05", tz="UTC")
+        assert aapl["high"].iloc[-1] == 110.0
+        assert aapl["close"].iloc[-1] == 109.5
+        assert aapl["volume"].iloc[-1] == 2500.0
+        assert aapl["close"].iloc[-2] == 103.0
+
+    @pytest.mark.unit
+    def test_invalidate_forces_full_refetch(self, cache, source):
+        """Test invalidation turns the next lookup into a miss."""
+        cache.get_data()
+        cache.invalidate("AAPL")
+
+        cache.get_data()
+
+        assert source.calls[2] == ("AAPL", "1D", None)
+        assert cache.stats.misses == 3
+        assert cache.stats.hits == 1
+
+
+class TestBarRingBuffer:
+    """Test ring buffer append and ordering."""
+
+    @pytest.mark.unit
+    def test_append_ignores_stale_bars(self):
+        """Test bars at or before the last cached timestamp are dropped."""
+        buffer = BarRingBuffer(capacity=10, columns=["close"], tz="UTC")
+        buffer.append(_bars("2024-01-01", 3)[["close"]])
+
+        appended = buffer.append(_bars("2024-01-02", 3)[["close"]])
+
+        assert appended == 1
+        assert len(buffer) == 4
+
+    @pytest.mark.unit
+    def test_append_overwrites_bar_with_same_timestamp(self):
+        """Test a bar matching the last cached timestamp replaces its values."""
+        buffer = BarRingBuffer(capacity=10, columns=["close"], tz="UTC")
+        buffer.append(_bars("2024-01-01", 3)[["close"]])
+
+        appended = buffer.append(_bars("2024-01-03", 2, first_close=50.0)[["close"]])
+
+        assert appended == 1
+        assert buffer.to_frame()["close"].tolist() == [100.0, 101.0, 50.0, 51.0]
+
+    @pytest.mark.unit
+    def test_wraparound_preserves_order(self):
+        """Test reads stay oldest-first after the write head wraps."""
+        buffer = BarRingBuffer(capacity=3, columns=["close"], tz="UTC")
+        for day in range(1, 6):
+            buffer.append(_bars(f"2024-01-0{day}", 1, first_close=float(day))[["close"]])
+
+        frame = buffer.to_frame()
+
+        assert frame["close"].tolist() == [3.0, 4.0, 5.0]
+        assert buffer.last_timestamp() == pd.Timestamp("2024-01-05", tz="UTC")
+
+    @pytest.mark.unit
+    def test_rejects_non_positive_capacity(self):
+        """Test capacity validation."""
+        with pytest.raises(ValueError):
+            BarRingBuffer(capacity=0, columns=["close"])
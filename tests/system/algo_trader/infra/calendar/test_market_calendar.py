@@ -0,0 +1,264 @@
+"""Unit tests for the cached market calendar and session-aware tick port.
+
+Tests cover per-day caching with stale fallback, sharing fetched days through
+the Redis store, prefetching, window lookup across sessions and weekends,
+bar-aligned tick scheduling, and SessionTickEventPort waiting on real time.
+"""
+
+import threading
+import time
+from datetime import date, datetime, timedelta, timezone
+from unittest.mock import patch
+
+import pytest
+
+from system.algo_trader.domain.models import Event, MarketHours
+from system.algo_trader.domain.states import ControllerCommand, EventType, MarketStatus, TickReason
+from system.algo_trader.infra.calendar.market_calendar import MarketCalendar
+from system.algo_trader.infra.calendar.session_event_port import SessionTickEventPort
+from system.algo_trader.infra.redis.market_calendar import MarketCalendarBroker
+
+OPEN_ONLY = {MarketStatus.OPEN}
+
+
+def _utc(day: int, hour: int, minute: int = 0, second: float = 0) -> datetime:
+    base = datetime(2024, 1, day, hour, minute, tzinfo=timezone.utc)
+    return base + timedelta(seconds=second)
+
+
+def _trading_day(day: int) -> list[MarketHours]:
+    """Sessions of an ET trading day in UTC: 07:00-09:30, 09:30-16:00, 16:00-20:00."""
+    stamp = _utc(1, 0)
+    return [
+        MarketHours(stamp, MarketStatus.PRE_MARKET, _utc(day, 12), _utc(day, 14, 30)),
+        MarketHours(stamp, MarketStatus.OPEN, _utc(day, 14, 30), _utc(day, 21)),
+        MarketHours(stamp, MarketStatus.POST_MARKET, _utc(day, 21), _utc(day + 1, 1)),
+    ]
+
+
+# Tuesday 2024-01-02 through Monday 2024-01-08; the weekend is closed
+SCHEDULE = {date(2024, 1, d): _trading_day(d) for d in (2, 3, 4, 5, 8)}
+
+
+class RecordingFetch:
+    """Session fetch serving SCHEDULE (closed on other days) and counting calls."""
+
+    def __init__(self, schedule=None):
+        self.schedule = SCHEDULE if schedule is None else schedule
+        self.calls: list[date] = []
+        self.fail = False
+
+    def __call__(self, day: date) -> list[MarketHours] | None:
+        self.calls.append(day)
+        if self.fail:
+            return None
+        return self.schedule.get(day, [])
+
+
+class FakeRedis:
+    """In-memory string keys recording their TTLs."""
+
+    def __init__(self):
+        self.values: dict[str, bytes] = {}
+        self.ttls: dict[str, int] = {}
+
+    def get(self, key):
+        return self.values.get(key)
+
+    def set(self, key, value, ex=None):
+        self.values[key] = value.encode()
+        self.ttls[key] = ex
+        return True
+
+
+@pytest.fixture
+def fetch():
+    """Fixture for a recording session fetch."""
+    return RecordingFetch()
+
+
+@pytest.fixture
+def store():
+    """Fixture for a MarketCalendarBroker backed by an in-memory fake."""
+    fake = FakeRedis()
+    with patch("infrastructure.redis.redis.redis") as mock_redis_module:
+        mock_redis_module.Redis.return_value = fake
+        broker = MarketCalendarBroker()
+    broker.fake = fake
+    return broker
+
+
+class TestMarketCalendar:
+    """Test session caching and window lookup."""
+
+    @pytest.mark.unit
+    def test_sessions_are_fetched_once(self, fetch):
+        """Test a day is fetched once while fresh, including closed days."""
+        calendar = MarketCalendar(fetch)
+
+        assert calendar.sessions(date(2024, 1, 2)) == SCHEDULE[date(2024, 1, 2)]
+        assert calendar.sessions(date(2024, 1, 6)) == []
+        calendar.sessions(date(2024, 1, 2))
+        calendar.sessions(date(2024, 1, 6))
+
+        assert fetch.calls == [date(2024, 1, 2), date(2024, 1, 6)]
+
+    @pytest.mark.unit
+    def test_stale_day_is_served_when_refetch_fails(self, fetch):
+        """Test an expired day keeps its windows if the API is unavailable."""
+        calendar = MarketCalendar(fetch, max_age_s=0)
+        calendar.sessions(date(2024, 1, 2))
+        fetch.fail = True
+
+        assert calendar.sessions(date(2024, 1, 2)) == SCHEDULE[date(2024, 1, 2)]
+        assert calendar.sessions(date(2024, 1, 3)) is None
+        assert len(fetch.calls) == 3
+
+    @pytest.mark.unit
+    def test_store_shares_days_between_calendars(self, fetch, store):
+        """Test a day fetched by one calendar is read from Redis by another."""
+        MarketCalendar(fetch, store=store, max_age_s=3600).prefetch(date(2024, 1, 5), days=2)
+        other_fetch = RecordingFetch()
+        other = MarketCalendar(other_fetch, store=store)
+
+        assert other.sessions(date(2024, 1, 5)) == SCHEDULE[date(2024, 1, 5)]
+        assert other.sessions(date(2024, 1, 6)) == []
+        assert other_fetch.calls == []
+        assert store.fake.ttls["algo_trader:calendar:equity:2024-01-05"] == 3600
+
+    @pytest.mark.unit
+    def test_prefetch_counts_available_days(self, fetch):
+        """Test prefetch loads lookahead_days and reports the days it got."""
+        calendar = MarketCalendar(fetch, lookahead_days=5)
+
+        assert calendar.prefetch(date(2024, 1, 2)) == 5
+
+        fetch.fail = True
+        assert calendar.prefetch(date(2024, 1, 5), days=4) == 2
+
+    @pytest.mark.unit
+    def test_next_window(self, fetch):
+        """Test the current window is returned, then the next one with the status."""
+        calendar = MarketCalendar(fetch)
+
+        assert calendar.next_window(_utc(2, 15)).status == MarketStatus.OPEN
+        assert calendar.next_window(_utc(3, 0, 30)).status == MarketStatus.POST_MARKET
+        assert calendar.next_window(_utc(5, 22), OPEN_ONLY).start == _utc(8, 14, 30)
+
+    @pytest.mark.unit
+    def test_next_window_beyond_lookahead_is_none(self):
+        """Test a calendar without upcoming sessions has no next window."""
+        calendar = MarketCalendar(RecordingFetch(schedule={}), lookahead_days=3)
+
+        assert calendar.next_window(_utc(2, 15)) is None
+
+
+class TestNextTick:
+    """Test bar-aligned tick scheduling on fabricated times."""
+
+    @pytest.mark.unit
+    def test_first_tick_is_next_boundary_in_session(self, fetch):
+        """Test the first tick waits for the session and the next bar boundary."""
+        port = SessionTickEventPort(MarketCalendar(fetch), statuses=OPEN_ONLY)
+
+        assert port.next_tick(_utc(2, 14, 29, 30)) == _utc(2, 14, 30)
+        assert port.next_tick(_utc(2, 14, 30, 10)) == _utc(2, 14, 30)
+        assert port.next_tick(_utc(2, 14, 31, 10)) == _utc(2, 14, 31)
+
+        later = SessionTickEventPort(MarketCalendar(fetch), statuses=OPEN_ONLY)
+
+        assert later.next_tick(_utc(2, 14, 30, 10)) == _utc(2, 14, 31)
+
+    @pytest.mark.unit
+    def test_session_boundary_ticks_once(self, fetch):
+        """Test the tick at the close is not repeated by the adjoining session."""
+        calendar = MarketCalendar(fetch)
+        port = SessionTickEventPort(calendar)
+        port.last_tick = _utc(2, 21).timestamp()
+
+        assert port.next_tick(_utc(2, 21)) == _utc(2, 21, 1)
+
+        regular = SessionTickEventPort(calendar, statuses=OPEN_ONLY)
+        regular.last_tick = _utc(2, 21).timestamp()
+
+        assert regular.next_tick(_utc(2, 21)) == _utc(3, 14, 30)
+
+    @pytest.mark.unit
+    def test_weekend_is_skipped(self, fetch):
+        """Test the tick after Friday's post-market is Monday's pre-market open."""
+        port = SessionTickEventPort(MarketCalendar(fetch), bar_interval_s=300)
+        port.last_tick = _utc(6, 1).timestamp()
+
+        assert port.next_tick(_utc(6, 1, 0, 2)) == _utc(8, 12)
+
+    @pytest.mark.unit
+    def test_missed_ticks_are_not_replayed(self, fetch):
+        """Test a busy engine gets the latest passed boundary, not the backlog."""
+        port = SessionTickEventPort(MarketCalendar(fetch))
+        port.last_tick = _utc(2, 14, 31).timestamp()
+
+        assert port.next_tick(_utc(2, 14, 40, 30)) == _utc(2, 14, 40)
+
+    @pytest.mark.unit
+    def test_unavailable_calendar_has_no_tick(self, fetch):
+        """Test no tick is scheduled while session hours cannot be fetched."""
+        fetch.fail = True
+        port = SessionTickEventPort(MarketCalendar(fetch))
+
+        assert port.next_tick(_utc(2, 15)) is None
+
+
+def _live_calendar() -> MarketCalendar:
+    """Calendar with one regular session spanning the current time."""
+    now = datetime.now(timezone.utc)
+    window = MarketHours(
+        now, MarketStatus.OPEN, now - timedelta(hours=1), now + timedelta(hours=1)
+    )
+    return MarketCalendar(RecordingFetch(schedule={now.date(): [window]}))
+
+
+class TestSessionTickEventPort:
+    """Test waiting for scheduled ticks and commands."""
+
+    @pytest.mark.unit
+    def test_emits_scheduled_ticks_on_boundaries(self):
+        """Test consecutive ticks are one bar apart and marked SCHEDULED."""
+        port = SessionTickEventPort(_live_calendar(), bar_interval_s=0.25)
+
+        start = time.monotonic()
+        first = port.wait_for_event(timeout_s=2.0)
+        second = port.wait_for_event(timeout_s=2.0)
+
+        assert first.type == EventType.TICK
+        assert first.reason == TickReason.SCHEDULED
+        assert (second.timestamp - first.timestamp).total_seconds() == pytest.approx(0.25)
+        assert second.timestamp.timestamp() % 0.25 == pytest.approx(0.0, abs=1e-6)
+        assert time.monotonic() - start < 1.0
+        assert port.ticks == 2
+
+    @pytest.mark.unit
+    def test_times_out_outside_sessions(self):
+        """Test no tick is emitted when the market is closed."""
+        port = SessionTickEventPort(MarketCalendar(RecordingFetch(schedule={})))
+
+        start = time.monotonic()
+        assert port.wait_for_event(timeout_s=0.2) is None
+        assert time.monotonic() - start < 1.0
+
+    @pytest.mark.unit
+    def test_command_interrupts_wait(self):
+        """Test a submitted command is returned ahead of the pending tick."""
+        port = SessionTickEventPort(_live_calendar(), bar_interval_s=3600.0)
+        command = Event(
+            timestamp=datetime.now(timezone.utc),
+            type=EventType.COMMAND,
+            command=ControllerCommand.PAUSE,
+        )
+        threading.Timer(0.05, port.submit, args=(command,)).start()
+
+        start = time.monotonic()
+        event = port.wait_for_event(timeout_s=5.0)
+
+        assert event.command == ControllerCommand.PAUSE
+        assert time.monotonic() - start < 1.0
+        assert port.ticks == 0
@@ -0,0 +1,352 @@
+"""Unit tests for BatchedJournalPort - Asynchronous batched journaling.
+
+Tests cover batching and ordering, the DROP, SAMPLE and BLOCK backpressure
+policies, writer metrics, entry serialization, and the SQLite and InfluxDB
+sinks. Sinks are in-process fakes or a temporary SQLite file.
+"""
+
+import json
+import threading
+from datetime import datetime, timezone
+from unittest.mock import Mock
+from uuid import UUID
+
+import pandas as pd
+import pytest
+
+from infrastructure.config import SQLiteConfig
+from infrastructure.sqlite.sqlite import BaseSQLiteClient
+from system.algo_trader.domain.models import (
+    HistoricalOHLCV,
+    JournalError,
+    JournalInput,
+    JournalOutput,
+    Orders,
+)
+from system.algo_trader.domain.states import EngineState, OrderStatus
+from system.algo_trader.infra.journal.batched_journal import (
+    BackpressurePolicy,
+    BatchedJournalPort,
+)
+from system.algo_trader.infra.journal.sinks import (
+    InfluxDBJournalSink,
+    JournalRecord,
+    JournalSink,
+    SQLiteJournalSink,
+    encode_entry,
+)
+
+NOW = datetime(2024, 1, 2, 15, 30, tzinfo=timezone.utc)
+
+
+def _output(i: int = 0) -> JournalOutput:
+    orders = Orders(timestamp=NOW, orders=[])
+    return JournalOutput(timestamp=NOW.replace(second=i), signals=orders, orders=orders)
+
+
+class RecordingSink(JournalSink):
+    """Sink that records batches and can hold the writer inside write()."""
+
+    def __init__(self, gated: bool = False):
+        """Initialize with an optional gate that blocks writes until released."""
+        self.batches: list[list[JournalRecord]] = []
+        self.entered = threading.Event()
+        self.gate = threading.Event()
+        if not gated:
+            self.gate.set()
+        self.closed = False
+
+    def write(self, records):
+        """Record the batch once the gate is open."""
+        self.entered.set()
+        self.gate.wait(5.0)
+        self.batches.append(records)
+
+    def close(self):
+        """Record the close."""
+        self.closed = True
+
+    @property
+    def records(self) -> list[JournalRecord]:
+        """Return every written record in order."""
+        return [record for batch in self.batches for record in batch]
+
+
+def _stall_writer(journal: BatchedJournalPort, sink: RecordingSink) -> None:
+    """Park the writer inside a sink write so the queue can fill up."""
+    journal.report_output(_output())
+    assert sink.entered.wait(5.0)
+
+
+class TestBatching:
+    """Test batched delivery and lifecycle."""
+
+    @pytest.mark.unit
+    def test_writes_entries_in_order_and_batches(self):
+        """Test entries reach the sink in enqueue order, split by batch_size."""
+        sink = RecordingSink()
+        journal = BatchedJournalPort(sink, batch_size=4, flush_interval_s=60.0)
+
+        for i in range(10):
+            journal.report_output(_output(i))
+        assert journal.flush()
+
+        assert [r.timestamp.second for r in sink.records] == list(range(10))
+        assert all(len(batch) <= 4 for batch in sink.batches)
+        metrics = journal.metrics()
+        assert metrics.written == 10
+        assert metrics.queue_depth == 0
+        assert metrics.batches == len(sink.batches)
+        assert metrics.max_flush_ms >= metrics.last_flush_ms >= 0.0
+        journal.close()
+
+    @pytest.mark.unit
+    def test_encoder_may_split_an_entry_into_several_records(self):
+        """Test a list returned by the encoder is written as consecutive records."""
+        sink = RecordingSink()
+
+        def encoder(kind, entry):
+            payload = json.dumps({"second": entry.timestamp.second})
+            return [JournalRecord(entry.timestamp, f"{kind}.{part}", payload) for part in "ab"]
+
+        journal = BatchedJournalPort(sink, flush_interval_s=60.0, encoder=encoder)
+        journal.report_output(_output(1))
+        journal.report_output(_output(2))
+        assert journal.flush()
+
+        assert [(r.kind, r.timestamp.second) for r in sink.records] == [
+            ("output.a", 1),
+            ("output.b", 1),
+            ("output.a", 2),
+            ("output.b", 2),
+        ]
+        metrics = journal.metrics()
+        assert (metrics.written, metrics.records_written, metrics.processed) == (2, 4, 2)
+        journal.close()
+
+    @pytest.mark.unit
+    def test_flush_waits_for_entries_not_records(self):
+        """Test a split entry's extra records do not count toward later entries."""
+
+        class SecondWriteStalls(RecordingSink):
+            def write(self, records):
+                if self.batches:
+                    super().write(records)
+                else:
+                    self.batches.append(records)
+
+        def encoder(kind, entry):
+            return [JournalRecord(entry.timestamp, kind, "{}", part) for part in range(3)]
+
+        sink = SecondWriteStalls(gated=True)
+        journal = BatchedJournalPort(sink, batch_size=1, flush_interval_s=60.0, encoder=encoder)
+        journal.report_output(_output(1))
+        journal.report_output(_output(2))
+        assert sink.entered.wait(5.0)
+
+        assert not journal.flush(timeout_s=0.1)
+        sink.gate.set()
+        assert journal.flush()
+        assert journal.metrics().written == 2
+        journal.close()
+
+    @pytest.mark.unit
+    def test_close_drains_queue_and_closes_sink(self):
+        """Test close writes pending entries and closes the sink on the writer."""
+        sink = RecordingSink()
+        journal = BatchedJournalPort(sink, batch_size=100, flush_interval_s=60.0)
+        journal.report_output(_output())
+
+        journal.close()
+        journal.report_output(_output())
+
+        assert len(sink.records) == 1
+        assert sink.closed
+        assert journal.metrics().dropped == 1
+
+    @pytest.mark.unit
+    def test_sink_failure_is_counted_not_raised(self):
+        """Test a failing sink does not stop the writer."""
+        sink = Mock(spec=JournalSink)
+        sink.write.side_effect = [OSError("disk full"), None]
+        journal = BatchedJournalPort(sink, batch_size=1, flush_interval_s=60.0)
+
+        journal.report_output(_output(1))
+        journal.report_output(_output(2))
+        assert journal.flush()
+
+        metrics = journal.metrics()
+        assert (metrics.failed, metrics.written) == (1, 1)
+        journal.close()
+
+    @pytest.mark.unit
+    def test_rejects_non_positive_sizes(self):
+        """Test queue and batch sizes must be positive."""
+        with pytest.raises(ValueError, match="must be positive"):
+            BatchedJournalPort(RecordingSink(), batch_size=0)
+
+
+class TestBackpressure:
+    """Test behavior when the sink falls behind."""
+
+    @pytest.mark.unit
+    def test_drop_discards_entries_when_full(self):
+        """Test DROP accepts up to capacity and counts the rest."""
+        sink = RecordingSink(gated=True)
+        journal = BatchedJournalPort(sink, max_queue_size=2, batch_size=1, flush_interval_s=60.0)
+        _stall_writer(journal, sink)
+
+        for i in range(5):
+            journal.report_output(_output(i))
+        depth = journal.metrics().queue_depth
+        sink.gate.set()
+        assert journal.flush()
+
+        metrics = journal.metrics()
+        assert depth == 2
+        assert metrics.dropped == 3
+        assert metrics.written == 3
+        journal.close()
+
+    @pytest.mark.unit
+    def test_sample_keeps_every_nth_entry_above_high_water(self):
+        """Test SAMPLE thins the stream once the queue passes its threshold."""
+        sink = RecordingSink(gated=True)
+        journal = BatchedJournalPort(
+            sink,
+            max_queue_size=10,
+            batch_size=1,
+            flush_interval_s=60.0,
+            policy=BackpressurePolicy.SAMPLE,
+            sample_every=3,
+            sample_threshold=0.2,
+        )
+        _stall_writer(journal, sink)
+
+        for i in range(20):
+            journal.report_output(_output(i))
+        sink.gate.set()
+        assert journal.flush()
+
+        metrics = journal.metrics()
+        assert metrics.sampled_out == 12
+        assert metrics.dropped == 0
+        assert metrics.written == 1 + 2 + 6
+        journal.close()
+
+    @pytest.mark.unit
+    def test_block_stalls_caller_until_space_frees(self):
+        """Test BLOCK holds the producer until the writer drains the queue."""
+        sink = RecordingSink(gated=True)
+        journal = BatchedJournalPort(
+            sink,
+            max_queue_size=1,
+            batch_size=1,
+            flush_interval_s=0.05,
+            policy=BackpressurePolicy.BLOCK,
+        )
+        _stall_writer(journal, sink)
+        journal.report_output(_output(1))
+
+        producer = threading.Thread(target=journal.report_output, args=(_output(2),))
+        producer.start()
+        producer.join(0.2)
+        blocked = producer.is_alive()
+        sink.gate.set()
+        producer.join(5.0)
+
+        assert blocked
+        assert not producer.is_alive()
+        assert journal.flush()
+        assert journal.metrics().written == 3
+        assert journal.metrics().dropped == 0
+        journal.close()
+
+    @pytest.mark.unit
+    def test_errors_bypass_policy(self):
+        """Test report_error is queued even when the queue is full."""
+        sink = RecordingSink(gated=True)
+        journal = BatchedJournalPort(sink, max_queue_size=1, batch_size=1, flush_interval_s=60.0)
+        _stall_writer(journal, sink)
+        journal.report_output(_output(1))
+
+        journal.report_error(
+            JournalError(timestamp=NOW, error=RuntimeError("boom"), engine_state=EngineState.ERROR)
+        )
+        sink.gate.set()
+        assert journal.flush()
+
+        assert [r.kind for r in sink.records] == ["output", "output", "error"]
+        assert json.loads(sink.records[-1].payload)["error"] == "RuntimeError: boom"
+        journal.close()
+
+
+class TestEncoding:
+    """Test journal entry serialization."""
+
+    @pytest.mark.unit
+    def test_encode_input_summarizes_history_on_request(self, fake_account_port):
+        """Test include_history=False replaces bars with per-symbol counts."""
+        entry = JournalInput(
+            timestamp=NOW,
+            historical_data=HistoricalOHLCV(
+                period="1D",
+                frequency="1m",
+                start=NOW,
+                end=NOW,
+                data={"AAPL": pd.DataFrame({"close": [1.0, 2.0, 3.0]})},
+            ),
+            quote_data=None,
+            account_data=fake_account_port.get_account(),
+            position_data=fake_account_port.get_positions(),
+            open_orders=Orders(timestamp=NOW, orders=[]),
+            portfolio_manager_state=None,
+            port_latency_ms={"quotes": 1.5},
+            order_status={UUID(int=7): OrderStatus.WORKING},
+        )
+
+        record = encode_entry("input", entry, include_history=False)
+        payload = json.loads(record.payload)
+
+        assert record.timestamp == NOW
+        assert payload["historical_data"] == {"AAPL": 3}
+        assert payload["account_data"]["cash"] == fake_account_port.get_account().cash
+        assert payload["port_latency_ms"] == {"quotes": 1.5}
+        assert payload["order_status"] == {str(UUID(int=7)): "WORKING"}
+
+
+class TestSinks:
+    """Test SQLite and InfluxDB sinks."""
+
+    @pytest.mark.integration
+    def test_sqlite_sink_persists_batches(self, tmp_path):
+        """Test records land in the journal table via the writer thread."""
+        db_path = str(tmp_path / "journal.db")
+        sink = SQLiteJournalSink(BaseSQLiteClient(SQLiteConfig(db_path=db_path)))
+        journal = BatchedJournalPort(sink, batch_size=2, flush_interval_s=60.0)
+
+        for i in range(3):
+            journal.report_output(_output(i))
+        journal.close()
+
+        with BaseSQLiteClient(SQLiteConfig(db_path=db_path)) as client:
+            rows = client.fetchall("SELECT timestamp, kind FROM journal ORDER BY id")
+        assert [row["kind"] for row in rows] == ["output"] * 3
+        assert rows[0]["timestamp"] == NOW.isoformat()
+
+    @pytest.mark.unit
+    def test_influxdb_sink_writes_escaped_line_protocol(self):
+        """Test records become tagged points with an escaped payload field."""
+        client = Mock()
+        sink = InfluxDBJournalSink(client, measurement="journal")
+        record = JournalRecord(timestamp=NOW, kind="output", payload='{"a": "b\\\\c"}')
+
+        sink.write([record])
+        sink.close()
+
+        (line,) = client.client.write.call_args.kwargs["record"]
+        assert line == (
+            'journal,kind=output payload="{\\"a\\": \\"b\\\\\\\\c\\"}" '
+            f"{int(NOW.timestamp()) * 1_000_000_000}"
+        )
+        client.close.assert_called_once()
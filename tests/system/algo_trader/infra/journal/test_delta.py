@@ -0,0 +1,383 @@
+"""Unit tests for the delta-encoded journal format.
+
+Tests cover keyframe cadence, delta contents for rolling bar windows, quotes,
+positions, open orders and order status, NaN and in-place changes, exact
+reconstruction for DataFrame and columnar inputs, random access, gap handling,
+the JSON frame encoding, frames split across records, and the
+BatchedJournalPort integration.
+"""
+
+import json
+from dataclasses import replace
+from datetime import datetime, timedelta, timezone
+from uuid import UUID
+
+import numpy as np
+import pandas as pd
+import pytest
+
+from infrastructure.config import SQLiteConfig
+from infrastructure.sqlite.sqlite import BaseSQLiteClient
+from system.algo_trader.domain.models import (
+    Account,
+    HistoricalOHLCV,
+    JournalInput,
+    MarketOrder,
+    OHLCVPanel,
+    Orders,
+    PortfolioManager,
+    Position,
+    Positions,
+    Quote,
+    QuoteBatch,
+)
+from system.algo_trader.domain.states import (
+    OrderDuration,
+    OrderInstruction,
+    OrderStatus,
+    OrderTaxLotMethod,
+    OrderType,
+    TradingState,
+)
+from system.algo_trader.infra.journal.batched_journal import BatchedJournalPort
+from system.algo_trader.infra.journal.delta import (
+    DELTA_KIND,
+    KEY_KIND,
+    PART_KIND,
+    DeltaEncoder,
+    DeltaJournalEncoder,
+    DeltaJournalReader,
+    decode_frame,
+    encode_frame,
+)
+from system.algo_trader.infra.journal.sinks import SQLiteJournalSink, _line_protocol
+
+START = datetime(2024, 1, 2, 14, 30, tzinfo=timezone.utc)
+WINDOW = 5
+
+
+def _bars(tick: int) -> HistoricalOHLCV:
+    """Rolling WINDOW-bar history per symbol ending at the given tick."""
+    index = pd.date_range(START + timedelta(minutes=tick), periods=WINDOW, freq="min")
+    data = {}
+    for offset, symbol in enumerate(("AAPL", "MSFT")):
+        closes = np.arange(tick, tick + WINDOW, dtype=np.float64) + 100.0 * offset
+        data[symbol] = pd.DataFrame(
+            {"close": closes, "volume": np.full(WINDOW, 1_000.0)}, index=index
+        )
+    return HistoricalOHLCV(period="1D", frequency="1m", start=index[0], end=index[-1], data=data)
+
+
+def _order(n: int) -> MarketOrder:
+    return MarketOrder(
+        id=UUID(int=n),
+        timestamp=START,
+        symbol="AAPL",
+        quantity=10 * n,
+        order_type=OrderType.MARKET,
+        order_instruction=OrderInstruction.BUY_TO_OPEN,
+        order_duration=OrderDuration.DAY,
+        order_tax_lot_method=OrderTaxLotMethod.FIFO,
+    )
+
+
+def _input(tick: int, history: HistoricalOHLCV | OHLCVPanel | None = None) -> JournalInput:
+    """Journal input whose quotes move every tick and positions every third tick.
+
+    The first open order alternates between WORKING and PARTIALLY_FILLED.
+    """
+    now = START + timedelta(minutes=tick)
+    held = tick // 3
+    positions = [Position(START, "AAPL", 10 + held, 100.0, 100.0, 0.0, 1000.0)]
+    if tick >= 4:
+        positions.append(Position(START, "MSFT", 5, 200.0, 200.0, 0.0, 1000.0))
+    orders = [_order(n) for n in range(tick % 4)]
+    last = {"AAPL": 100.0 + tick, "MSFT": 200.0}
+    quote = Quote(now, "EQUITY", last, last, {}, {}, last, {}, {}, {})
+    return JournalInput(
+        timestamp=now,
+        historical_data=history if history is not None else _bars(tick),
+        quote_data=quote,
+        account_data=Account(START, 10_000.0, 20_000.0, 0.0, 10_000.0, 0.0),
+        position_data=Positions(timestamp=START, positions=positions),
+        open_orders=Orders(timestamp=START, orders=orders),
+        portfolio_manager_state=PortfolioManager(START, TradingState.NEUTRAL, 100.0, 10.0),
+        port_latency_ms={"quotes": float(tick)},
+        order_status={
+            order.id: OrderStatus.PARTIALLY_FILLED if tick % 2 and i == 0 else OrderStatus.WORKING
+            for i, order in enumerate(orders)
+        },
+    )
+
+
+def _assert_same(actual: JournalInput, expected: JournalInput) -> None:
+    """Compare inputs field by field, using DataFrame.equals for bars."""
+    for name in ("timestamp", "account_data", "position_data", "open_orders"):
+        assert getattr(actual, name) == getattr(expected, name), name
+    assert actual.portfolio_manager_state == expected.portfolio_manager_state
+    assert actual.port_latency_ms == expected.port_latency_ms
+    assert actual.order_status == expected.order_status
+
+    a_hist, e_hist = actual.historical_data, expected.historical_data
+    if isinstance(e_hist, OHLCVPanel):
+        assert a_hist.symbols == e_hist.symbols
+        np.testing.assert_array_equal(a_hist.offsets, e_hist.offsets)
+        np.testing.assert_array_equal(a_hist.index, e_hist.index)
+        for name, values in e_hist.columns.items():
+            np.testing.assert_array_equal(a_hist.columns[name], values)
+    else:
+        assert list(a_hist.data) == list(e_hist.data)
+        for symbol, frame in e_hist.data.items():
+            assert a_hist.data[symbol].equals(frame)
+            assert a_hist.data[symbol].index.equals(frame.index)
+            assert a_hist.data[symbol].dtypes.equals(frame.dtypes)
+    assert (a_hist.start, a_hist.end) == (e_hist.start, e_hist.end)
+
+    a_quote, e_quote = actual.quote_data, expected.quote_data
+    if isinstance(e_quote, QuoteBatch):
+        assert a_quote.symbols == e_quote.symbols
+        np.testing.assert_array_equal(a_quote.values, e_quote.values)
+        assert a_quote.timestamp == e_quote.timestamp
+    else:
+        assert a_quote == e_quote
+
+
+class TestDeltaEncoder:
+    """Test frame contents."""
+
+    @pytest.mark.unit
+    def test_keyframe_every_interval(self):
+        """Test keyframes at the first frame and then every interval."""
+        encoder = DeltaEncoder(keyframe_interval=3)
+
+        frames = [encoder.encode(_input(tick)) for tick in range(7)]
+
+        assert [frame["key"] for frame in frames] == [True, False, False, True, False, False, True]
+        assert [frame["seq"] for frame in frames] == list(range(7))
+
+    @pytest.mark.unit
+    def test_delta_carries_only_changes(self):
+        """Test a rolling window sends one new bar and unchanged fields are omitted."""
+        encoder = DeltaEncoder(keyframe_interval=100)
+        encoder.encode(_input(0))
+
+        frame = encoder.encode(_input(1))
+
+        op, diff = frame["historical_data"]
+        assert op == "frames"
+        for symbol in ("AAPL", "MSFT"):
+            kind, (drop, new_rows) = diff["changes"][symbol]
+            assert (kind, drop, len(new_rows)) == ("append", 1, 1)
+        assert "account_data" not in frame
+        assert "portfolio_manager_state" not in frame
+        assert "position_data" not in frame
+        _, quote_diff = frame["quote_data"]
+        assert quote_diff["last"] == ("update", {"AAPL": 101.0})
+
+    @pytest.mark.unit
+    def test_order_transitions_are_keyed_by_id(self):
+        """Test open-order deltas list the new order set and only new orders."""
+        encoder = DeltaEncoder(keyframe_interval=100)
+        encoder.encode(_input(1))
+
+        frame = encoder.encode(_input(2))
+
+        _, (attr, diff) = frame["open_orders"]
+        assert attr == "orders"
+        assert diff["keys"] == [UUID(int=0), UUID(int=1)]
+        assert list(diff["changes"]) == [UUID(int=1)]
+
+    @pytest.mark.unit
+    def test_order_status_transition_on_same_order(self):
+        """Test a status change of an order that stays open is sent per order."""
+        encoder = DeltaEncoder(keyframe_interval=100)
+        entry = _input(2)
+        encoder.encode(entry)
+        status = {**entry.order_status, UUID(int=0): OrderStatus.PARTIALLY_FILLED}
+
+        frame = encoder.encode(replace(entry, order_status=status))
+
+        assert "open_orders" not in frame
+        assert frame["order_status"] == ("map", ({UUID(int=0): OrderStatus.PARTIALLY_FILLED}, []))
+
+    @pytest.mark.unit
+    def test_in_place_changes_are_not_lost(self):
+        """Test orders and quotes mutated in place between ticks still produce deltas."""
+        encoder = DeltaEncoder(keyframe_interval=100)
+        entry = _input(2)
+        encoder.encode(entry)
+        entry.open_orders.orders[1].quantity = 99
+        entry.quote_data.bid["MSFT"] = 199.5
+
+        frame = encoder.encode(entry)
+
+        _, (_, diff) = frame["open_orders"]
+        assert diff["changes"] == {UUID(int=1): ("fields", {"quantity": 99})}
+        _, quote_diff = frame["quote_data"]
+        assert quote_diff["bid"] == ("update", {"MSFT": 199.5})
+
+    @pytest.mark.unit
+    def test_nan_quotes_are_unchanged(self):
+        """Test a quote that stays NaN is not resent every tick."""
+        encoder = DeltaEncoder(keyframe_interval=100)
+        nan = {"AAPL": float("nan")}
+        quote = Quote(START, "EQUITY", nan, nan, {}, {}, nan, {}, {}, {})
+        entry = replace(_input(1), quote_data=quote)
+        encoder.encode(entry)
+
+        frame = encoder.encode(replace(entry, quote_data=replace(entry.quote_data, bid=dict(nan))))
+
+        assert "quote_data" not in frame
+
+    @pytest.mark.unit
+    def test_rejects_non_positive_interval(self):
+        """Test the keyframe interval must be positive."""
+        with pytest.raises(ValueError, match="must be positive"):
+            DeltaEncoder(keyframe_interval=0)
+
+
+class TestDeltaJournalReader:
+    """Test reconstruction of full inputs."""
+
+    @pytest.mark.unit
+    def test_round_trip_dataframe_history(self):
+        """Test every tick is rebuilt exactly from keyframes and deltas."""
+        encoder = DeltaEncoder(keyframe_interval=4)
+        inputs = [_input(tick) for tick in range(10)]
+
+        reader = DeltaJournalReader([encoder.encode(entry) for entry in inputs])
+        rebuilt = list(reader)
+
+        assert len(rebuilt) == len(inputs)
+        for actual, expected in zip(rebuilt, inputs, strict=True):
+            _assert_same(actual, expected)
+
+    @pytest.mark.unit
+    def test_round_trip_columnar_inputs(self):
+        """Test OHLCVPanel and QuoteBatch inputs are rebuilt exactly."""
+        encoder = DeltaEncoder(keyframe_interval=100)
+        inputs = []
+        for tick in range(6):
+            entry = _input(tick, history=OHLCVPanel.from_historical(_bars(tick)))
+            inputs.append(replace(entry, quote_data=QuoteBatch.from_quote(entry.quote_data)))
+
+        reader = DeltaJournalReader([encoder.encode(entry) for entry in inputs])
+
+        for actual, expected in zip(reader, inputs, strict=True):
+            _assert_same(actual, expected)
+
+    @pytest.mark.unit
+    def test_at_replays_from_nearest_keyframe(self):
+        """Test random access matches sequential replay."""
+        encoder = DeltaEncoder(keyframe_interval=4)
+        inputs = [_input(tick) for tick in range(10)]
+        reader = DeltaJournalReader([encoder.encode(entry) for entry in inputs])
+
+        _assert_same(reader.at(6), inputs[6])
+        _assert_same(reader.at(0), inputs[0])
+        with pytest.raises(KeyError):
+            reader.at(42)
+
+    @pytest.mark.unit
+    def test_gap_skips_until_next_keyframe(self):
+        """Test a missing delta invalidates frames up to the next keyframe."""
+        encoder = DeltaEncoder(keyframe_interval=4)
+        frames = [encoder.encode(_input(tick)) for tick in range(8)]
+        del frames[2]
+
+        reader = DeltaJournalReader(frames)
+
+        assert [entry.timestamp.minute for entry in reader] == [30, 31, 34, 35, 36, 37]
+        with pytest.raises(KeyError, match="not reachable"):
+            reader.at(3)
+
+
+class TestFrameEncoding:
+    """Test frame serialization."""
+
+    @pytest.mark.unit
+    def test_frames_are_json_and_round_trip(self):
+        """Test keyframes and deltas serialize to JSON and decode to equal inputs."""
+        encoder = DeltaEncoder(keyframe_interval=100)
+        inputs = [_input(tick) for tick in range(5)]
+        payloads = [encode_frame(encoder.encode(entry)) for entry in inputs]
+
+        assert all(isinstance(json.loads(payload), dict) for payload in payloads)
+        reader = DeltaJournalReader([decode_frame(payload) for payload in payloads])
+        for actual, expected in zip(reader, inputs, strict=True):
+            _assert_same(actual, expected)
+
+    @pytest.mark.unit
+    def test_decode_rejects_non_domain_types(self):
+        """Test a payload cannot name a type outside the domain models."""
+        payload = json.dumps({"$t": "dataclass", "cls": "Popen", "v": {"args": "true"}})
+
+        with pytest.raises(ValueError, match="unknown type"):
+            decode_frame(payload)
+
+
+class TestDeltaJournalEncoder:
+    """Test the BatchedJournalPort integration."""
+
+    @pytest.mark.unit
+    def test_large_frames_are_split_and_reassembled(self):
+        """Test frames over max_payload_bytes span part records that rebuild exactly."""
+        encoder = DeltaJournalEncoder(keyframe_interval=3, max_payload_bytes=1_000)
+        inputs = [_input(tick) for tick in range(4)]
+        records = []
+        for entry in inputs:
+            encoded = encoder("input", entry)
+            records.extend(encoded if isinstance(encoded, list) else [encoded])
+
+        assert records[0].kind == PART_KIND
+        assert all(len(record.payload) <= 1_000 for record in records)
+        for actual, expected in zip(
+            DeltaJournalReader.from_records(records), inputs, strict=True
+        ):
+            _assert_same(actual, expected)
+
+        # Losing one part drops its keyframe and the deltas that depend on it
+        del records[0]
+        rebuilt = list(DeltaJournalReader.from_records(records))
+        assert [entry.timestamp for entry in rebuilt] == [inputs[3].timestamp]
+
+    @pytest.mark.unit
+    def test_split_parts_are_distinct_influxdb_points(self):
+        """Test every part of a split frame gets its own InfluxDB series key."""
+        encoder = DeltaJournalEncoder(keyframe_interval=3, max_payload_bytes=1_000)
+        records = encoder("input", _input(0))
+        lines = [_line_protocol("journal", record) for record in records]
+
+        keys = {(line.split(" ", 1)[0], line.rsplit(" ", 1)[1]) for line in lines}
+        assert len(records) > 1
+        assert len(keys) == len(records)
+
+    @pytest.mark.unit
+    def test_rejects_payload_limit_without_room_for_header(self):
+        """Test the payload limit must leave room for the part header."""
+        with pytest.raises(ValueError, match="must exceed"):
+            DeltaJournalEncoder(max_payload_bytes=10)
+
+    @pytest.mark.integration
+    def test_sqlite_journal_round_trip(self, tmp_path):
+        """Test inputs written through the port are rebuilt from SQLite."""
+        db_path = str(tmp_path / "journal.db")
+        journal = BatchedJournalPort(
+            SQLiteJournalSink(BaseSQLiteClient(SQLiteConfig(db_path=db_path))),
+            batch_size=4,
+            flush_interval_s=60.0,
+            encoder=DeltaJournalEncoder(keyframe_interval=3),
+        )
+        inputs = [_input(tick) for tick in range(7)]
+
+        for entry in inputs:
+            journal.report_input(entry)
+        journal.close()
+
+        with BaseSQLiteClient(SQLiteConfig(db_path=db_path)) as client:
+            kinds = [row["kind"] for row in client.fetchall("SELECT kind FROM journal")]
+            reader = DeltaJournalReader.from_sqlite(client)
+        assert kinds.count(KEY_KIND) == 3
+        assert kinds.count(DELTA_KIND) == 4
+        for actual, expected in zip(reader, inputs, strict=True):
+            _assert_same(actual, expected)
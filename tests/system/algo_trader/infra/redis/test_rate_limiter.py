@@ -0,0 +1,312 @@
+"""Unit tests for SharedRateLimiter - Redis-shared adaptive rate limiting.
+
+Tests cover endpoint classification, one budget shared by several limiters,
+refill on the Redis clock, AIMD feedback with its cooldown, the local
+fallback when Redis fails or stays contended, and metrics reporting.
+All Redis operations run against an in-memory fake to avoid requiring a
+Redis server.
+"""
+
+import threading
+from unittest.mock import patch
+
+import pytest
+from redis.exceptions import WatchError
+
+from system.algo_trader.infra.redis.rate_limiter import (
+    EndpointClass,
+    RateLimitConfig,
+    SharedRateLimiter,
+    classify_request,
+)
+
+MARKET = EndpointClass.MARKET_DATA
+CONFIG = RateLimitConfig(
+    initial_rate=1.0,
+    min_rate=0.2,
+    max_rate=2.0,
+    capacity=2.0,
+    increase_step=0.1,
+    decrease_factor=0.5,
+    decrease_cooldown_s=5.0,
+)
+
+
+class FakeRedis:
+    """In-memory hashes with WATCH/MULTI semantics and a settable clock."""
+
+    def __init__(self):
+        self.hashes: dict[str, dict[bytes, bytes]] = {}
+        self.versions: dict[str, int] = {}
+        self.now = 1_000.0
+        self.conflicts = 0
+        self.fail = False
+        self.lock = threading.Lock()
+
+    def pipeline(self):
+        if self.fail:
+            raise ConnectionError("redis down")
+        return FakePipeline(self)
+
+
+class FakePipeline:
+    """Pipeline that raises WatchError when a watched key changed."""
+
+    def __init__(self, redis: FakeRedis):
+        self.redis = redis
+        self.watched: dict[str, int] = {}
+        self.commands: list[tuple] = []
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        return False
+
+    def watch(self, key):
+        self.watched = {key: self.redis.versions.get(key, 0)}
+        self.commands = []
+
+    def hgetall(self, key):
+        return dict(self.redis.hashes.get(key, {}))
+
+    def time(self):
+        seconds = int(self.redis.now)
+        return seconds, int(round((self.redis.now - seconds) * 1e6))
+
+    def multi(self):
+        pass
+
+    def hset(self, key, mapping):
+        self.commands.append((key, mapping))
+
+    def expire(self, key, seconds):
+        pass
+
+    def execute(self):
+        with self.redis.lock:
+            if self.redis.conflicts:
+                self.redis.conflicts -= 1
+                raise WatchError("watched key changed")
+            for key, version in self.watched.items():
+                if self.redis.versions.get(key, 0) != version:
+                    raise WatchError("watched key changed")
+            for key, mapping in self.commands:
+                stored = self.redis.hashes.setdefault(key, {})
+                stored.update({k.encode(): str(v).encode() for k, v in mapping.items()})
+                self.redis.versions[key] = self.redis.versions.get(key, 0) + 1
+
+
+@pytest.fixture
+def fake_redis():
+    """Fixture for one fake Redis server."""
+    return FakeRedis()
+
+
+@pytest.fixture
+def make_limiter(fake_redis):
+    """Fixture building limiters that share fake_redis and record sleeps."""
+
+    def build(**kwargs):
+        sleeps = []
+        with patch("infrastructure.redis.redis.redis") as mock_redis_module:
+            mock_redis_module.Redis.return_value = fake_redis
+            limiter = SharedRateLimiter(configs={MARKET: CONFIG}, sleep=sleeps.append, **kwargs)
+        return limiter, sleeps
+
+    return build
+
+
+class TestClassifyRequest:
+    """Test endpoint classification."""
+
+    @pytest.mark.unit
+    def test_classifies_schwab_urls(self):
+        """Test market data, order writes and other trader calls are separated."""
+        base = "https://api.schwabapi.com"
+        orders = f"{base}/trader/v1/accounts/HASH/orders"
+
+        assert classify_request("GET", f"{base}/marketdata/v1/quotes") == MARKET
+        assert classify_request("post", orders) == EndpointClass.ORDERS
+        assert classify_request("DELETE", f"{orders}/1") == EndpointClass.ORDERS
+        assert classify_request("GET", orders) == EndpointClass.ACCOUNTS
+        assert classify_request("GET", f"{base}/trader/v1/accounts") == EndpointClass.ACCOUNTS
+
+
+class TestSharedBudget:
+    """Test the token bucket kept in Redis."""
+
+    @pytest.mark.unit
+    def test_limiters_share_one_bucket(self, make_limiter):
+        """Test a burst drawn by one limiter makes another wait."""
+        first, first_sleeps = make_limiter()
+        second, second_sleeps = make_limiter()
+
+        assert first.acquire(MARKET) == 0.0
+        assert first.acquire(MARKET) == 0.0
+        assert second.acquire(MARKET) == pytest.approx(1.0)
+        assert second.acquire(MARKET) == pytest.approx(2.0)
+
+        assert first_sleeps == []
+        assert second_sleeps == [pytest.approx(1.0), pytest.approx(2.0)]
+        stats = {s.endpoint: s for s in second.stats()}[MARKET]
+        assert (stats.requests, stats.waits) == (2, 2)
+        assert stats.wait_s_total == pytest.approx(3.0)
+        assert stats.wait_s_max == pytest.approx(2.0)
+
+    @pytest.mark.unit
+    def test_refills_on_redis_clock(self, make_limiter, fake_redis):
+        """Test tokens accrue from the server time, up to capacity."""
+        limiter, _ = make_limiter()
+        limiter.acquire(MARKET)
+        limiter.acquire(MARKET)
+
+        fake_redis.now += 60.0
+
+        assert limiter.acquire(MARKET) == 0.0
+        assert limiter.acquire(MARKET) == 0.0
+        assert limiter.acquire(MARKET) == pytest.approx(1.0)
+
+    @pytest.mark.unit
+    def test_endpoint_classes_are_independent(self, make_limiter):
+        """Test draining one class leaves the others untouched."""
+        limiter, sleeps = make_limiter()
+        for _ in range(3):
+            limiter.acquire(MARKET)
+
+        assert limiter.acquire(EndpointClass.ACCOUNTS) == 0.0
+        assert len(sleeps) == 1
+
+
+class TestAimd:
+    """Test rate adaptation from response feedback."""
+
+    @pytest.mark.unit
+    def test_throttle_halves_rate_once_per_cooldown(self, make_limiter, fake_redis):
+        """Test a burst of 429s counts once and later throttles count again."""
+        first, _ = make_limiter()
+        second, _ = make_limiter()
+
+        first.record(MARKET, 429)
+        second.record(MARKET, 503)
+
+        assert first.rate(MARKET) == pytest.approx(0.5)
+        assert second.rate(MARKET) == pytest.approx(0.5)
+        assert second.acquire(MARKET) == pytest.approx(2.0)
+
+        fake_redis.now += CONFIG.decrease_cooldown_s
+        for _ in range(5):
+            first.record(MARKET, 429)
+            fake_redis.now += CONFIG.decrease_cooldown_s
+
+        assert first.rate(MARKET) == pytest.approx(CONFIG.min_rate)
+        assert {s.endpoint: s for s in first.stats()}[MARKET].throttled == 6
+
+    @pytest.mark.unit
+    def test_throttle_drops_burst_banked_while_idle(self, make_limiter, fake_redis):
+        """Test idle time before a 429 is not credited again at the new rate."""
+        limiter, _ = make_limiter()
+        limiter.acquire(MARKET)
+        limiter.acquire(MARKET)
+
+        fake_redis.now += 60.0
+        limiter.record(MARKET, 429)
+
+        assert limiter.acquire(MARKET) == pytest.approx(2.0)
+
+    @pytest.mark.unit
+    def test_successes_increase_rate_up_to_max(self, make_limiter):
+        """Test each success adds increase_step on the next acquire, capped."""
+        limiter, _ = make_limiter()
+        limiter.acquire(MARKET)
+        for _ in range(5):
+            limiter.record(MARKET, 200)
+
+        limiter.acquire(MARKET)
+        assert limiter.rate(MARKET) == pytest.approx(1.5)
+
+        for _ in range(50):
+            limiter.record(MARKET, 200)
+        limiter.acquire(MARKET)
+        assert limiter.rate(MARKET) == pytest.approx(CONFIG.max_rate)
+
+    @pytest.mark.unit
+    def test_throttle_discards_pending_increase(self, make_limiter):
+        """Test successes queued before a 429 are not applied afterwards."""
+        limiter, _ = make_limiter()
+        for _ in range(5):
+            limiter.record(MARKET, 200)
+        limiter.record(MARKET, 429)
+
+        limiter.acquire(MARKET)
+
+        assert limiter.rate(MARKET) == pytest.approx(0.5)
+
+    @pytest.mark.unit
+    def test_client_errors_and_missing_responses_are_ignored(self, make_limiter, fake_redis):
+        """Test 4xx other than 429 and network failures leave the rate alone."""
+        limiter, _ = make_limiter()
+
+        limiter.record(MARKET, 404)
+        limiter.record(MARKET, None)
+
+        assert fake_redis.hashes == {}
+        assert limiter.rate(MARKET) == CONFIG.initial_rate
+
+
+class TestFallback:
+    """Test behavior when Redis cannot be used."""
+
+    @pytest.mark.unit
+    def test_redis_failure_uses_local_bucket(self, make_limiter, fake_redis):
+        """Test requests are admitted at min_rate while Redis is down."""
+        limiter, _ = make_limiter()
+        fake_redis.fail = True
+
+        limiter.acquire(MARKET)
+        wait = limiter.acquire(MARKET)
+
+        assert wait == pytest.approx(1 / CONFIG.min_rate, rel=0.05)
+        stats = {s.endpoint: s for s in limiter.stats()}[MARKET]
+        assert (stats.requests, stats.fallbacks) == (2, 2)
+        assert stats.rate == CONFIG.min_rate
+
+    @pytest.mark.unit
+    def test_contention_retries_then_falls_back(self, make_limiter, fake_redis):
+        """Test WatchError retries succeed, and persistent contention falls back."""
+        limiter, _ = make_limiter(max_watch_retries=3)
+
+        fake_redis.conflicts = 2
+        limiter.acquire(MARKET)
+        fake_redis.conflicts = 3
+        limiter.acquire(MARKET)
+
+        stats = {s.endpoint: s for s in limiter.stats()}[MARKET]
+        assert (stats.requests, stats.fallbacks) == (2, 1)
+
+
+class TestMetrics:
+    """Test metrics reporting."""
+
+    @pytest.mark.unit
+    def test_sink_receives_stats_snapshots(self, make_limiter):
+        """Test the sink gets stats for every endpoint class."""
+        reports = []
+        limiter, _ = make_limiter(metrics_sink=reports.append, metrics_interval_s=0.0)
+
+        limiter.acquire(MARKET)
+
+        assert len(reports) == 1
+        assert {s.endpoint for s in reports[0]} == set(EndpointClass)
+        assert {s.endpoint: s for s in reports[0]}[MARKET].requests == 1
+
+    @pytest.mark.unit
+    def test_sink_failures_are_swallowed(self, make_limiter):
+        """Test a raising sink does not fail the request."""
+
+        def broken_sink(stats):
+            raise OSError("disk full")
+
+        limiter, _ = make_limiter(metrics_sink=broken_sink, metrics_interval_s=0.0)
+
+        assert limiter.acquire(MARKET) == 0.0
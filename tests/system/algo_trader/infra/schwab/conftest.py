@@ -38,6 +38,8 @@ def mock_account_broker():
     """Fixture to mock AccountBroker."""
     with patch("system.algo_trader.infra.schwab.schwab_client.AccountBroker") as mock_broker_class:
         mock_broker = MagicMock()
+        # Unknown token expiry, so SchwabClient does not cache tokens across calls
+        mock_broker.get_access_token_ttl.return_value = -2
         mock_broker_class.return_value = mock_broker
         yield mock_broker
 
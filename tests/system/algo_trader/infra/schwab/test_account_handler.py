@@ -258,6 +258,36 @@ class TestAccountHandlerPositionMethods:
 
         assert result["positions"] == []
 
+    def test_get_positions_snapshot(self, mock_dependencies):
+        """Test positions are decoded from the response body into Positions."""
+        mock_response = MagicMock()
+        mock_response.status_code = 200
+        mock_response.content = (
+            b'{"positions": [{"instrument": {"symbol": "AAPL"}, "longQuantity": 100,'
+            b' "averagePrice": 150.0, "marketValue": 16000.0, "longOpenProfitLoss": 1000.0}]}'
+        )
+
+        handler = AccountHandler()
+        handler.make_authenticated_request = Mock(return_value=mock_response)
+
+        result = handler.get_positions_snapshot("123456")
+
+        [position] = result.positions
+        assert (position.symbol, position.quantity, position.current_price) == ("AAPL", 100, 160.0)
+        assert position.pnl_open == 1000.0
+        mock_response.json.assert_not_called()
+
+    def test_get_positions_snapshot_failure(self, mock_dependencies):
+        """Test a failed snapshot request returns None."""
+        mock_response = MagicMock()
+        mock_response.status_code = 403
+        mock_response.text = "Forbidden"
+
+        handler = AccountHandler()
+        handler.make_authenticated_request = Mock(return_value=mock_response)
+
+        assert handler.get_positions_snapshot("123456") is None
+
 
 class TestAccountHandlerOrderMethods:
     """Test order management methods."""
@@ -0,0 +1,145 @@
+"""Unit tests for SchwabBarSource - Incremental Schwab price history.
+
+Tests cover candle conversion, the full-window request on a cache miss,
+startDate/endDate requests for incremental refreshes, failed requests, and
+CachingHistoricalPort refreshing a window through the source.
+"""
+
+from datetime import datetime, timezone
+from unittest.mock import MagicMock
+
+import pytest
+
+from system.algo_trader.infra.cache.historical_cache import CachingHistoricalPort
+from system.algo_trader.infra.schwab.bar_source import SchwabBarSource, candles_to_frame
+from system.algo_trader.infra.schwab.market_handler import MarketHandler
+from system.algo_trader.infra.schwab.timescale_enum import FrequencyType, PeriodType
+
+DAY_MS = 86_400_000
+START_MS = 1_704_153_600_000  # 2024-01-02T00:00:00Z
+NOW = datetime(2024, 1, 10, tzinfo=timezone.utc)
+
+
+def _candles(first: int, count: int) -> list[dict]:
+    return [
+        {
+            "datetime": START_MS + i * DAY_MS,
+            "open": 100.0 + i,
+            "high": 101.0 + i,
+            "low": 99.0 + i,
+            "close": 100.5 + i,
+            "volume": 1000 + i,
+        }
+        for i in range(first, first + count)
+    ]
+
+
+class FakeHistory:
+    """get_price_history stand-in serving candles from a growing history."""
+
+    def __init__(self, count: int):
+        """Initialize with count daily candles."""
+        self.candles = _candles(0, count)
+        self.calls = []
+
+    def __call__(self, symbol, *args, start_date=None, end_date=None):
+        """Return candles at or after start_date, like the pricehistory endpoint."""
+        self.calls.append((symbol, args, start_date, end_date))
+        if start_date is None:
+            return {"symbol": symbol, "candles": list(self.candles)}
+        start_ms = int(start_date.timestamp() * 1000)
+        return {"symbol": symbol, "candles": [c for c in self.candles if c["datetime"] >= start_ms]}
+
+
+@pytest.fixture
+def handler():
+    """Fixture for a MarketHandler double whose history can grow."""
+    market_handler = MagicMock(spec=MarketHandler)
+    market_handler.get_price_history.side_effect = FakeHistory(5)
+    return market_handler
+
+
+class TestCandlesToFrame:
+    """Test Schwab candle conversion."""
+
+    @pytest.mark.unit
+    def test_builds_utc_ohlcv_frame(self):
+        """Test candles become float OHLCV columns on a UTC index."""
+        frame = candles_to_frame({"candles": list(reversed(_candles(0, 2)))})
+
+        assert list(frame.columns) == ["open", "high", "low", "close", "volume"]
+        assert str(frame.index.tz) == "UTC"
+        assert frame.index[0] == datetime(2024, 1, 2, tzinfo=timezone.utc)
+        assert frame["close"].tolist() == [100.5, 101.5]
+        assert frame["volume"].dtype == float
+
+    @pytest.mark.unit
+    def test_empty_history(self):
+        """Test an empty response yields an empty frame with OHLCV columns."""
+        frame = candles_to_frame({"candles": [], "empty": True})
+
+        assert frame.empty
+        assert list(frame.columns) == ["open", "high", "low", "close", "volume"]
+
+
+class TestSchwabBarSource:
+    """Test full-window and incremental requests."""
+
+    @pytest.mark.unit
+    def test_full_window_without_since(self, handler):
+        """Test a cache miss requests the configured period window."""
+        source = SchwabBarSource(handler, PeriodType.MONTH, 1)
+
+        frame = source.get_bars("AAPL", "1D", since=None)
+
+        assert len(frame) == 5
+        ((symbol, args, start, end),) = handler.get_price_history.side_effect.calls
+        assert (symbol, start, end) == ("AAPL", None, None)
+        assert args == (PeriodType.MONTH, 1, FrequencyType.DAILY, 1, False)
+
+    @pytest.mark.unit
+    def test_since_requests_start_and_end_dates(self, handler):
+        """Test a refresh sends startDate and endDate and returns only newer bars."""
+        source = SchwabBarSource(handler, clock=lambda: NOW)
+        since = datetime(2024, 1, 5)
+
+        frame = source.get_bars("AAPL", "5m", since=since)
+
+        assert len(frame) == 2
+        assert frame.index[0] == datetime(2024, 1, 5, tzinfo=timezone.utc)
+        (_, args, start, end) = handler.get_price_history.side_effect.calls[-1]
+        assert args[2:4] == (FrequencyType.MINUTE, 5)
+        assert start == since.replace(tzinfo=timezone.utc)
+        assert end == NOW
+
+    @pytest.mark.unit
+    def test_failed_request_raises(self, handler):
+        """Test an error response raises instead of returning an empty window."""
+        handler.get_price_history.side_effect = None
+        handler.get_price_history.return_value = {"_error_status": 500}
+
+        with pytest.raises(ConnectionError, match="500"):
+            SchwabBarSource(handler).get_bars("AAPL", "1D", since=None)
+
+    @pytest.mark.unit
+    def test_unknown_frequency_rejected(self, handler):
+        """Test frequencies without a Schwab equivalent are rejected."""
+        with pytest.raises(ValueError, match="Unsupported"):
+            SchwabBarSource(handler).get_bars("AAPL", "2h", since=None)
+
+    @pytest.mark.unit
+    def test_caching_port_fetches_only_new_bars(self, handler):
+        """Test CachingHistoricalPort over the source refreshes with a few candles."""
+        history = handler.get_price_history.side_effect
+        port = CachingHistoricalPort(
+            SchwabBarSource(handler, clock=lambda: NOW), ["AAPL"], "1Y", "1D", window_bars=10
+        )
+        port.get_data()
+        history.candles.extend(_candles(5, 2))
+
+        data = port.get_data()
+
+        assert len(data.data["AAPL"]) == 7
+        assert port.get_stats() == {"hits": 1, "misses": 1, "bars_fetched": 8}
+        _, _, start, _ = history.calls[-1]
+        assert start == datetime(2024, 1, 6, tzinfo=timezone.utc)
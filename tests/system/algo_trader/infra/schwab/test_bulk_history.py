@@ -0,0 +1,187 @@
+"""Unit tests for BulkPriceHistoryDownloader - Bulk price-history backfills.
+
+Tests cover concurrent downloads streaming into a sink, retries scheduled
+without blocking other tickers, non-retryable and exhausted failures, empty
+histories, the shared rate budget, and resuming from a checkpoint.
+"""
+
+import threading
+import time
+
+import pytest
+
+from system.algo_trader.infra.schwab.bulk_history import (
+    BulkPriceHistoryDownloader,
+    DownloadCheckpoint,
+    PriceHistorySink,
+)
+from system.algo_trader.infra.schwab.rate_limit import TokenBucket
+
+CANDLES = [{"datetime": 0, "open": 1.0, "high": 1.0, "low": 1.0, "close": 1.0, "volume": 1}]
+
+
+class ListSink(PriceHistorySink):
+    """Sink that keeps written tickers in arrival order."""
+
+    def __init__(self):
+        self.written = []
+        self.threads = set()
+
+    def write(self, ticker, history):
+        self.written.append(ticker)
+        self.threads.add(threading.get_ident())
+
+
+class ScriptedFetch:
+    """Fetch that replays per-ticker status sequences (200 once exhausted)."""
+
+    def __init__(self, delay_s: float = 0.0, script: dict | None = None):
+        self.delay_s = delay_s
+        self.script = {ticker: list(codes) for ticker, codes in (script or {}).items()}
+        self.calls: dict[str, int] = {}
+        self.lock = threading.Lock()
+
+    def __call__(self, ticker):
+        with self.lock:
+            self.calls[ticker] = self.calls.get(ticker, 0) + 1
+            codes = self.script.get(ticker)
+            status = codes.pop(0) if codes else 200
+        time.sleep(self.delay_s)
+        if status == "empty":
+            return {"symbol": ticker, "candles": [], "empty": True}, 200
+        if status != 200:
+            return None, status
+        return {"symbol": ticker, "candles": CANDLES, "empty": False}, 200
+
+
+def _downloader(fetch, sink, **kwargs) -> BulkPriceHistoryDownloader:
+    options = {"rate_budget": TokenBucket(1_000.0, 100), "retry_delay_s": 0.01, **kwargs}
+    return BulkPriceHistoryDownloader(fetch, sink, **options)
+
+
+TICKERS = [f"T{i:02d}" for i in range(20)]
+
+
+class TestBulkDownload:
+    """Test concurrency, retries and outcomes."""
+
+    @pytest.mark.unit
+    def test_downloads_concurrently_into_sink(self):
+        """Test tickers run in parallel and reach the sink from one thread."""
+        sink = ListSink()
+
+        start = time.perf_counter()
+        result = _downloader(ScriptedFetch(delay_s=0.05), sink, max_workers=10).download(
+            TICKERS + TICKERS[:3]
+        )
+        elapsed = time.perf_counter() - start
+
+        assert sorted(result.completed) == TICKERS
+        assert sorted(sink.written) == TICKERS
+        assert result.requests == 20
+        assert elapsed < 0.5
+        assert sink.threads == {threading.get_ident()}
+
+    @pytest.mark.unit
+    def test_retry_backoff_does_not_block_other_tickers(self):
+        """Test a ticker waiting on backoff leaves its worker free."""
+        fetch = ScriptedFetch(delay_s=0.02, script={"T00": [502]})
+        sink = ListSink()
+
+        result = _downloader(fetch, sink, max_workers=2, retry_delay_s=0.2).download(
+            TICKERS[:10]
+        )
+
+        assert fetch.calls["T00"] == 2
+        assert sink.written[-1] == "T00"
+        assert len(result.completed) == 10
+        assert result.requests == 11
+
+    @pytest.mark.unit
+    def test_failures_and_empty_histories(self):
+        """Test non-retryable errors fail at once and transient ones after retries."""
+        fetch = ScriptedFetch(script={"BAD": [404], "DOWN": [500] * 10, "NONE": ["empty"]})
+        sink = ListSink()
+
+        result = _downloader(fetch, sink, max_retries=2).download(["AAPL", "BAD", "DOWN", "NONE"])
+
+        assert result.completed == ["AAPL"]
+        assert result.empty == ["NONE"]
+        assert result.failed == {"BAD": 404, "DOWN": 500}
+        assert (fetch.calls["BAD"], fetch.calls["DOWN"]) == (1, 3)
+        assert sink.written == ["AAPL"]
+
+    @pytest.mark.unit
+    def test_fetch_exceptions_are_retried(self):
+        """Test a raising fetch counts as a transient error."""
+        calls = []
+
+        def flaky(ticker):
+            calls.append(ticker)
+            if len(calls) == 1:
+                raise ConnectionError("reset")
+            return {"symbol": ticker, "candles": CANDLES}, 200
+
+        result = _downloader(flaky, ListSink()).download(["AAPL"])
+
+        assert result.completed == ["AAPL"]
+        assert calls == ["AAPL", "AAPL"]
+
+    @pytest.mark.integration
+    def test_rate_budget_bounds_request_rate(self):
+        """Test workers together stay within the shared budget."""
+        budget = TokenBucket(rate=50.0, capacity=1)
+
+        start = time.perf_counter()
+        _downloader(ScriptedFetch(), ListSink(), rate_budget=budget, max_workers=8).download(
+            TICKERS[:10]
+        )
+
+        assert time.perf_counter() - start >= 9 / 50.0 - 0.01
+
+
+class TestCheckpoint:
+    """Test resumable progress."""
+
+    @pytest.mark.unit
+    def test_resume_fetches_only_unfinished_tickers(self, tmp_path):
+        """Test a rerun skips finished tickers and retries transient failures."""
+        path = str(tmp_path / "progress.tsv")
+        first_fetch = ScriptedFetch(script={"T01": [404], "T02": [503] * 10})
+        checkpoint = DownloadCheckpoint(path)
+        _downloader(first_fetch, ListSink(), max_retries=1, checkpoint=checkpoint).download(
+            TICKERS[:5]
+        )
+        checkpoint.close()
+
+        second_fetch = ScriptedFetch()
+        resumed = DownloadCheckpoint(path)
+        result = _downloader(second_fetch, ListSink(), checkpoint=resumed).download(TICKERS[:5])
+        resumed.close()
+
+        assert result.skipped == 4
+        assert second_fetch.calls == {"T02": 1}
+        assert result.completed == ["T02"]
+        assert DownloadCheckpoint(path).finished["T01"] == "404"
+
+    @pytest.mark.unit
+    def test_stop_leaves_remaining_tickers_for_resume(self, tmp_path):
+        """Test stop() returns after in-flight requests with progress recorded."""
+        sink = ListSink()
+        checkpoint = DownloadCheckpoint(str(tmp_path / "progress.tsv"))
+        downloader = _downloader(
+            ScriptedFetch(delay_s=0.02), sink, max_workers=2, checkpoint=checkpoint
+        )
+        original_write = sink.write
+
+        def write_then_stop(ticker, history):
+            original_write(ticker, history)
+            if len(sink.written) == 4:
+                downloader.stop()
+
+        sink.write = write_then_stop
+        result = downloader.download(TICKERS)
+        checkpoint.close()
+
+        assert 4 <= len(result.completed) < len(TICKERS)
+        assert set(checkpoint.finished) == set(result.completed)
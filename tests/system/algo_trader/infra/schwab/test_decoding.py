@@ -0,0 +1,264 @@
+"""Unit tests for Schwab payload decoding into domain models.
+
+Tests cover quotes decoded into Quote and QuoteBatch, option chains decoded
+into OptionChain, positions decoded into Positions, the standard library
+fallback when orjson is unavailable, and the decoding benchmark on synthetic
+payloads.
+"""
+
+import json
+import math
+import platform
+from datetime import datetime, timezone
+from unittest.mock import patch
+
+import pytest
+
+from system.algo_trader.infra.schwab import decoding
+from system.algo_trader.infra.schwab.decode_bench import (
+    environment,
+    run,
+    synthetic_option_chain,
+    synthetic_positions,
+    synthetic_quotes,
+)
+from system.algo_trader.infra.schwab.decoding import (
+    decode_option_chain,
+    decode_positions,
+    decode_quote,
+    decode_quote_batch,
+)
+
+QUOTES = json.dumps(
+    {
+        "AAPL": {
+            "assetMainType": "EQUITY",
+            "quote": {
+                "bidPrice": 149.9,
+                "askPrice": 150.1,
+                "bidSize": 300,
+                "askSize": 200,
+                "lastPrice": 150.0,
+                "totalVolume": 1000000,
+                "netChange": 2.5,
+                "netPercentChange": 1.69,
+                "quoteTime": 1_700_000_000_000,
+            },
+        },
+        "MSFT": {
+            "assetMainType": "EQUITY",
+            "quote": {"lastPrice": 400.0, "bidPrice": None, "quoteTime": 1_700_000_001_000},
+        },
+        "errors": {"invalidSymbols": ["NOPE"]},
+    }
+).encode()
+
+
+class TestDecodeQuotes:
+    """Test quotes decoding."""
+
+    @pytest.mark.unit
+    def test_decode_quote(self):
+        """Test fields map onto Quote and missing values are omitted."""
+        quote = decode_quote(QUOTES)
+
+        assert quote.asset_class == "EQUITY"
+        assert quote.timestamp == datetime.fromtimestamp(1_700_000_001, tz=timezone.utc)
+        assert quote.last == {"AAPL": 150.0, "MSFT": 400.0}
+        assert quote.bid == {"AAPL": 149.9}
+        assert quote.bid_size == {"AAPL": 300.0}
+        assert quote.volume == {"AAPL": 1000000.0}
+        assert quote.change_pct == {"AAPL": 1.69}
+
+    @pytest.mark.unit
+    def test_decode_quote_batch(self):
+        """Test the columnar decoder matches the dict decoder."""
+        batch = decode_quote_batch(QUOTES)
+
+        assert batch.symbols == ("AAPL", "MSFT")
+        assert batch.last.tolist() == [150.0, 400.0]
+        assert batch.ask_size[0] == 200.0
+        assert math.isnan(batch.bid[1])
+        assert batch.to_quote() == decode_quote(QUOTES)
+
+    @pytest.mark.unit
+    def test_empty_response_uses_default_timestamp(self):
+        """Test a response without quotes decodes to an empty model."""
+        now = datetime(2024, 1, 2, tzinfo=timezone.utc)
+
+        quote = decode_quote(b'{"errors": {"invalidSymbols": ["NOPE"]}}', timestamp=now)
+        batch = decode_quote_batch(b"{}", timestamp=now)
+
+        assert quote.timestamp == now
+        assert quote.last == {}
+        assert len(batch) == 0
+        assert batch.values.shape == (8, 0)
+
+    @pytest.mark.unit
+    def test_falls_back_to_stdlib_parser(self):
+        """Test decoding works when orjson is not installed."""
+        with patch.object(decoding, "orjson", None):
+            quote = decode_quote(QUOTES.decode())
+
+        assert quote.last["MSFT"] == 400.0
+
+
+class TestDecodeOptionChain:
+    """Test option chain decoding."""
+
+    @pytest.mark.unit
+    def test_calls_and_puts_become_columns(self):
+        """Test contracts from both maps are decoded with their expiry and side."""
+        payload = {
+            "symbol": "AAPL",
+            "underlyingPrice": 150.0,
+            "callExpDateMap": {
+                "2024-01-19:5": {
+                    "150.0": [
+                        {
+                            "symbol": "AAPL  240119C00150000",
+                            "strikePrice": 150.0,
+                            "bid": 2.0,
+                            "ask": 2.2,
+                            "delta": 0.52,
+                            "openInterest": 1200,
+                        }
+                    ],
+                    "155.0": [
+                        {
+                            "symbol": "AAPL  240119C00155000",
+                            "strikePrice": 155.0,
+                            "bid": 0.5,
+                            "ask": 0.6,
+                            "delta": -999.0,
+                        }
+                    ],
+                }
+            },
+            "putExpDateMap": {
+                "2024-02-16:33": {
+                    "145.0": [
+                        {
+                            "symbol": "AAPL  240216P00145000",
+                            "strikePrice": 145.0,
+                            "bid": 1.1,
+                            "ask": None,
+                            "delta": -0.3,
+                        }
+                    ]
+                }
+            },
+        }
+
+        chain = decode_option_chain(json.dumps(payload))
+
+        assert (chain.underlying, chain.underlying_price) == ("AAPL", 150.0)
+        assert chain.symbols.tolist() == [
+            "AAPL  240119C00150000",
+            "AAPL  240119C00155000",
+            "AAPL  240216P00145000",
+        ]
+        assert chain.is_call.tolist() == [True, True, False]
+        assert chain.strike.tolist() == [150.0, 155.0, 145.0]
+        assert chain.expiries.astype(str).tolist() == ["2024-01-19", "2024-01-19", "2024-02-16"]
+        assert chain.open_interest[0] == 1200.0
+        assert math.isnan(chain.open_interest[1])
+        assert math.isnan(chain.delta[1])
+        assert math.isnan(chain.ask[2])
+
+    @pytest.mark.unit
+    def test_empty_chain(self):
+        """Test a chain without contracts decodes to empty columns."""
+        chain = decode_option_chain(b'{"symbol": "NOPE", "status": "FAILED"}')
+
+        assert len(chain) == 0
+        assert math.isnan(chain.underlying_price)
+
+    @pytest.mark.unit
+    def test_synthetic_chain_size(self):
+        """Test the benchmark chain has the requested number of contracts."""
+        chain = decode_option_chain(synthetic_option_chain(800, strikes_per_expiry=100))
+
+        assert len(chain) == 800
+        assert chain.is_call.sum() == 400
+        assert len(chain.expirations()) == 4
+
+
+class TestDecodePositions:
+    """Test positions decoding."""
+
+    @pytest.mark.unit
+    def test_long_and_short_positions(self):
+        """Test quantities are signed and prices derived from market value."""
+        payload = {
+            "securitiesAccount": {
+                "positions": [
+                    {
+                        "instrument": {"symbol": "AAPL"},
+                        "longQuantity": 10.0,
+                        "shortQuantity": 0.0,
+                        "averagePrice": 150.0,
+                        "averageLongPrice": 149.0,
+                        "marketValue": 1600.0,
+                        "longOpenProfitLoss": 110.0,
+                    },
+                    {
+                        "instrument": {"symbol": "TSLA"},
+                        "longQuantity": 0.0,
+                        "shortQuantity": 5.0,
+                        "averagePrice": 200.0,
+                        "marketValue": -950.0,
+                        "shortOpenProfitLoss": 50.0,
+                    },
+                    {"instrument": {"symbol": "FLAT"}, "longQuantity": 0.0, "marketValue": 0},
+                ]
+            }
+        }
+        now = datetime(2024, 1, 2, tzinfo=timezone.utc)
+
+        positions = decode_positions(json.dumps(payload), timestamp=now)
+
+        long, short = positions.positions
+        assert positions.timestamp == now
+        assert (long.symbol, long.quantity, long.cost_basis) == ("AAPL", 10, 149.0)
+        assert (long.current_price, long.pnl_open, long.net_liquidation) == (160.0, 110.0, 1600.0)
+        assert (short.symbol, short.quantity, short.cost_basis) == ("TSLA", -5, 200.0)
+        assert (short.current_price, short.pnl_open) == (190.0, 50.0)
+
+    @pytest.mark.unit
+    def test_account_list_is_combined(self):
+        """Test positions from every account in a list response are returned."""
+        payload = b"[" + synthetic_positions(2) + b"," + synthetic_positions(1) + b"]"
+
+        positions = decode_positions(payload)
+
+        assert [p.symbol for p in positions.positions] == ["SYM0000", "SYM0001", "SYM0000"]
+
+
+class TestDecodeBenchmark:
+    """Test the decoding benchmark."""
+
+    @pytest.mark.unit
+    def test_run_times_every_case(self):
+        """Test each decoder is timed on the synthetic payloads."""
+        results = run(
+            synthetic_quotes(20),
+            synthetic_positions(5),
+            repeat=2,
+            options=synthetic_option_chain(40, strikes_per_expiry=10),
+        )
+
+        decoders = {r["decoder"] for r in results}
+        assert {"json+extract", "json+decode_quote", "json+decode_positions"} <= decoders
+        assert "json+decode_option_chain" in decoders
+        assert all(r["best_ms"] <= r["median_ms"] for r in results)
+        assert decoding.orjson is None or "orjson+decode_quote" in decoders
+
+    @pytest.mark.unit
+    def test_environment_names_parsers(self):
+        """Test the environment line records the parser libraries timed."""
+        env = environment()
+
+        assert env["python"] == platform.python_version()
+        assert env["numpy"] == decoding.np.__version__
+        assert (env["orjson"] is None) == (decoding.orjson is None)
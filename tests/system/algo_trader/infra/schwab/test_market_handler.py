@@ -4,12 +4,17 @@ Tests cover market data retrieval methods including quotes, price history,
 and market hours. All external dependencies are mocked to avoid network calls.
 """
 
-from datetime import datetime
+import json
+from datetime import date, datetime, timezone
 from unittest.mock import MagicMock, Mock, patch
 
 import pytest
 
+from system.algo_trader.domain.models import OptionChain, Quote
+from system.algo_trader.domain.states import MarketStatus
+from system.algo_trader.infra.schwab.bulk_history import PriceHistorySink
 from system.algo_trader.infra.schwab.market_handler import MarketHandler
+from system.algo_trader.infra.schwab.rate_limit import TokenBucket
 from system.algo_trader.infra.schwab.timescale_enum import FrequencyType, PeriodType
 
 
@@ -308,6 +313,31 @@ class TestMarketHandlerQuoteMethods:
 
         assert result == {}
 
+    def test_get_quote_snapshot_decodes_raw_body(self, mock_dependencies):
+        """Test the snapshot is decoded from the response body into a Quote."""
+        body = {"AAPL": {"assetMainType": "EQUITY", "quote": {"lastPrice": 150.0}}}
+        response = MagicMock(status_code=200, content=json.dumps(body).encode())
+        handler = MarketHandler()
+        handler.make_authenticated_request = Mock(return_value=response)
+
+        result = handler.get_quote_snapshot(["AAPL", "MSFT"])
+
+        assert isinstance(result, Quote)
+        assert result.last == {"AAPL": 150.0}
+        handler.make_authenticated_request.assert_called_once_with(
+            "GET",
+            "https://api.schwabapi.com/marketdata/v1/quotes",
+            params={"symbols": "AAPL,MSFT"},
+        )
+        response.json.assert_not_called()
+
+    def test_get_quote_snapshot_failure(self, mock_dependencies):
+        """Test a failed snapshot request returns None."""
+        handler = MarketHandler()
+        handler.make_authenticated_request = Mock(return_value=MagicMock(status_code=500))
+
+        assert handler.get_quote_snapshot(["AAPL"]) is None
+
 
 class TestMarketHandlerPriceHistoryMethods:
     """Test price history methods."""
@@ -371,6 +401,23 @@ class TestMarketHandlerPriceHistoryMethods:
         assert result == mock_response
         handler._send_request.assert_called_once()
 
+    def test_get_price_history_with_date_range(self, mock_dependencies):
+        """Test start and end dates are sent as epoch milliseconds."""
+        handler = MarketHandler()
+        handler._send_request = Mock(return_value=({"candles": []}, 200))
+        start = datetime(2024, 1, 2, 15, 30, tzinfo=timezone.utc)
+
+        handler.get_price_history(
+            "AAPL",
+            frequency_type=FrequencyType.DAILY,
+            start_date=start,
+            end_date=datetime(2024, 1, 3, tzinfo=timezone.utc),
+        )
+
+        _, params = handler._send_request.call_args.args
+        assert params["startDate"] == 1704209400000
+        assert params["endDate"] == 1704240000000
+
     def test_get_price_history_failure(self, mock_dependencies):
         """Test price history retrieval failure."""
         handler = MarketHandler()
@@ -388,12 +435,181 @@ class TestMarketHandlerPriceHistoryMethods:
         with pytest.raises(ValueError):
             handler.get_price_history("AAPL", PeriodType.DAY, 1, FrequencyType.MONTHLY, 1)
 
-    def test_get_option_chains_not_implemented(self, mock_dependencies):
-        """Test option chains method returns empty dict."""
+    def test_download_price_histories(self, mock_dependencies, tmp_path):
+        """Test bulk download sends one request per ticker and checkpoints progress."""
+        written = {}
+
+        class DictSink(PriceHistorySink):
+            def write(self, ticker, history):
+                written[ticker] = history
+
+        def send_request(url, params):
+            return {"symbol": params["symbol"], "candles": [{"close": 1.0}]}, 200
+
         handler = MarketHandler()
-        result = handler.get_option_chains("AAPL")
+        handler._send_request = Mock(side_effect=send_request)
+        checkpoint = str(tmp_path / "progress.tsv")
+
+        result = handler.download_price_histories(
+            ["AAPL", "MSFT"],
+            DictSink(),
+            PeriodType.DAY,
+            1,
+            FrequencyType.MINUTE,
+            5,
+            checkpoint_path=checkpoint,
+            requests_per_second=1_000.0,
+        )
+        rerun = handler.download_price_histories(
+            ["AAPL", "MSFT", "TSLA"], DictSink(), checkpoint_path=checkpoint
+        )
 
-        assert result == {}
+        assert sorted(result.completed) == ["AAPL", "MSFT"]
+        assert rerun.skipped == 2
+        assert rerun.completed == ["TSLA"]
+        assert sorted(written) == ["AAPL", "MSFT", "TSLA"]
+        url, params = handler._send_request.call_args_list[0].args
+        assert url.endswith("/pricehistory")
+        assert (params["periodType"], params["frequencyType"], params["frequency"]) == (
+            "day",
+            "minute",
+            5,
+        )
+
+    def test_download_price_histories_leaves_sink_open(self, mock_dependencies):
+        """Test the caller's sink stays open and a shared rate budget is drawn from."""
+
+        class ListSink(PriceHistorySink):
+            def __init__(self):
+                self.tickers = []
+                self.closed = False
+
+            def write(self, ticker, history):
+                self.tickers.append(ticker)
+
+            def close(self):
+                self.closed = True
+
+        handler = MarketHandler()
+        handler._send_request = Mock(return_value=({"candles": [{"close": 1.0}]}, 200))
+        budget = TokenBucket(1_000.0, 10)
+        sink = ListSink()
+
+        result = handler.download_price_histories(["AAPL", "MSFT"], sink, rate_budget=budget)
+
+        assert sorted(result.completed) == ["AAPL", "MSFT"]
+        assert not sink.closed
+        assert budget.available < 9
+
+    def test_price_history_downloader_can_be_stopped(self, mock_dependencies):
+        """Test the downloader from price_history_downloader() stops between tickers."""
+        written = []
+
+        class ListSink(PriceHistorySink):
+            def write(self, ticker, history):
+                written.append(ticker)
+
+        handler = MarketHandler()
+        downloader = handler.price_history_downloader(
+            ListSink(), max_workers=1, requests_per_second=1_000.0
+        )
+
+        def send_request(url, params):
+            downloader.stop()
+            return {"candles": [{"close": 1.0}]}, 200
+
+        handler._send_request = Mock(side_effect=send_request)
+
+        downloader.download(["AAPL", "MSFT", "TSLA"])
+
+        assert handler._send_request.call_count == 1
+        assert written == ["AAPL"]
+
+    def test_get_option_chains_decodes_columnar_chain(self, mock_dependencies):
+        """Test server-side filters are sent and the strike range applied after decoding."""
+        body = {
+            "symbol": "AAPL",
+            "underlyingPrice": 150.0,
+            "callExpDateMap": {
+                "2024-01-19:5": {
+                    f"{strike:.1f}": [{"symbol": f"C{strike}", "strikePrice": strike}]
+                    for strike in (140.0, 150.0, 160.0)
+                }
+            },
+        }
+        response = MagicMock(status_code=200, content=json.dumps(body).encode())
+        handler = MarketHandler()
+        handler.make_authenticated_request = Mock(return_value=response)
+
+        result = handler.get_option_chains(
+            "AAPL",
+            contract_type="CALL",
+            from_date=date(2024, 1, 1),
+            to_date=date(2024, 1, 31),
+            strike_min=145.0,
+        )
+
+        assert isinstance(result, OptionChain)
+        assert result.strike.tolist() == [150.0, 160.0]
+        handler.make_authenticated_request.assert_called_once_with(
+            "GET",
+            "https://api.schwabapi.com/marketdata/v1/chains",
+            params={
+                "symbol": "AAPL",
+                "contractType": "CALL",
+                "fromDate": "2024-01-01",
+                "toDate": "2024-01-31",
+            },
+        )
+
+    def test_get_option_chains_is_cached(self, mock_dependencies):
+        """Test chains are reused within the TTL, across strike ranges."""
+        body = {"symbol": "AAPL", "underlyingPrice": 150.0, "callExpDateMap": {}}
+        response = MagicMock(status_code=200, content=json.dumps(body).encode())
+        handler = MarketHandler()
+        handler.make_authenticated_request = Mock(return_value=response)
+
+        first = handler.get_option_chains("AAPL")
+        handler.get_option_chains("AAPL", strike_min=100.0)
+        assert handler.get_option_chains("AAPL").values.base is first.values.base
+        assert handler.make_authenticated_request.call_count == 1
+
+        handler.get_option_chains("MSFT")
+        handler.option_chain_ttl_s = 0.0
+        handler.get_option_chains("AAPL")
+        assert handler.make_authenticated_request.call_count == 3
+
+    def test_get_option_chains_returns_read_only_view(self, mock_dependencies):
+        """Test callers cannot mutate the cached chain through a returned one."""
+        body = {
+            "symbol": "AAPL",
+            "underlyingPrice": 150.0,
+            "callExpDateMap": {
+                "2024-01-19:5": {"150.0": [{"symbol": "C150", "strikePrice": 150.0}]}
+            },
+        }
+        response = MagicMock(status_code=200, content=json.dumps(body).encode())
+        handler = MarketHandler()
+        handler.make_authenticated_request = Mock(return_value=response)
+
+        first = handler.get_option_chains("AAPL")
+        with pytest.raises(ValueError):
+            first.strike[0] = 0.0
+        first.underlying_price = 0.0
+
+        again = handler.get_option_chains("AAPL")
+        assert again is not first
+        assert again.underlying_price == 150.0
+        assert list(again.strike) == [150.0]
+
+    def test_get_option_chains_failure(self, mock_dependencies):
+        """Test a failed chain request returns None and is not cached."""
+        handler = MarketHandler()
+        handler.make_authenticated_request = Mock(return_value=MagicMock(status_code=500))
+
+        assert handler.get_option_chains("AAPL") is None
+        assert handler.get_option_chains("AAPL") is None
+        assert handler.make_authenticated_request.call_count == 2
 
 
 class TestMarketHandlerMarketHoursMethods:
@@ -545,3 +761,60 @@ class TestMarketHandlerMarketHoursMethods:
             "end": "2023-01-01T16:00:00-05:00",
         }
         assert result == expected
+
+    def test_get_session_hours_open(self, mock_dependencies):
+        """Test every session window is returned in start order."""
+        mock_response = {
+            "equity": {
+                "EQ": {
+                    "isOpen": True,
+                    "sessionHours": {
+                        "postMarket": [
+                            {
+                                "start": "2024-01-02T16:00:00-05:00",
+                                "end": "2024-01-02T20:00:00-05:00",
+                            }
+                        ],
+                        "regularMarket": [
+                            {
+                                "start": "2024-01-02T09:30:00-05:00",
+                                "end": "2024-01-02T16:00:00-05:00",
+                            }
+                        ],
+                        "preMarket": [
+                            {
+                                "start": "2024-01-02T07:00:00-05:00",
+                                "end": "2024-01-02T09:30:00-05:00",
+                            }
+                        ],
+                    },
+                }
+            }
+        }
+
+        handler = MarketHandler()
+        handler._send_request = Mock(return_value=(mock_response, 200))
+
+        result = handler.get_session_hours(date(2024, 1, 2))
+
+        handler._send_request.assert_called_once_with(
+            f"{handler.market_url}/markets", {"markets": "equity", "date": "2024-01-02"}
+        )
+        assert [h.status for h in result] == [
+            MarketStatus.PRE_MARKET,
+            MarketStatus.OPEN,
+            MarketStatus.POST_MARKET,
+        ]
+        assert result[1].start == datetime.fromisoformat("2024-01-02T09:30:00-05:00")
+        assert result[1].end == datetime.fromisoformat("2024-01-02T16:00:00-05:00")
+
+    def test_get_session_hours_closed_and_failure(self, mock_dependencies):
+        """Test a closed day returns no windows and a failed request returns None."""
+        handler = MarketHandler()
+        handler._send_request = Mock(return_value=({"equity": {"equity": {"isOpen": False}}}, 200))
+
+        assert handler.get_session_hours(date(2024, 1, 6)) == []
+
+        handler._send_request = Mock(return_value=(None, 500))
+
+        assert handler.get_session_hours(date(2024, 1, 6)) is None
@@ -0,0 +1,352 @@
+"""Unit tests for OrderHandler - Schwab order execution.
+
+Tests run the handler against a local fake trader API and cover order payload
+mapping, concurrent submission over pooled keep-alive connections, the rate
+budget, rejected orders, mapping broker orders back to domain models,
+cancellation, and lifecycle events applied to an OrderBook.
+"""
+
+import json
+import threading
+import time
+from datetime import datetime, timezone
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from unittest.mock import patch
+from urllib.parse import urlparse
+from uuid import uuid4
+
+import pytest
+
+from system.algo_trader.domain.models import (
+    LimitOrder,
+    MarketOrder,
+    Orders,
+    StopLimitOrder,
+    StopOrder,
+)
+from system.algo_trader.domain.order_book import OrderBook
+from system.algo_trader.domain.states import (
+    OrderDuration,
+    OrderInstruction,
+    OrderStatus,
+    OrderTaxLotMethod,
+    OrderType,
+)
+from system.algo_trader.infra.schwab.order_handler import OrderHandler
+
+NOW = datetime(2024, 1, 2, 15, 30, tzinfo=timezone.utc)
+ORDERS_PATH = "/trader/v1/accounts/HASH/orders"
+
+
+def _market(symbol: str = "AAPL", quantity: int = 10) -> MarketOrder:
+    return MarketOrder(
+        id=uuid4(),
+        timestamp=NOW,
+        symbol=symbol,
+        quantity=quantity,
+        order_type=OrderType.MARKET,
+        order_instruction=OrderInstruction.BUY_TO_OPEN,
+        order_duration=OrderDuration.DAY,
+        order_tax_lot_method=OrderTaxLotMethod.FIFO,
+    )
+
+
+class FakeTraderApi(BaseHTTPRequestHandler):
+    """Minimal Schwab trader API backed by the server's state."""
+
+    protocol_version = "HTTP/1.1"
+
+    def log_message(self, *args):
+        """Silence request logging."""
+
+    def _reply(self, status: int, body: bytes = b"", headers: dict | None = None) -> None:
+        self.send_response(status)
+        for name, value in (headers or {}).items():
+            self.send_header(name, value)
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+
+    def _record(self, body=None) -> None:
+        state = self.server.state
+        with state["lock"]:
+            state["requests"].append((self.command, self.path, body))
+            state["connections"].add(self.client_address)
+            state["auth"].add(self.headers.get("Authorization"))
+
+    def do_POST(self):  # noqa: N802
+        """Place an order and return its ID in the Location header."""
+        body = json.loads(self.rfile.read(int(self.headers["Content-Length"])))
+        self._record(body)
+        time.sleep(self.server.state["delay_s"])
+        if body["orderLegCollection"][0]["instrument"]["symbol"] == "BAD":
+            self._reply(400, b'{"message": "invalid symbol"}')
+            return
+        state = self.server.state
+        with state["lock"]:
+            state["next_id"] += 1
+            order_id = state["next_id"]
+            state["orders"][order_id] = {**body, "orderId": order_id, "status": "WORKING"}
+        self._reply(201, headers={"Location": f"http://localhost{ORDERS_PATH}/{order_id}"})
+
+    def do_GET(self):  # noqa: N802
+        """List all orders."""
+        self._record()
+        with self.server.state["lock"]:
+            body = json.dumps(list(self.server.state["orders"].values())).encode()
+        self._reply(200, body, {"Content-Type": "application/json"})
+
+    def do_DELETE(self):  # noqa: N802
+        """Cancel an order."""
+        self._record()
+        order_id = int(urlparse(self.path).path.rsplit("/", 1)[-1])
+        with self.server.state["lock"]:
+            order = self.server.state["orders"].get(order_id)
+            if order is None:
+                self._reply(404)
+                return
+            order["status"] = "CANCELED"
+        self._reply(200)
+
+
+@pytest.fixture
+def fake_api():
+    """Run the fake trader API on a local port."""
+    server = ThreadingHTTPServer(("127.0.0.1", 0), FakeTraderApi)
+    server.daemon_threads = True
+    server.state = {
+        "lock": threading.Lock(),
+        "requests": [],
+        "connections": set(),
+        "auth": set(),
+        "orders": {},
+        "next_id": 1000,
+        "delay_s": 0.0,
+    }
+    thread = threading.Thread(target=server.serve_forever, daemon=True)
+    thread.start()
+    yield server
+    server.shutdown()
+    server.server_close()
+
+
+@pytest.fixture
+def make_handler(fake_api, mock_account_broker):
+    """Factory for handlers pointed at the fake API with a fixed token."""
+    handlers = []
+    with (
+        patch("system.algo_trader.infra.schwab.order_handler.get_logger"),
+        patch.object(OrderHandler, "get_valid_access_token", return_value="test_token"),
+    ):
+
+        def _make(**kwargs) -> OrderHandler:
+            host, port = fake_api.server_address
+            options = {"requests_per_second": 1_000.0, "burst": 100, **kwargs}
+            handler = OrderHandler("HASH", base_url=f"http://{host}:{port}", **options)
+            handlers.append(handler)
+            return handler
+
+        yield _make
+    for handler in handlers:
+        handler.close()
+
+
+class TestSendOrders:
+    """Test order placement."""
+
+    @pytest.mark.unit
+    def test_payloads_and_broker_ids(self, fake_api, make_handler):
+        """Test each order type maps to Schwab JSON and broker IDs are kept."""
+        handler = make_handler()
+        common = {
+            "timestamp": NOW,
+            "symbol": "MSFT",
+            "quantity": 5,
+            "order_duration": OrderDuration.GTC,
+            "order_tax_lot_method": OrderTaxLotMethod.HIFO,
+        }
+        limit = LimitOrder(
+            id=uuid4(),
+            price=310.5,
+            order_type=OrderType.LIMIT,
+            order_instruction=OrderInstruction.SELL_TO_OPEN,
+            **common,
+        )
+        stop = StopOrder(
+            id=uuid4(),
+            price=300.0,
+            order_type=OrderType.STOP,
+            order_instruction=OrderInstruction.SELL_TO_CLOSE,
+            **common,
+        )
+        stop_limit = StopLimitOrder(
+            id=uuid4(),
+            stop_price=320.0,
+            limit_price=321.25,
+            order_type=OrderType.STOP_LIMIT,
+            order_instruction=OrderInstruction.BUY_TO_CLOSE,
+            **common,
+        )
+        market = _market()
+
+        accepted = handler.send_orders(Orders(NOW, [market, limit, stop, stop_limit]))
+
+        assert accepted.orders == [market, limit, stop, stop_limit]
+        bodies = {body["orderType"]: body for _, _, body in fake_api.state["requests"]}
+        assert bodies["MARKET"]["orderLegCollection"][0] == {
+            "instruction": "BUY",
+            "quantity": 10,
+            "instrument": {"symbol": "AAPL", "assetType": "EQUITY"},
+        }
+        assert (bodies["LIMIT"]["price"], bodies["LIMIT"]["duration"]) == (
+            "310.5",
+            "GOOD_TILL_CANCEL",
+        )
+        assert bodies["LIMIT"]["orderLegCollection"][0]["instruction"] == "SELL_SHORT"
+        assert bodies["LIMIT"]["taxLotMethod"] == "HIGH_COST"
+        assert bodies["STOP"]["stopPrice"] == "300"
+        assert (bodies["STOP_LIMIT"]["price"], bodies["STOP_LIMIT"]["stopPrice"]) == (
+            "321.25",
+            "320",
+        )
+        broker_ids = {handler.broker_order_id(o.id) for o in accepted.orders}
+        assert broker_ids == {"1001", "1002", "1003", "1004"}
+        assert fake_api.state["auth"] == {"Bearer test_token"}
+
+    @pytest.mark.unit
+    def test_rejected_orders_are_not_accepted(self, make_handler):
+        """Test orders refused by the broker are left out of the result."""
+        handler = make_handler()
+        good, bad = _market(), _market("BAD")
+
+        accepted = handler.send_orders(Orders(NOW, [bad, good]))
+
+        assert accepted.orders == [good]
+        assert handler.broker_order_id(bad.id) is None
+
+    @pytest.mark.integration
+    def test_submissions_run_concurrently_on_pooled_connections(self, fake_api, make_handler):
+        """Test a batch takes about one round trip and reuses keep-alive connections."""
+        fake_api.state["delay_s"] = 0.1
+        handler = make_handler(max_workers=8)
+
+        start = time.perf_counter()
+        accepted = handler.send_orders(Orders(NOW, [_market() for _ in range(8)]))
+        elapsed = time.perf_counter() - start
+        handler.send_orders(Orders(NOW, [_market() for _ in range(8)]))
+
+        assert len(accepted.orders) == 8
+        assert elapsed < 0.5
+        assert len(fake_api.state["requests"]) == 16
+        assert len(fake_api.state["connections"]) <= 8
+
+    @pytest.mark.integration
+    def test_rate_budget_spaces_requests(self, fake_api, make_handler):
+        """Test requests beyond the burst wait for the sustained rate."""
+        handler = make_handler(max_workers=8, requests_per_second=20.0, burst=1)
+
+        start = time.perf_counter()
+        handler.send_orders(Orders(NOW, [_market() for _ in range(6)]))
+        elapsed = time.perf_counter() - start
+
+        assert elapsed >= 0.25
+        assert handler.rate_budget.waited_s > 0
+
+
+class TestOrderQueries:
+    """Test mapping broker orders back to domain models."""
+
+    @pytest.mark.unit
+    def test_get_all_and_open_orders(self, fake_api, make_handler):
+        """Test placed orders round-trip and foreign orders get stable IDs."""
+        handler = make_handler()
+        placed = _market()
+        handler.send_orders(Orders(NOW, [placed]))
+        fake_api.state["orders"][7] = {
+            "orderId": 7,
+            "status": "FILLED",
+            "enteredTime": "2024-01-02T14:00:00+0000",
+            "orderType": "LIMIT",
+            "duration": "DAY",
+            "price": 99.5,
+            "quantity": 3,
+            "orderLegCollection": [
+                {"instruction": "SELL", "quantity": 3, "instrument": {"symbol": "TSLA"}}
+            ],
+        }
+        fake_api.state["orders"][8] = {
+            "orderId": 8,
+            "status": "WORKING",
+            "orderType": "TRAILING_STOP",
+            "orderLegCollection": [
+                {"instruction": "BUY", "quantity": 1, "instrument": {"symbol": "TSLA"}}
+            ],
+        }
+
+        all_orders = handler.get_all_orders().orders
+        open_orders = handler.get_open_orders().orders
+        again = handler.get_all_orders().orders
+
+        assert [o.symbol for o in all_orders] == ["AAPL", "TSLA"]
+        mapped, foreign = all_orders
+        assert mapped.id == placed.id
+        assert (mapped.order_instruction, mapped.quantity) == (OrderInstruction.BUY_TO_OPEN, 10)
+        assert isinstance(foreign, LimitOrder)
+        assert (foreign.price, foreign.order_instruction) == (99.5, OrderInstruction.SELL_TO_CLOSE)
+        assert foreign.timestamp == datetime(2024, 1, 2, 14, 0, tzinfo=timezone.utc)
+        assert again[1].id == foreign.id
+        assert [o.id for o in open_orders] == [placed.id]
+        method, path, _ = fake_api.state["requests"][-1]
+        assert method == "GET"
+        assert "fromEnteredTime=" in path and "toEnteredTime=" in path
+
+    @pytest.mark.unit
+    def test_order_events_feed_order_book(self, fake_api, make_handler):
+        """Test broker fills become lifecycle events an OrderBook accepts."""
+        handler = make_handler()
+        order = _market(quantity=10)
+        book = OrderBook()
+        accepted = handler.send_orders(Orders(NOW, [order]))
+        book.record_submission(Orders(NOW, [order]), accepted, NOW)
+        broker_order = fake_api.state["orders"][int(handler.broker_order_id(order.id))]
+        broker_order["filledQuantity"] = 4
+        broker_order["orderActivityCollection"] = [
+            {"executionLegs": [{"price": 100.0, "quantity": 4}]}
+        ]
+
+        for event in handler.get_order_events():
+            book.apply(event)
+
+        tracked = book.get(order.id)
+        assert tracked.status == OrderStatus.PARTIALLY_FILLED
+        assert (tracked.filled_quantity, tracked.avg_fill_price) == (4, 100.0)
+
+
+class TestCancel:
+    """Test order cancellation."""
+
+    @pytest.mark.unit
+    def test_cancel_order_by_domain_id(self, fake_api, make_handler):
+        """Test a domain UUID resolves to its broker order for cancellation."""
+        handler = make_handler()
+        order = _market()
+        handler.send_orders(Orders(NOW, [order]))
+
+        assert handler.cancel_order(str(order.id)) is True
+        assert handler.cancel_order(str(uuid4())) is False
+        assert handler.cancel_order("999") is False
+        assert fake_api.state["orders"][1001]["status"] == "CANCELED"
+
+    @pytest.mark.unit
+    def test_cancel_all_orders(self, fake_api, make_handler):
+        """Test every working order is cancelled and terminal ones are skipped."""
+        handler = make_handler()
+        handler.send_orders(Orders(NOW, [_market() for _ in range(3)]))
+        fake_api.state["orders"][1001]["status"] = "FILLED"
+
+        assert handler.cancel_all_orders() is True
+
+        requests = fake_api.state["requests"]
+        deletes = sorted(path for method, path, _ in requests if method == "DELETE")
+        assert deletes == [f"{ORDERS_PATH}/1002", f"{ORDERS_PATH}/1003"]
+        assert handler.get_open_orders().orders == []
@@ -0,0 +1,89 @@
+"""Unit tests for TokenBucket - Client-side request budget.
+
+Tests cover burst capacity, refill at the sustained rate, reservations made
+ahead of refill, and the long-run rate under concurrent callers.
+"""
+
+import threading
+import time
+
+import pytest
+
+from system.algo_trader.infra.schwab.rate_limit import TokenBucket
+
+
+class FakeClock:
+    """Manually advanced clock whose sleep advances time."""
+
+    def __init__(self):
+        self.now = 0.0
+        self.slept = []
+
+    def __call__(self) -> float:
+        return self.now
+
+    def sleep(self, seconds: float) -> None:
+        self.slept.append(seconds)
+        self.now += seconds
+
+
+class TestTokenBucket:
+    """Test token accounting."""
+
+    @pytest.mark.unit
+    def test_burst_then_waits_at_rate(self):
+        """Test the burst is free and later calls wait 1/rate each."""
+        clock = FakeClock()
+        bucket = TokenBucket(rate=2.0, capacity=3, clock=clock, sleep=clock.sleep)
+
+        waits = [bucket.acquire() for _ in range(5)]
+
+        assert waits == [0.0, 0.0, 0.0, 0.5, 0.5]
+        assert bucket.waited_s == 1.0
+
+    @pytest.mark.unit
+    def test_refill_is_capped_at_capacity(self):
+        """Test idle time does not bank more than one burst."""
+        clock = FakeClock()
+        bucket = TokenBucket(rate=10.0, capacity=2, clock=clock, sleep=clock.sleep)
+        bucket.acquire()
+        bucket.acquire()
+
+        clock.now += 60.0
+
+        assert bucket.available == 2
+        assert [bucket.reserve() for _ in range(3)] == [0.0, 0.0, pytest.approx(0.1)]
+
+    @pytest.mark.unit
+    def test_reservations_queue_ahead(self):
+        """Test concurrent reservations wait progressively longer."""
+        clock = FakeClock()
+        bucket = TokenBucket(rate=4.0, capacity=1, clock=clock, sleep=clock.sleep)
+
+        waits = [bucket.reserve() for _ in range(4)]
+
+        assert waits == [0.0, 0.25, 0.5, 0.75]
+        assert bucket.available == -3
+
+    @pytest.mark.unit
+    def test_invalid_parameters(self):
+        """Test non-positive rate or capacity is rejected."""
+        with pytest.raises(ValueError, match="positive"):
+            TokenBucket(rate=0.0, capacity=1)
+
+    @pytest.mark.integration
+    def test_threads_share_the_rate(self):
+        """Test threads together stay within the sustained rate."""
+        bucket = TokenBucket(rate=50.0, capacity=1)
+        threads = [
+            threading.Thread(target=lambda: [bucket.acquire() for _ in range(5)])
+            for _ in range(4)
+        ]
+
+        start = time.perf_counter()
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+
+        assert time.perf_counter() - start >= 19 / 50.0 - 0.01
@@ -6,10 +6,13 @@ Common fixtures are defined in conftest.py.
 """
 
 import os
+import threading
+import time
 from unittest.mock import MagicMock, patch
 
 import pytest
 
+from system.algo_trader.infra.redis.rate_limiter import EndpointClass
 from system.algo_trader.infra.schwab.schwab_client import SchwabClient
 
 
@@ -330,7 +333,8 @@ class TestSchwabClientUtilityMethods:
         """Test making authenticated requests."""
         mock_response = MagicMock()
         mock_response.status_code = 200
-        mock_dependencies_utility["requests"].request.return_value = mock_response
+        session = mock_dependencies_utility["requests"].Session.return_value
+        session.request.return_value = mock_response
 
         mock_dependencies_utility["broker"].get_access_token.return_value = "test_token"
 
@@ -339,9 +343,9 @@ class TestSchwabClientUtilityMethods:
 
         assert response == mock_response
 
-        # Verify request was made with proper headers
-        mock_dependencies_utility["requests"].request.assert_called_once()
-        call_args = mock_dependencies_utility["requests"].request.call_args
+        # Verify request was made on the pooled session with proper headers
+        session.request.assert_called_once()
+        call_args = session.request.call_args
         assert call_args[0] == ("GET", "https://api.test.com/test")
         assert "headers" in call_args[1]
         assert call_args[1]["headers"]["Authorization"] == "Bearer test_token"
@@ -406,12 +410,15 @@ class TestSchwabClientDistributedLocking:
         token = client.get_valid_access_token()
 
         assert token == "refreshed_token"
-        # Verify lock was acquired
+        # Verify lock was tried once, without sleep-polling
         mock_dependencies_locking["broker"].acquire_lock.assert_called_once_with(
-            "token-refresh", ttl=10, retry_interval=0.1, max_retries=50
+            "token-refresh", ttl=10, max_retries=1
         )
-        # Verify lock was released
+        # Verify lock was released and the outcome announced
         mock_dependencies_locking["broker"].release_lock.assert_called_once_with("token-refresh")
+        mock_dependencies_locking["broker"].publish_token_event.assert_called_once_with(
+            "refreshed"
+        )
 
     def test_get_valid_access_token_releases_lock_on_success(self, mock_dependencies_locking):
         """Test that lock is released after successful token refresh."""
@@ -450,27 +457,42 @@ class TestSchwabClientDistributedLocking:
         with pytest.raises(Exception, match="Unable to obtain valid access token"):
             client.get_valid_access_token()
 
-        # Lock should still be released in finally block
+        # Lock should still be released and waiters told the refresh failed
         mock_dependencies_locking["broker"].release_lock.assert_called_once_with("token-refresh")
+        mock_dependencies_locking["broker"].publish_token_event.assert_called_once_with("failed")
 
     def test_get_valid_access_token_waits_when_lock_not_acquired(self, mock_dependencies_locking):
-        """Test that thread waits when another thread holds the lock."""
-        # Simulate lock acquisition failure (another thread is refreshing)
-        mock_dependencies_locking["broker"].acquire_lock.return_value = False
-        # After waiting, token is available (other thread refreshed it)
-        mock_dependencies_locking["broker"].get_access_token.side_effect = [
-            None,
-            "token_from_other_thread",
-        ]
+        """Test that a process waits for the lock holder's pub/sub notification."""
+        broker = mock_dependencies_locking["broker"]
+        # Simulate lock acquisition failure (another process is refreshing)
+        broker.acquire_lock.return_value = False
+        pubsub = broker.subscribe_token_events.return_value
+        pubsub.get_message.side_effect = [None, {"data": b"refreshed"}]
+        # Still missing after subscribing, available once the refresh is announced
+        broker.get_access_token.side_effect = [None, None, "token_from_other_process"]
 
         client = SchwabClient()
         token = client.get_valid_access_token()
 
-        assert token == "token_from_other_thread"
-        # Verify thread waited
-        mock_dependencies_locking["time_sleep"].assert_called_once_with(0.5)
+        assert token == "token_from_other_process"
+        # Verify the wait blocked on pub/sub rather than sleeping
+        mock_dependencies_locking["time_sleep"].assert_not_called()
+        assert pubsub.get_message.call_count == 2
+        pubsub.close.assert_called_once()
         # Verify lock was never released (we never acquired it)
-        mock_dependencies_locking["broker"].release_lock.assert_not_called()
+        broker.release_lock.assert_not_called()
+
+    def test_get_valid_access_token_token_ready_after_subscribing(self, mock_dependencies_locking):
+        """Test a refresh finishing before the subscription is not waited for."""
+        broker = mock_dependencies_locking["broker"]
+        broker.acquire_lock.return_value = False
+        broker.get_access_token.side_effect = [None, "token_from_other_process"]
+
+        client = SchwabClient()
+        token = client.get_valid_access_token()
+
+        assert token == "token_from_other_process"
+        broker.subscribe_token_events.return_value.get_message.assert_not_called()
 
     def test_get_valid_access_token_double_check_after_lock(self, mock_dependencies_locking):
         """Test double-check pattern: recheck Redis after acquiring lock."""
@@ -496,18 +518,39 @@ class TestSchwabClientDistributedLocking:
     def test_get_valid_access_token_fails_when_other_thread_refresh_fails(
         self, mock_dependencies_locking
     ):
-        """Test exception when lock not acquired and other thread's refresh fails."""
-        # Lock acquisition fails (another thread is refreshing)
-        mock_dependencies_locking["broker"].acquire_lock.return_value = False
-        # After waiting, still no token (other thread's refresh failed)
-        mock_dependencies_locking["broker"].get_access_token.side_effect = [None, None]
+        """Test exception when lock not acquired and other process's refresh fails."""
+        broker = mock_dependencies_locking["broker"]
+        # Lock acquisition fails (another process is refreshing)
+        broker.acquire_lock.return_value = False
+        broker.get_access_token.return_value = None
+        # The lock holder announces that its refresh failed
+        broker.subscribe_token_events.return_value.get_message.return_value = {"data": "failed"}
 
         client = SchwabClient()
 
-        with pytest.raises(Exception, match="Token refresh by another thread failed"):
+        with pytest.raises(Exception, match="Token refresh by another process failed"):
             client.get_valid_access_token()
 
-        mock_dependencies_locking["time_sleep"].assert_called_once_with(0.5)
+        mock_dependencies_locking["time_sleep"].assert_not_called()
+
+    def test_get_valid_access_token_takes_over_expired_lock(self, mock_dependencies_locking):
+        """Test a waiter refreshes itself once a silent lock holder's lock expires."""
+        broker = mock_dependencies_locking["broker"]
+        broker.acquire_lock.side_effect = [False, True]
+        broker.subscribe_token_events.return_value.get_message.return_value = None
+        broker.get_access_token.side_effect = [None, None, None, "own_token"]
+        broker.get_refresh_token.return_value = "refresh_token"
+        mock_response = MagicMock(status_code=200)
+        mock_response.json.return_value = {"access_token": "own_token"}
+        mock_dependencies_locking["requests"].post.return_value = mock_response
+
+        client = SchwabClient()
+        client.token_manager.lock_ttl_s = 0.05
+        token = client.get_valid_access_token()
+
+        assert token == "own_token"
+        assert broker.acquire_lock.call_count == 2
+        broker.release_lock.assert_called_once_with("token-refresh")
 
     def test_get_valid_access_token_multiple_threads_scenario(self, mock_dependencies_locking):
         """Test realistic scenario with multiple threads racing to refresh."""
@@ -546,3 +589,268 @@ class TestSchwabClientDistributedLocking:
         # Verify lock was properly acquired and released
         mock_dependencies_locking["broker"].acquire_lock.assert_called_once()
         mock_dependencies_locking["broker"].release_lock.assert_called_once()
+
+
+class TestSchwabClientSessionAndTokenCache:
+    """Test pooled session reuse and the in-process access token cache."""
+
+    def test_requests_share_one_session(self, mock_dependencies_utility):
+        """Test every request goes through the same pooled session."""
+        requests_mock = mock_dependencies_utility["requests"]
+        session = requests_mock.Session.return_value
+        session.request.return_value = MagicMock(status_code=200)
+        mock_dependencies_utility["broker"].get_access_token.return_value = "test_token"
+
+        client = SchwabClient(pool_size=4)
+        for _ in range(3):
+            client.make_authenticated_request("GET", "https://api.test.com/test")
+
+        requests_mock.Session.assert_called_once()
+        assert session.request.call_count == 3
+        assert [c.args[0] for c in session.mount.call_args_list] == ["https://", "http://"]
+        requests_mock.request.assert_not_called()
+
+    def test_token_cached_until_expiry_margin(self, mock_dependencies_utility):
+        """Test Redis is read once per token lifetime, not once per request."""
+        broker = mock_dependencies_utility["broker"]
+        broker.get_access_token.side_effect = ["token_1", "token_2"]
+        broker.get_access_token_ttl.return_value = 1800
+
+        client = SchwabClient(token_expiry_margin_s=60.0)
+        with patch("system.algo_trader.infra.schwab.schwab_client.time.monotonic") as clock:
+            clock.return_value = 1000.0
+            first = [client.get_valid_access_token() for _ in range(5)]
+            clock.return_value = 1000.0 + 1800 - 60
+            expired = client.get_valid_access_token()
+
+        assert first == ["token_1"] * 5
+        assert expired == "token_2"
+        assert broker.get_access_token.call_count == 2
+
+    def test_token_with_unknown_expiry_not_cached(self, mock_dependencies_utility):
+        """Test tokens without a known TTL are re-read on every call."""
+        broker = mock_dependencies_utility["broker"]
+        broker.get_access_token.return_value = "token"
+        broker.get_access_token_ttl.return_value = -1
+
+        client = SchwabClient()
+        client.get_valid_access_token()
+        client.get_valid_access_token()
+
+        assert broker.get_access_token.call_count == 2
+
+    def test_unauthorized_response_refreshes_and_retries(self, mock_dependencies_utility):
+        """Test a 401 forces a token refresh and the request is retried once."""
+        broker = mock_dependencies_utility["broker"]
+        stored = {"token": "stale_token"}
+        broker.get_access_token.side_effect = lambda: stored["token"]
+        broker.delete_access_token.side_effect = lambda: stored.update(token=None)
+        broker.get_access_token_ttl.return_value = 1800
+        session = mock_dependencies_utility["requests"].Session.return_value
+        session.request.side_effect = [MagicMock(status_code=401), MagicMock(status_code=200)]
+
+        client = SchwabClient()
+        with patch.object(
+            client.token_manager,
+            "refresh_token",
+            side_effect=lambda: stored.update(token="fresh_token") is None,
+        ) as refresh:
+            response = client.make_authenticated_request(
+                "GET", "https://api.test.com/test", headers={"X-Test": "1"}
+            )
+
+        assert response.status_code == 200
+        refresh.assert_called_once_with()
+        tokens = [c.kwargs["headers"]["Authorization"] for c in session.request.call_args_list]
+        assert tokens == ["Bearer stale_token", "Bearer fresh_token"]
+        assert session.request.call_args.kwargs["headers"]["X-Test"] == "1"
+        broker.delete_access_token.assert_called_once_with()
+        broker.release_lock.assert_called_with("token-refresh")
+
+    def test_unauthorized_skips_refresh_when_token_already_replaced(
+        self, mock_dependencies_utility
+    ):
+        """Test a 401 does not refresh again once another caller replaced the token."""
+        broker = mock_dependencies_utility["broker"]
+        tokens = iter(["stale_token"])
+        broker.get_access_token.side_effect = lambda: next(tokens, "fresh_token")
+        broker.get_access_token_ttl.return_value = 1800
+        session = mock_dependencies_utility["requests"].Session.return_value
+        session.request.side_effect = [MagicMock(status_code=401), MagicMock(status_code=200)]
+
+        client = SchwabClient()
+        with patch.object(client.token_manager, "refresh_token") as refresh:
+            response = client.make_authenticated_request("GET", "https://api.test.com/test")
+
+        assert response.status_code == 200
+        refresh.assert_not_called()
+        broker.delete_access_token.assert_not_called()
+        assert session.request.call_args.kwargs["headers"]["Authorization"] == "Bearer fresh_token"
+
+    def test_unauthorized_with_failed_refresh_returns_response(self, mock_dependencies_utility):
+        """Test a failed refresh after a 401 is logged and the 401 returned."""
+        broker = mock_dependencies_utility["broker"]
+        stored = {"token": "stale_token"}
+        broker.get_access_token.side_effect = lambda: stored["token"]
+        broker.delete_access_token.side_effect = lambda: stored.update(token=None)
+        broker.get_access_token_ttl.return_value = 1800
+        session = mock_dependencies_utility["requests"].Session.return_value
+        session.request.return_value = MagicMock(status_code=401)
+
+        client = SchwabClient()
+        with (
+            patch.object(client.token_manager, "refresh_token", return_value=False),
+            patch.object(client.oauth2_handler, "authenticate", return_value=None),
+        ):
+            response = client.make_authenticated_request("GET", "https://api.test.com/test")
+
+        assert response.status_code == 401
+        assert session.request.call_count == 1
+        broker.delete_access_token.assert_called_once_with()
+        broker.publish_token_event.assert_called_once_with("failed")
+
+    def test_concurrent_callers_share_one_refresh(self, mock_dependencies_locking):
+        """Test threads missing the token in one process share a single refresh."""
+        broker = mock_dependencies_locking["broker"]
+        stored = {"token": None}
+        broker.get_access_token.side_effect = lambda: stored["token"]
+        broker.get_refresh_token.return_value = "refresh_token"
+        broker.acquire_lock.return_value = True
+        started = threading.Event()
+        release = threading.Event()
+
+        def slow_refresh(*args, **kwargs):
+            started.set()
+            release.wait(5)
+            response = MagicMock(status_code=200)
+            response.json.return_value = {"access_token": "shared_token"}
+            return response
+
+        mock_dependencies_locking["requests"].post.side_effect = slow_refresh
+        broker.set_access_token.side_effect = lambda token: stored.update(token=token)
+
+        client = SchwabClient()
+        results = []
+        threads = [
+            threading.Thread(target=lambda: results.append(client.get_valid_access_token()))
+            for _ in range(8)
+        ]
+        threads[0].start()
+        started.wait(5)
+        for thread in threads[1:]:
+            thread.start()
+        time.sleep(0.05)
+        release.set()
+        for thread in threads:
+            thread.join(5)
+
+        assert results == ["shared_token"] * 8
+        mock_dependencies_locking["requests"].post.assert_called_once()
+        broker.acquire_lock.assert_called_once()
+
+    def test_rejected_token_refreshed_once_across_managers(self, mock_dependencies_locking):
+        """Test two processes rejected with the same token post one refresh grant."""
+        broker = mock_dependencies_locking["broker"]
+        stored = {"token": "stale_token"}
+        lock = threading.Lock()
+        broker.get_access_token.side_effect = lambda: stored["token"]
+        broker.set_access_token.side_effect = lambda token: stored.update(token=token)
+        broker.delete_access_token.side_effect = lambda: stored.update(token=None)
+        broker.acquire_lock.side_effect = lambda *args, **kwargs: lock.acquire(blocking=False)
+        broker.release_lock.side_effect = lambda name: lock.release()
+        broker.subscribe_token_events.return_value = None
+        broker.get_refresh_token.return_value = "refresh_token"
+        started = threading.Event()
+        release = threading.Event()
+
+        def slow_refresh(*args, **kwargs):
+            started.set()
+            release.wait(5)
+            response = MagicMock(status_code=200)
+            response.json.return_value = {"access_token": "fresh_token"}
+            return response
+
+        mock_dependencies_locking["requests"].post.side_effect = slow_refresh
+        first, second = SchwabClient().token_manager, SchwabClient().token_manager
+        results = []
+        threads = [
+            threading.Thread(target=lambda m=m: results.append(m.force_refresh("stale_token")))
+            for m in (first, second)
+        ]
+        threads[0].start()
+        assert started.wait(5)
+        threads[1].start()
+        release.set()
+        for thread in threads:
+            thread.join(5)
+        late = second.force_refresh("stale_token")
+
+        assert results == ["fresh_token", "fresh_token"]
+        assert late == "fresh_token"
+        mock_dependencies_locking["requests"].post.assert_called_once()
+        broker.delete_access_token.assert_called_once_with()
+        mock_dependencies_locking["input"].assert_not_called()
+
+    def test_token_refreshed_ahead_of_expiry(self, mock_dependencies_locking):
+        """Test a token near expiry is returned while a background refresh replaces it."""
+        broker = mock_dependencies_locking["broker"]
+        broker.get_access_token.return_value = "old_token"
+        broker.get_access_token_ttl.return_value = 120
+        broker.get_refresh_token.return_value = "refresh_token"
+        broker.acquire_lock.return_value = True
+        refreshed = threading.Event()
+        mock_response = MagicMock(status_code=200)
+        mock_response.json.return_value = {"access_token": "new_token"}
+        mock_dependencies_locking["requests"].post.return_value = mock_response
+        broker.set_access_token.side_effect = lambda token: refreshed.set()
+
+        client = SchwabClient(token_expiry_margin_s=300.0)
+        first = client.get_valid_access_token()
+        second = client.get_valid_access_token()
+
+        assert (first, second) == ("old_token", "old_token")
+        assert refreshed.wait(5)
+        broker.set_access_token.assert_called_once_with("new_token")
+        mock_dependencies_locking["requests"].post.assert_called_once()
+        mock_dependencies_locking["input"].assert_not_called()
+
+
+class TestSchwabClientRateLimiting:
+    """Test requests drawing from and reporting to the shared rate limiter."""
+
+    def test_request_acquires_and_records_status(self, mock_dependencies_utility):
+        """Test each attempt takes a token and reports its status."""
+        mock_dependencies_utility["broker"].get_access_token.return_value = "test_token"
+        session = mock_dependencies_utility["requests"].Session.return_value
+        session.request.side_effect = [MagicMock(status_code=401), MagicMock(status_code=429)]
+        limiter = MagicMock()
+
+        client = SchwabClient(rate_limiter=limiter)
+        response = client.make_authenticated_request(
+            "GET", "https://api.test.com/marketdata/v1/quotes"
+        )
+
+        assert response.status_code == 429
+        assert limiter.acquire.call_count == 2
+        limiter.acquire.assert_called_with(EndpointClass.MARKET_DATA)
+        assert [c.args for c in limiter.record.call_args_list] == [
+            (EndpointClass.MARKET_DATA, 401),
+            (EndpointClass.MARKET_DATA, 429),
+        ]
+
+    def test_network_error_recorded_without_status(self, mock_dependencies_utility):
+        """Test a failed request reports no status and re-raises."""
+        requests_mock = mock_dependencies_utility["requests"]
+        requests_mock.RequestException = ConnectionError
+        mock_dependencies_utility["broker"].get_access_token.return_value = "test_token"
+        requests_mock.Session.return_value.request.side_effect = ConnectionError("reset")
+        limiter = MagicMock()
+
+        client = SchwabClient(rate_limiter=limiter)
+        with pytest.raises(ConnectionError):
+            client.make_authenticated_request(
+                "POST", "https://api.test.com/trader/v1/accounts/HASH/orders"
+            )
+
+        limiter.acquire.assert_called_once_with(EndpointClass.ORDERS)
+        limiter.record.assert_called_once_with(EndpointClass.ORDERS, None)
@@ -0,0 +1,275 @@
+"""Unit tests for the streaming quote book and coalescing event port.
+
+Tests cover quote book merging, in-memory get_quotes, burst coalescing into
+QUOTE_EVENT ticks, command precedence, Schwab streamer frame parsing over a
+local socket, and an Engine run driven entirely by the streaming ports.
+"""
+
+import json
+import socket
+import threading
+import time
+from datetime import datetime, timezone
+
+import pytest
+
+from system.algo_trader.domain.engine import Engine
+from system.algo_trader.domain.models import Event
+from system.algo_trader.domain.states import (
+    ControllerCommand,
+    EngineState,
+    EventType,
+    TickReason,
+)
+from system.algo_trader.infra.streaming.quote_stream import (
+    QuoteStream,
+    StreamingEventPort,
+    StreamingQuotePort,
+)
+from system.algo_trader.infra.streaming.sources import (
+    MessageQuoteSource,
+    QuoteUpdate,
+    ReplayQuoteSource,
+    parse_levelone_equities,
+)
+
+NOW = datetime(2024, 1, 2, 15, 30, tzinfo=timezone.utc)
+
+
+def _update(symbol: str, last: float, **fields: float) -> QuoteUpdate:
+    return QuoteUpdate(timestamp=NOW, symbol=symbol, fields={"last": last, **fields})
+
+
+def _command(command: ControllerCommand) -> Event:
+    return Event(timestamp=NOW, type=EventType.COMMAND, command=command)
+
+
+def _wait_until(predicate, timeout_s: float = 5.0) -> None:
+    deadline = time.monotonic() + timeout_s
+    while not predicate():
+        assert time.monotonic() < deadline, "condition not reached"
+        time.sleep(0.001)
+
+
+class TestQuoteStream:
+    """Test the live quote book."""
+
+    @pytest.mark.unit
+    def test_get_quotes_merges_partial_updates(self):
+        """Test later partial updates keep earlier fields per symbol."""
+        source = ReplayQuoteSource(
+            [[_update("AAPL", 100.0, bid=99.5)], [_update("AAPL", 101.0), _update("MSFT", 300.0)]],
+            end=True,
+        )
+        stream = QuoteStream(source).start()
+        _wait_until(lambda: stream.ended)
+
+        quote = StreamingQuotePort(stream).get_quotes()
+
+        assert quote.last == {"AAPL": 101.0, "MSFT": 300.0}
+        assert quote.bid == {"AAPL": 99.5}
+        assert quote.asset_class == "EQUITY"
+        assert stream.version == 3
+
+    @pytest.mark.unit
+    def test_symbol_filter_ignores_other_symbols(self):
+        """Test updates for unsubscribed symbols do not reach the book."""
+        stream = QuoteStream(
+            ReplayQuoteSource([[_update("AAPL", 1.0), _update("TSLA", 2.0)]], end=True),
+            symbols=["AAPL"],
+        ).start()
+        _wait_until(lambda: stream.ended)
+
+        assert stream.snapshot().last == {"AAPL": 1.0}
+
+
+class TestStreamingEventPort:
+    """Test tick coalescing and command precedence."""
+
+    @pytest.mark.unit
+    def test_burst_coalesces_into_one_tick(self):
+        """Test a burst within the window produces exactly one QUOTE_EVENT tick."""
+        source = ReplayQuoteSource()
+        stream = QuoteStream(source).start()
+        events = StreamingEventPort(stream, coalesce_window_s=0.05)
+
+        for i in range(20):
+            source.push([_update("AAPL", 100.0 + i)])
+        event = events.wait_for_event(timeout_s=2.0)
+        idle = events.wait_for_event(timeout_s=0.1)
+
+        assert (event.type, event.reason) == (EventType.TICK, TickReason.QUOTE_EVENT)
+        assert idle is None
+        assert events.ticks == 1
+        assert events.updates_per_tick == 20
+        assert stream.snapshot().last == {"AAPL": 119.0}
+        stream.close()
+
+    @pytest.mark.unit
+    def test_updates_during_tick_form_next_burst(self):
+        """Test updates after a tick is emitted produce a second tick."""
+        source = ReplayQuoteSource()
+        stream = QuoteStream(source).start()
+        events = StreamingEventPort(stream, coalesce_window_s=0.01)
+
+        source.push([_update("AAPL", 1.0)])
+        assert events.wait_for_event(timeout_s=2.0) is not None
+        source.push([_update("AAPL", 2.0)])
+        assert events.wait_for_event(timeout_s=2.0) is not None
+
+        assert events.ticks == 2
+        stream.close()
+
+    @pytest.mark.unit
+    def test_commands_take_precedence_over_pending_tick(self):
+        """Test a submitted command is returned before a pending tick."""
+        source = ReplayQuoteSource()
+        stream = QuoteStream(source).start()
+        events = StreamingEventPort(stream, coalesce_window_s=0.01)
+        source.push([_update("AAPL", 1.0)])
+        _wait_until(lambda: stream.version == 1)
+
+        events.submit(_command(ControllerCommand.PAUSE))
+
+        assert events.wait_for_event(timeout_s=1.0).command == ControllerCommand.PAUSE
+        assert events.wait_for_event(timeout_s=1.0).type == EventType.TICK
+        stream.close()
+
+    @pytest.mark.unit
+    def test_timeout_without_updates_returns_none(self):
+        """Test wait_for_event honors its timeout when nothing arrives."""
+        stream = QuoteStream(ReplayQuoteSource()).start()
+        events = StreamingEventPort(stream)
+
+        start = time.monotonic()
+        assert events.wait_for_event(timeout_s=0.05) is None
+        assert time.monotonic() - start >= 0.05
+        stream.close()
+
+
+    @pytest.mark.unit
+    def test_source_end_wakes_waiter_with_stop(self):
+        """Test closing the source while the engine waits returns a STOP command."""
+        source = ReplayQuoteSource()
+        stream = QuoteStream(source).start()
+        events = StreamingEventPort(stream, coalesce_window_s=0.01)
+        quotes = StreamingQuotePort(stream)
+        assert quotes.staleness_s() == float("inf")
+        source.push([_update("AAPL", 1.0)])
+        assert events.wait_for_event(timeout_s=2.0).type == EventType.TICK
+        result = []
+        waiter = threading.Thread(target=lambda: result.append(events.wait_for_event(None)))
+        waiter.start()
+        time.sleep(0.05)
+        assert waiter.is_alive()
+
+        stream.close()
+        waiter.join(2.0)
+
+        assert not waiter.is_alive()
+        assert (result[0].type, result[0].command) == (EventType.COMMAND, ControllerCommand.STOP)
+        assert quotes.ended
+        assert 0.0 < quotes.staleness_s() < float("inf")
+
+
+class TestMessageQuoteSource:
+    """Test streamer frame decoding over a local transport."""
+
+    @pytest.mark.unit
+    def test_parse_levelone_equities_maps_fields(self):
+        """Test numbered LEVELONE_EQUITIES fields map to quote fields."""
+        frame = json.dumps(
+            {
+                "data": [
+                    {
+                        "service": "LEVELONE_EQUITIES",
+                        "timestamp": 1_704_209_400_000,
+                        "command": "SUBS",
+                        "content": [{"key": "AAPL", "1": 99.5, "2": 100.5, "3": 100.0}],
+                    },
+                    {"service": "CHART_EQUITY", "content": [{"key": "AAPL", "1": 1.0}]},
+                ]
+            }
+        )
+
+        (update,) = parse_levelone_equities(frame)
+
+        assert update.symbol == "AAPL"
+        assert update.fields == {"bid": 99.5, "ask": 100.5, "last": 100.0}
+        assert update.timestamp == NOW
+        assert parse_levelone_equities('{"notify": [{"heartbeat": "1"}]}') == []
+
+    @pytest.mark.integration
+    def test_reads_frames_from_local_socket(self):
+        """Test a socket transport feeds the book and bad frames are skipped."""
+        server, client = socket.socketpair()
+        reader = client.makefile("r", encoding="utf-8")
+        source = MessageQuoteSource(reader.readline, on_close=client.close)
+        stream = QuoteStream(source).start()
+        frame = {
+            "data": [
+                {
+                    "service": "LEVELONE_EQUITIES",
+                    "timestamp": 0,
+                    "content": [{"key": "MSFT", "3": 310.25, "8": 1000}],
+                }
+            ]
+        }
+
+        server.sendall(b"not json\n" + json.dumps(frame).encode() + b"\n")
+        server.close()
+        _wait_until(lambda: stream.ended)
+
+        assert stream.snapshot().last == {"MSFT": 310.25}
+        assert stream.snapshot().volume == {"MSFT": 1000.0}
+        assert source.parse_errors == 1
+
+
+class TestStreamingEngine:
+    """Test Engine.run() driven by the streaming ports."""
+
+    @pytest.mark.e2e
+    @pytest.mark.timeout(10)
+    def test_engine_ticks_on_quote_bursts(
+        self,
+        fake_historical_port,
+        fake_account_port,
+        fake_order_port,
+        fake_strategy_port,
+        fake_portfolio_manager_port,
+        fake_journal_port,
+        fake_controller_port,
+    ):
+        """Test each burst triggers one tick that sees the latest book."""
+        source = ReplayQuoteSource()
+        stream = QuoteStream(source).start()
+        events = StreamingEventPort(stream, coalesce_window_s=0.02)
+        engine = Engine(
+            historical_port=fake_historical_port,
+            quote_port=StreamingQuotePort(stream),
+            account_port=fake_account_port,
+            order_port=fake_order_port,
+            strategy_port=fake_strategy_port,
+            portfolio_manager_port=fake_portfolio_manager_port,
+            journal_port=fake_journal_port,
+            controller_port=fake_controller_port,
+            event_port=events,
+        )
+        engine_thread = threading.Thread(target=engine.run, daemon=True)
+        engine_thread.start()
+
+        events.submit(_command(ControllerCommand.START))
+        source.push([_update("AAPL", 100.0 + i) for i in range(10)])
+        _wait_until(lambda: len(fake_journal_port.inputs) == 1)
+        source.push([_update("AAPL", 200.0)])
+        _wait_until(lambda: len(fake_journal_port.inputs) == 2)
+        events.submit(_command(ControllerCommand.STOP))
+        engine_thread.join(5.0)
+        stream.close()
+
+        assert not engine_thread.is_alive()
+        assert [entry.quote_data.last["AAPL"] for entry in fake_journal_port.inputs] == [
+            109.0,
+            200.0,
+        ]
+        assert fake_controller_port.published_statuses[-1] == EngineState.STOPPED
@@ -0,0 +1,79 @@
+"""Unit tests for the tick latency Prometheus textfile export.
+
+Tests cover summary rendering in seconds and the TextfileControllerPort
+decorator writing the textfile and forwarding to the wrapped port.
+"""
+
+from unittest.mock import Mock
+
+import pytest
+
+from system.algo_trader.domain.models import StageLatency
+from system.algo_trader.domain.ports.controller_port import ControllerPort
+from system.algo_trader.domain.states import EngineState
+from system.algo_trader.infra.telemetry.latency_textfile import (
+    TextfileControllerPort,
+    render_latency,
+)
+
+LATENCY = [
+    StageLatency(
+        stage="strategy",
+        count=4,
+        mean_ms=2.5,
+        p50_ms=2.0,
+        p90_ms=3.0,
+        p99_ms=4.0,
+        p999_ms=4.0,
+        max_ms=4.0,
+        total_ms=10.0,
+    )
+]
+
+
+class TestRenderLatency:
+    """Test Prometheus text rendering."""
+
+    @pytest.mark.unit
+    def test_renders_summary_in_seconds(self):
+        """Test quantiles, sum, count and max are emitted per stage."""
+        lines = render_latency(LATENCY).splitlines()
+
+        metric = "node_textfile_algo_trader_stage_latency_seconds"
+        assert f"# TYPE {metric} summary" in lines
+        assert f'{metric}{{stage="strategy",quantile="0.5"}} 0.002' in lines
+        assert f'{metric}{{stage="strategy",quantile="0.99"}} 0.004' in lines
+        assert f'{metric}_sum{{stage="strategy"}} 0.01' in lines
+        assert f'{metric}_count{{stage="strategy"}} 4' in lines
+        max_metric = "node_textfile_algo_trader_stage_latency_max_seconds"
+        assert f'{max_metric}{{stage="strategy"}} 0.004' in lines
+
+
+class TestTextfileControllerPort:
+    """Test the ControllerPort decorator."""
+
+    @pytest.mark.unit
+    def test_writes_textfile_and_forwards(self, tmp_path):
+        """Test latency reports are written atomically and forwarded."""
+        inner = Mock(spec=ControllerPort)
+        port = TextfileControllerPort(inner, tmp_path)
+
+        port.publish_latency(LATENCY)
+        port.publish_status(EngineState.RUNNING)
+
+        assert (tmp_path / "algo_trader_latency.prom").read_text() == render_latency(LATENCY)
+        assert not list(tmp_path.glob("*.tmp"))
+        inner.publish_latency.assert_called_once_with(LATENCY)
+        inner.publish_status.assert_called_once_with(EngineState.RUNNING)
+
+    @pytest.mark.unit
+    def test_write_failure_still_forwards(self, tmp_path):
+        """Test an unwritable directory is logged and the report still forwarded."""
+        blocker = tmp_path / "file"
+        blocker.write_text("")
+        inner = Mock(spec=ControllerPort)
+        port = TextfileControllerPort(inner, blocker)
+
+        port.publish_latency(LATENCY)
+
+        inner.publish_latency.assert_called_once_with(LATENCY)
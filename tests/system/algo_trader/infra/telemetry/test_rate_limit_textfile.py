@@ -0,0 +1,64 @@
+"""Unit tests for the rate limiter Prometheus textfile export.
+
+Tests cover rendering one series per endpoint class and the metrics sink
+writing the textfile atomically.
+"""
+
+import pytest
+
+from system.algo_trader.infra.redis.rate_limiter import EndpointClass, RateLimitStats
+from system.algo_trader.infra.telemetry.rate_limit_textfile import (
+    RateLimitTextfile,
+    render_rate_limits,
+)
+
+STATS = [
+    RateLimitStats(
+        endpoint=EndpointClass.MARKET_DATA,
+        rate=1.5,
+        requests=300,
+        waits=40,
+        wait_s_total=12.5,
+        wait_s_max=0.5,
+        throttled=2,
+        fallbacks=1,
+    ),
+    RateLimitStats(endpoint=EndpointClass.ORDERS, rate=2.0),
+]
+
+
+class TestRenderRateLimits:
+    """Test Prometheus text rendering."""
+
+    @pytest.mark.unit
+    def test_renders_series_per_endpoint(self):
+        """Test every metric has a typed series for each endpoint class."""
+        lines = render_rate_limits(STATS).splitlines()
+
+        prefix = "node_textfile_algo_trader_rate_limit"
+        assert f"# TYPE {prefix}_rate gauge" in lines
+        assert f'{prefix}_rate{{endpoint="market_data"}} 1.5' in lines
+        assert f'{prefix}_rate{{endpoint="orders"}} 2' in lines
+        assert f'{prefix}_wait_seconds_sum{{endpoint="market_data"}} 12.5' in lines
+        assert f'{prefix}_wait_seconds_count{{endpoint="market_data"}} 40' in lines
+        assert f'{prefix}_wait_max_seconds{{endpoint="market_data"}} 0.5' in lines
+        assert f'{prefix}_requests_total{{endpoint="market_data"}} 300' in lines
+        assert f'{prefix}_throttled_total{{endpoint="market_data"}} 2' in lines
+        assert f'{prefix}_fallback_total{{endpoint="orders"}} 0' in lines
+
+
+class TestRateLimitTextfile:
+    """Test the metrics sink."""
+
+    @pytest.mark.unit
+    def test_writes_textfile(self, tmp_path):
+        """Test the sink replaces the textfile without leaving a temp file."""
+        sink = RateLimitTextfile(tmp_path, filename="limits.prom")
+
+        sink(STATS)
+        sink(STATS[:1])
+
+        content = (tmp_path / "limits.prom").read_text(encoding="utf-8")
+        assert 'endpoint="market_data"' in content
+        assert 'endpoint="orders"' not in content
+        assert [p.name for p in tmp_path.iterdir()] == ["limits.prom"]